@@ -44,6 +44,7 @@ from psi4.driver import driver_util
 from psi4.driver import driver_cbs
 from psi4.driver import driver_nbody
 from psi4.driver import driver_findif
+from psi4.driver import driver_concurrent
 from psi4.driver import p4util
 from psi4.driver import qcdb
 from psi4.driver.procrouting import *
@@ -165,6 +166,29 @@ def _process_displacement(derivfunc, method, molecule, displacement, n, ndisp, *
     print(""" %d""" % (n), end=('\n' if (n == ndisp) else ''))
     sys.stdout.flush()
 
+    clone = _displaced_molecule(molecule, displacement)
+
+    # clean possibly necessary for n=1 if its irrep (unsorted in displacement list) different from initial G0 for freq
+    core.clean()
+
+    # Perform the derivative calculation
+    derivative, wfn = derivfunc(method, return_wfn=True, molecule=clone, **kwargs)
+    displacement["energy"] = core.variable('CURRENT ENERGY')
+
+    # If we computed a first or higher order derivative, set it.
+    if derivfunc == gradient:
+        displacement["gradient"] = wfn.gradient().np.ravel().tolist()
+
+    # clean may be necessary when changing irreps of displacements
+    core.clean()
+
+    return wfn
+
+
+def _displaced_molecule(molecule, displacement):
+    """Returns a clone of *molecule* at the geometry of *displacement*,
+       with the point group weakened if the user insisted on symmetry.
+    """
     parent_group = molecule.point_group()
     clone = molecule.clone()
     clone.reinterpret_coordentry(False)
@@ -181,21 +205,34 @@ def _process_displacement(derivfunc, method, molecule, displacement, n, ndisp, *
         new_symm_string = qcdb.PointGroup.bits_to_full_name(new_bits)
         clone.reset_point_group(new_symm_string)
 
-    # clean possibly necessary for n=1 if its irrep (unsorted in displacement list) different from initial G0 for freq
-    core.clean()
+    return clone
 
-    # Perform the derivative calculation
-    derivative, wfn = derivfunc(method, return_wfn=True, molecule=clone, **kwargs)
-    displacement["energy"] = core.variable('CURRENT ENERGY')
 
-    # If we computed a first or higher order derivative, set it.
-    if derivfunc == gradient:
-        displacement["gradient"] = wfn.gradient().np.ravel().tolist()
+def _process_displacements(derivfunc, method, molecule, displacements, ndisp, ntask, **kwargs):
+    """Runs all displaced-geometry computations but the reference, either one
+       after the other or, for *ntask* > 1, as concurrent subcalculations.
+       Results are stored in the *displacements* dicts as for
+       :py:func:`_process_displacement`.
+    """
+    displacements = list(displacements)
 
-    # clean may be necessary when changing irreps of displacements
-    core.clean()
+    if ntask > 1 and driver_concurrent.task_is_portable(derivfunc, kwargs):
+        tasks = [
+            driver_concurrent.build_task(derivfunc, method, _displaced_molecule(molecule, displacement), kwargs,
+                                         "displacement %d" % n)
+            for n, displacement in enumerate(displacements, start=2)
+        ]
+        print(""" running %d concurrently ...""" % len(tasks))
+        results = driver_concurrent.run_tasks(tasks, ntask)
 
-    return wfn
+        for displacement, result in zip(displacements, results):
+            displacement["energy"] = result["energy"]
+            if derivfunc == gradient:
+                displacement["gradient"] = result["gradient"].ravel().tolist()
+        return
+
+    for n, displacement in enumerate(displacements, start=2):
+        _process_displacement(derivfunc, method, molecule, displacement, n, ndisp, **kwargs)
 
 
 def _filter_renamed_methods(compute, method):
@@ -596,6 +633,12 @@ def gradient(name, **kwargs):
 
     :returns: (:py:class:`~psi4.core.Matrix`, :py:class:`~psi4.core.Wavefunction`) |w--w| gradient and wavefunction when **return_wfn** specified.
 
+    :type concurrent_tasks: int
+    :param concurrent_tasks: |dl| ``1`` |dr| || ``4`` || etc.
+
+        Number of finite difference displacements to run at once, each in a
+        worker process with its share of the threads and memory.
+
     :examples:
 
     >>> # [1] Single-point dft gradient getting the gradient
@@ -726,13 +769,14 @@ def gradient(name, **kwargs):
 
         print(""" %d displacements needed ...""" % (ndisp), end='')
 
+        ntask = driver_concurrent.concurrent_tasks_requested(kwargs)
+
         wfn = _process_displacement(energy, lowername, molecule, findif_meta_dict["reference"], 1, ndisp,
                                     **kwargs)
         var_dict = core.variables()
 
-        for n, displacement in enumerate(findif_meta_dict["displacements"].values(), start=2):
-            _process_displacement(
-                energy, lowername, molecule, displacement, n, ndisp, write_orbitals=False, **kwargs)
+        _process_displacements(energy, lowername, molecule, findif_meta_dict["displacements"].values(), ndisp, ntask,
+                               write_orbitals=False, **kwargs)
 
         # Reset variables
         for key, val in var_dict.items():
@@ -1191,6 +1235,12 @@ def hessian(name, **kwargs):
 
     :returns: (:py:class:`~psi4.core.Matrix`, :py:class:`~psi4.core.Wavefunction`) |w--w| Hessian and wavefunction when **return_wfn** specified.
 
+    :type concurrent_tasks: int
+    :param concurrent_tasks: |dl| ``1`` |dr| || ``4`` || etc.
+
+        Number of finite difference displacements to run at once, each in a
+        worker process with its share of the threads and memory.
+
     :examples:
 
     >>> # [1] Frequency calculation without thermochemical analysis
@@ -1317,13 +1367,14 @@ def hessian(name, **kwargs):
 
         print(""" %d displacements needed.""" % ndisp)
 
+        ntask = driver_concurrent.concurrent_tasks_requested(kwargs)
+
         wfn = _process_displacement(gradient, lowername, molecule, findif_meta_dict["reference"], 1, ndisp,
                                     **kwargs)
         var_dict = core.variables()
 
-        for n, displacement in enumerate(findif_meta_dict["displacements"].values(), start=2):
-            _process_displacement(
-                gradient, lowername, molecule, displacement, n, ndisp, write_orbitals=False, **kwargs)
+        _process_displacements(gradient, lowername, molecule, findif_meta_dict["displacements"].values(), ndisp, ntask,
+                               write_orbitals=False, **kwargs)
 
         # Reset variables
         for key, val in var_dict.items():
@@ -1361,13 +1412,14 @@ def hessian(name, **kwargs):
 
         print(' %d displacements needed.' % ndisp)
 
+        ntask = driver_concurrent.concurrent_tasks_requested(kwargs)
+
         wfn = _process_displacement(energy, lowername, molecule, findif_meta_dict["reference"], 1, ndisp,
                                     **kwargs)
         var_dict = core.variables()
 
-        for n, displacement in enumerate(findif_meta_dict["displacements"].values(), start=2):
-            _process_displacement(
-                energy, lowername, molecule, displacement, n, ndisp, write_orbitals=False, **kwargs)
+        _process_displacements(energy, lowername, molecule, findif_meta_dict["displacements"].values(), ndisp, ntask,
+                               write_orbitals=False, **kwargs)
 
         # Reset variables
         for key, val in var_dict.items():
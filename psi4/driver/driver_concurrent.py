@@ -0,0 +1,230 @@
+#
+# @BEGIN LICENSE
+#
+# Psi4: an open-source quantum chemistry software package
+#
+# Copyright (c) 2007-2019 The Psi4 Developers.
+#
+# The copyrights for code used from other parties are included in
+# the corresponding files.
+#
+# This file is part of Psi4.
+#
+# Psi4 is free software; you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, version 3.
+#
+# Psi4 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License along
+# with Psi4; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+#
+# @END LICENSE
+#
+
+"""Scheduler for running independent subcalculations (n-body fragments,
+finite-difference displacements) concurrently.
+
+Each task runs in its own Psi4 worker process with a share of the thread
+pool and memory, a private scratch directory registered with the
+PSIOManager, and a private output file that is appended to the main output
+once the task finishes. The scheduler itself lives in the calling process and
+hands back plain results that the callers merge into their own dictionaries.
+"""
+
+import os
+import sys
+import pickle
+import shutil
+import tempfile
+import traceback
+import subprocess
+import concurrent.futures
+
+import numpy as np
+
+from psi4 import core
+from psi4.driver import qcdb
+from psi4.driver import p4util
+from psi4.driver.p4util.exceptions import *
+
+_worker_functions = ['energy', 'gradient', 'hessian']
+
+
+def concurrent_tasks_requested(kwargs):
+    """Pops the ``concurrent_tasks`` keyword and returns it as an int (1 means serial)."""
+    ntask = kwargs.pop('concurrent_tasks', 1)
+    if ntask is True:
+        ntask = core.get_num_threads()
+    return max(1, int(ntask or 1))
+
+
+def task_is_portable(func, kwargs):
+    """Whether a subcalculation can be shipped to a worker process.
+
+    External potentials (``EXTERN``), basis sets defined in the input through
+    ``basis {...}`` blocks and unpicklable keyword arguments stay in the
+    calling process.
+    """
+    if getattr(func, '__name__', None) not in _worker_functions:
+        return False
+    if core.get_option('SCF', 'EXTERN') or kwargs.get('embedding_charges', False):
+        return False
+    if _uses_custom_basis():
+        return False
+    try:
+        pickle.dumps(kwargs)
+    except Exception:
+        return False
+    return True
+
+
+def _uses_custom_basis():
+    """Whether any basis option names a basis function registered by a ``basis {...}`` block.
+
+    Those functions live only in the calling interpreter and cannot be pickled.
+    """
+    horde = qcdb.libmintsbasisset.basishorde
+    if not horde:
+        return False
+    for module_options in p4util.prepare_options_for_modules(changedOnly=True).values():
+        for opt in module_options.values():
+            if isinstance(opt['value'], str) and opt['value'].upper() in horde:
+                return True
+    return False
+
+
+def build_task(func, method, molecule, kwargs, label):
+    """Packs one subcalculation into a picklable task description."""
+    return {
+        'func': func.__name__,
+        'method': method,
+        'molecule': molecule.to_dict(),
+        'kwargs': {k: v for k, v in kwargs.items() if k not in ['molecule', 'return_wfn']},
+        'label': label,
+    }
+
+
+def run_tasks(tasks, ntask):
+    """Runs *tasks* with up to *ntask* concurrent workers.
+
+    Threads and memory are split evenly between the workers. Results are
+    returned in the order of *tasks*; each is a dict with ``'return'`` (float or
+    ndarray), ``'energy'`` and ``'gradient'`` (ndarray or None). The QCVariables
+    set by the workers are copied into the calling process in task order, as a
+    serial run would leave them.
+    """
+    ntask = max(1, min(ntask, len(tasks)))
+    nthread = max(1, core.get_num_threads() // ntask)
+    memory = core.get_memory() // ntask
+
+    options = p4util.prepare_options_for_modules(changedOnly=True)
+    scratch = core.IOManager.shared_object().get_default_path()
+
+    core.print_out("\n  ==> Concurrent Subcalculations <==\n\n")
+    core.print_out("    Tasks               = %6d\n" % len(tasks))
+    core.print_out("    Concurrent workers  = %6d\n" % ntask)
+    core.print_out("    Threads per worker  = %6d\n" % nthread)
+    core.print_out("    Memory per worker   = %6.3f [GiB]\n\n" % (memory / 1024.**3))
+
+    workdirs = []
+    for n, task in enumerate(tasks):
+        workdir = tempfile.mkdtemp(prefix='psi.%d.task%d.' % (os.getpid(), n), dir=scratch)
+        task.update({'options': options, 'nthread': nthread, 'memory': memory, 'scratch': workdir})
+        with open(os.path.join(workdir, 'task.pkl'), 'wb') as handle:
+            pickle.dump(task, handle)
+        workdirs.append(workdir)
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=ntask) as pool:
+        returncodes = list(pool.map(_launch_worker, workdirs))
+
+    results = []
+    errors = []
+    for task, workdir, returncode in zip(tasks, workdirs, returncodes):
+        # Merge the worker output in task order
+        core.print_out("\n       Concurrent: Output of task %s\n\n" % task['label'])
+        output = os.path.join(workdir, 'output.dat')
+        if os.path.isfile(output):
+            with open(output, 'r') as handle:
+                core.print_out(handle.read())
+
+        result = None
+        resultfile = os.path.join(workdir, 'result.pkl')
+        if os.path.isfile(resultfile):
+            with open(resultfile, 'rb') as handle:
+                result = pickle.load(handle)
+        if returncode or (result is None) or ('error' in result):
+            errors.append("%s: %s" % (task['label'], result['error'] if result else "worker exited with code %d" %
+                                      returncode))
+        results.append(result)
+        shutil.rmtree(workdir, ignore_errors=True)
+
+    if errors:
+        raise ValidationError("Concurrent subcalculations failed:\n" + "\n".join(errors))
+
+    for result in results:
+        for key, val in result.pop('variables').items():
+            core.set_variable(key, val)
+
+    return results
+
+
+def _launch_worker(workdir):
+    env = os.environ.copy()
+    env['PYTHONPATH'] = os.pathsep.join(p for p in sys.path if p)
+    cmd = [
+        sys.executable, '-c', 'import sys; from psi4.driver.driver_concurrent import _run_task_file; '
+        '_run_task_file(sys.argv[1])', workdir
+    ]
+    with open(os.path.join(workdir, 'worker.log'), 'w') as log:
+        return subprocess.call(cmd, env=env, stdout=log, stderr=subprocess.STDOUT)
+
+
+def _run_task_file(workdir):
+    """Entry point of a worker process."""
+    with open(os.path.join(workdir, 'task.pkl'), 'rb') as handle:
+        task = pickle.load(handle)
+
+    try:
+        result = _run_task(task, workdir)
+    except Exception:
+        result = {'error': traceback.format_exc()}
+
+    with open(os.path.join(workdir, 'result.pkl'), 'wb') as handle:
+        pickle.dump(result, handle)
+
+
+def _run_task(task, workdir):
+    from psi4.driver import driver
+
+    core.set_output_file(os.path.join(workdir, 'output.dat'), False)
+    core.set_num_threads(task['nthread'], quiet=True)
+    core.set_memory_bytes(task['memory'], quiet=True)
+    core.IOManager.shared_object().set_default_path(workdir)
+    p4util.reset_pe_options(task['options'])
+
+    molecule = core.Molecule.from_dict(task['molecule'])
+    func = getattr(driver, task['func'])
+    ret, wfn = func(task['method'], molecule=molecule, return_wfn=True, **task['kwargs'])
+
+    result = {
+        'return': ret.to_array() if isinstance(ret, core.Matrix) else ret,
+        'energy': core.variable('CURRENT ENERGY'),
+        'gradient': wfn.gradient().to_array() if wfn.gradient() else None,
+        'variables': {k: (v.to_array() if isinstance(v, core.Matrix) else v)
+                      for k, v in core.variables().items()},
+    }
+    core.clean()
+
+    return result
+
+
+def as_matrix(data):
+    """Turns an array returned by a worker back into a core.Matrix (floats pass through)."""
+    if isinstance(data, np.ndarray):
+        return core.Matrix.from_array(data)
+    return data
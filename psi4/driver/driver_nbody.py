@@ -36,6 +36,7 @@ from psi4.driver import p4util
 from psi4.driver import constants
 from psi4.driver.p4util.exceptions import *
 from psi4.driver import driver_nbody_helper
+from psi4.driver import driver_concurrent
 
 ### Math helper functions
 
@@ -199,6 +200,13 @@ def nbody_gufunc(func, method_string, **kwargs):
     :param charge_type: ``MULLIKEN_CHARGES`` || ``LOWDIN_CHARGES`` 
 
         Default is ``MULLIKEN_CHARGES``
+
+    :type concurrent_tasks: int
+    :param concurrent_tasks: |dl| ``1`` |dr| || ``8`` || etc.
+
+        Number of n-body subcalculations to run at once, each in a worker
+        process with its share of the threads and memory. Not used with
+        embedding charges.
     """
 
     # Initialize dictionaries for easy data passing
@@ -216,6 +224,7 @@ def nbody_gufunc(func, method_string, **kwargs):
     metadata['molecule'].fix_com(True)
     metadata['molecule'].fix_orientation(True)
     metadata['embedding_charges'] = kwargs.get('embedding_charges', False)
+    metadata['concurrent_tasks'] = driver_concurrent.concurrent_tasks_requested(kwargs)
     metadata['kwargs'] = kwargs
     core.clean_variables()
 
@@ -461,33 +470,60 @@ def compute_nbody_components(func, method_string, metadata):
     if kwargs.get('charge_method', False) and not metadata['embedding_charges']:
         metadata['embedding_charges'] = driver_nbody_helper.compute_charges(kwargs['charge_method'],
                                             kwargs.get('charge_type', 'MULLIKEN_CHARGES').upper(), molecule)
-    for count, n in enumerate(compute_list.keys()):
-        core.print_out("\n   ==> N-Body: Now computing %d-body complexes <==\n\n" % n)
-        total = len(compute_list[n])
-        for num, pair in enumerate(compute_list[n]):
-            core.print_out(
-                "\n       N-Body: Computing complex (%d/%d) with fragments %s in the basis of fragments %s.\n\n" %
-                (num + 1, total, str(pair[0]), str(pair[1])))
-            ghost = list(set(pair[1]) - set(pair[0]))
-
-            current_mol = molecule.extract_subsets(list(pair[0]), ghost)
-            current_mol.set_name("%s_%i_%i" % (current_mol.name(), count, num))
-            if metadata['embedding_charges']: driver_nbody_helper.electrostatic_embedding(metadata, pair=pair)
-            # Save energies info
-            ptype_dict[pair], wfn = func(method_string, molecule=current_mol, return_wfn=True, **kwargs)
-            core.set_global_option_python('EXTERN', None)
-            energies_dict[pair] = core.variable("CURRENT ENERGY")
-            gradients_dict[pair] = wfn.gradient()
+    concurrent = (metadata.get('concurrent_tasks', 1) > 1 and not metadata['embedding_charges']
+                  and driver_concurrent.task_is_portable(func, kwargs))
+    if concurrent:
+        tasks = []
+        for count, n in enumerate(compute_list.keys()):
+            for num, pair in enumerate(compute_list[n]):
+                ghost = list(set(pair[1]) - set(pair[0]))
+                current_mol = molecule.extract_subsets(list(pair[0]), ghost)
+                current_mol.set_name("%s_%i_%i" % (current_mol.name(), count, num))
+                task = driver_concurrent.build_task(func, method_string, current_mol, kwargs, str(pair))
+                task['pair'] = pair
+                tasks.append(task)
+
+        core.print_out("\n   ==> N-Body: Computing %d complexes concurrently <==\n\n" % len(tasks))
+        results = driver_concurrent.run_tasks(tasks, metadata['concurrent_tasks'])
+
+        for task, result in zip(tasks, results):
+            pair = task['pair']
+            ptype_dict[pair] = driver_concurrent.as_matrix(result['return'])
+            energies_dict[pair] = result['energy']
+            gradients_dict[pair] = driver_concurrent.as_matrix(result['gradient'])
             var_key = "N-BODY (%s)@(%s) TOTAL ENERGY" % (', '.join([str(i) for i in pair[0]]), ', '.join(
                 [str(i) for i in pair[1]]))
-            intermediates_dict[var_key] = core.variable("CURRENT ENERGY")
+            intermediates_dict[var_key] = result['energy']
             core.print_out("\n       N-Body: Complex Energy (fragments = %s, basis = %s: %20.14f)\n" % (str(
                 pair[0]), str(pair[1]), energies_dict[pair]))
-            # Flip this off for now, needs more testing
-            #if 'cp' in bsse_type_list and (len(bsse_type_list) == 1):
-            #    core.set_global_option('DF_INTS_IO', 'LOAD')
-
-            core.clean()
+    else:
+        for count, n in enumerate(compute_list.keys()):
+            core.print_out("\n   ==> N-Body: Now computing %d-body complexes <==\n\n" % n)
+            total = len(compute_list[n])
+            for num, pair in enumerate(compute_list[n]):
+                core.print_out(
+                    "\n       N-Body: Computing complex (%d/%d) with fragments %s in the basis of fragments %s.\n\n" %
+                    (num + 1, total, str(pair[0]), str(pair[1])))
+                ghost = list(set(pair[1]) - set(pair[0]))
+
+                current_mol = molecule.extract_subsets(list(pair[0]), ghost)
+                current_mol.set_name("%s_%i_%i" % (current_mol.name(), count, num))
+                if metadata['embedding_charges']: driver_nbody_helper.electrostatic_embedding(metadata, pair=pair)
+                # Save energies info
+                ptype_dict[pair], wfn = func(method_string, molecule=current_mol, return_wfn=True, **kwargs)
+                core.set_global_option_python('EXTERN', None)
+                energies_dict[pair] = core.variable("CURRENT ENERGY")
+                gradients_dict[pair] = wfn.gradient()
+                var_key = "N-BODY (%s)@(%s) TOTAL ENERGY" % (', '.join([str(i) for i in pair[0]]), ', '.join(
+                    [str(i) for i in pair[1]]))
+                intermediates_dict[var_key] = core.variable("CURRENT ENERGY")
+                core.print_out("\n       N-Body: Complex Energy (fragments = %s, basis = %s: %20.14f)\n" % (str(
+                    pair[0]), str(pair[1]), energies_dict[pair]))
+                # Flip this off for now, needs more testing
+                #if 'cp' in bsse_type_list and (len(bsse_type_list) == 1):
+                #    core.set_global_option('DF_INTS_IO', 'LOAD')
+
+                core.clean()
 
     return {
         'energies': energies_dict,
@@ -26,6 +26,7 @@
 # @END LICENSE
 #
 
+import json
 import os
 import re
 import sys
@@ -104,6 +105,49 @@ def _pybuild_basis(mol,
 
 core.BasisSet.build = _pybuild_basis
 
+
+def compile_basis_library(paths=None, filename=None):
+    """Compile Gaussian94 basis set files into the binary basis set library
+    that :py:func:`psi4.core.BasisSet.build` maps and reads in place of
+    parsing the text files. Files changed after compilation are parsed as
+    before, so the library never needs to be removed, only recompiled.
+
+    Parameters
+    ----------
+    paths : list of str, optional
+        Directories (all their .gbs files) or individual .gbs files to
+        compile. Defaults to the basis set directory of the Psi4 library.
+    filename : str, optional
+        Library to write. Defaults to the location BasisSet.build reads.
+
+    Returns
+    -------
+    int
+        Number of atom entries compiled.
+
+    """
+    psidatadir = core.get_datadir()
+    if paths is None:
+        paths = [os.path.join(os.path.abspath(psidatadir), 'basis')]
+    if filename is None:
+        filename = qcdb.BasisSet.library_filename(psidatadir)
+
+    gbsfiles = []
+    for path in paths:
+        if os.path.isdir(path):
+            gbsfiles.extend(os.path.join(path, f) for f in sorted(os.listdir(path)) if f.endswith('.gbs'))
+        else:
+            gbsfiles.append(path)
+
+    parser = qcdb.libmintsbasissetparser.Gaussian94BasisSetParser()
+    entries = []
+    for gbs in gbsfiles:
+        entries.extend(parser.library_entries(gbs))
+
+    core.BasisSetLibrary.compile(filename, entries)
+    return len(entries)
+
+
 ## Python wavefunction helps
 
 
@@ -132,15 +176,56 @@ def _core_wavefunction_get_scratch_filename(self, filenumber):
 
 core.Wavefunction.get_scratch_filename = _core_wavefunction_get_scratch_filename
 
+def _checkpoint_wavefunction_data(chk, subset=None):
+    """Reads the Wavefunction.to_file dictionary back from a binary checkpoint,
+    with matrices, vectors and dimensions already as psi4 types. Only the
+    Matrix and Vector records named in *subset* are read, if given.
+
+    """
+    wfn_data = {k: {} for k in ['matrix', 'vector', 'dimension', 'int', 'string', 'boolean', 'float', 'floatvar',
+                                'matrixarr']}
+    for record in chk.names():
+        section, label = record.split('/', 1)
+        if section in ['matrix', 'vector', 'matrixarr'] and subset is not None and label not in subset:
+            continue
+
+        if section in ['matrix', 'matrixarr']:
+            value = chk.matrix(record)
+        elif section == 'vector':
+            value = chk.vector(record)
+        elif section == 'dimension':
+            value = chk.dimension(record)
+        elif section in ['int', 'boolean']:
+            value = chk.int_value(record)
+            if section == 'boolean':
+                value = bool(value)
+        elif section in ['float', 'floatvar']:
+            value = chk.double_value(record)
+        else:
+            value = chk.string_value(record)
+
+        if section in ['matrix', 'matrixarr', 'vector', 'dimension']:
+            value.name = label
+        wfn_data[section][label] = value
+
+    wfn_data['molecule'] = json.loads(wfn_data['string'].pop('molecule'))
+    return wfn_data
+
+
 @staticmethod
-def _core_wavefunction_from_file(wfn_data):
+def _core_wavefunction_from_file(wfn_data, subset=None):
     """Summary
 
     Parameters
     ----------
     wfn_data : str or dict
         If a str reads a Wavefunction from a disk otherwise, assumes the data
-        is passed in.
+        is passed in. A binary checkpoint (.wfn) written by `to_file` is
+        preferred over a NumPy (.npy) file when no extension is given.
+    subset : list of str, optional
+        Labels of the matrices, vectors and array variables to load from a
+        binary checkpoint, e.g. ``['Ca', 'Cb']`` for orbitals only; the
+        others are left unset. By default everything is loaded.
 
     Returns
     -------
@@ -151,9 +236,12 @@ def _core_wavefunction_from_file(wfn_data):
     if isinstance(wfn_data, dict):
         pass
     elif isinstance(wfn_data, str):
-        if not wfn_data.endswith(".npy"):
-            wfn_data = wfn_data + ".npy"
-        wfn_data = np.load(wfn_data, allow_pickle=True).item()
+        if not wfn_data.endswith((".wfn", ".npy")):
+            wfn_data = wfn_data + (".wfn" if os.path.isfile(wfn_data + ".wfn") else ".npy")
+        if core.CheckpointFile.is_checkpoint(wfn_data):
+            wfn_data = _checkpoint_wavefunction_data(core.CheckpointFile(wfn_data), subset)
+        else:
+            wfn_data = np.load(wfn_data, allow_pickle=True).item()
     else:
         # Could be path-like or file-like, let `np.load` handle it
         wfn_data = np.load(wfn_data, allow_pickle=True).item()
@@ -181,22 +269,27 @@ def _core_wavefunction_from_file(wfn_data):
     basis_puream = wfn_boolean['basispuream']
     basisset = core.BasisSet.build(molecule, 'ORBITAL', basis_name, puream=basis_puream)
 
-    # change some variables to psi4 specific data types (Matrix, Vector, Dimension)
+    # change some variables to psi4 specific data types (Matrix, Vector, Dimension);
+    # a binary checkpoint already provides them
     for label in wfn_matrix:
         array = wfn_matrix[label]
-        wfn_matrix[label] = core.Matrix.from_array(array, name=label) if array is not None else None
+        if isinstance(array, np.ndarray):
+            wfn_matrix[label] = core.Matrix.from_array(array, name=label)
 
     for label in wfn_vector:
         array = wfn_vector[label]
-        wfn_vector[label] = core.Vector.from_array(array, name=label) if array is not None else None
+        if isinstance(array, np.ndarray):
+            wfn_vector[label] = core.Vector.from_array(array, name=label)
 
     for label in wfn_dimension:
         tup = wfn_dimension[label]
-        wfn_dimension[label] = core.Dimension.from_list(tup, name=label) if tup is not None else None
+        if isinstance(tup, (tuple, list)):
+            wfn_dimension[label] = core.Dimension.from_list(tup, name=label)
 
     for label in wfn_matrixarr:
         array = wfn_matrixarr[label]
-        wfn_matrixarr[label] = core.Matrix.from_array(array, name=label) if array is not None else None
+        if isinstance(array, np.ndarray):
+            wfn_matrixarr[label] = core.Matrix.from_array(array, name=label)
 
     # make the wavefunction
     wfn = core.Wavefunction(molecule, basisset, wfn_matrix, wfn_vector, wfn_dimension, wfn_int, wfn_string,
@@ -222,12 +315,15 @@ def _core_wavefunction_to_file(wfn, filename=None):
     wfn : Wavefunction
         A Wavefunction or inherited class
     filename : None, optional
-        An optional filename to write the data to
+        An optional filename to write the data to. Unless it ends in
+        ``.npy``, a binary checkpoint is written from C++ to `filename`
+        with a ``.wfn`` extension, without going through NumPy.
 
     Returns
     -------
     dict
-        A dictionary and NumPy representation of the Wavefunction.
+        A dictionary and NumPy representation of the Wavefunction, or None
+        when a binary checkpoint was written.
 
     """
 
@@ -236,6 +332,11 @@ def _core_wavefunction_to_file(wfn, filename=None):
     if wfn.basisset().name().startswith("anonymous"):
         raise ValidationError("Cannot serialize wavefunction with custom basissets.")
 
+    if filename is not None and not filename.endswith('.npy'):
+        if not filename.endswith('.wfn'): filename += '.wfn'
+        wfn.write_checkpoint(filename, {'molecule': json.dumps(wfn.molecule().to_dict(np_out=False))})
+        return None
+
     wfn_data = {
         'molecule': wfn.molecule().to_dict(),
         'matrix': {
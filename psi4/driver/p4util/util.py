@@ -193,6 +193,57 @@ def get_memory():
     return core.get_memory()
 
 
+def benchmark_builders(molecules, basis="CC-PVDZ", jk_types=("PK", "DIRECT", "DISK_DF", "MEM_DF", "CD"),
+                       functional="B3LYP", max_threads=None, nbuild=3, filename=None):
+    """Thread-scaling benchmark of the JK builders and RV::compute_V.
+
+    Each molecule is run through :py:func:`~psi4.core.benchmark_jk` for every
+    algorithm in `jk_types` and through :py:func:`~psi4.core.benchmark_v`
+    (skipped if `functional` is None) at 1..`max_threads` threads.
+
+    :returns: list of dicts, one per (molecule, builder, thread count), with the
+        psi4 version and host name attached so runs can be compared across
+        versions and nodes. Written as JSON to `filename` if given.
+
+    :type molecules: dict
+    :param molecules: ``{name: Molecule}`` of the stock systems to run
+    :param basis: orbital basis, the JKFIT basis is used for fitting
+    :param max_threads: defaults to the current number of threads
+
+    """
+    import json
+    import platform
+
+    from psi4 import __version__
+    from psi4.driver.procrouting.dft import build_superfunctional
+
+    if max_threads is None:
+        max_threads = core.get_num_threads()
+
+    rows = []
+    for name, mol in molecules.items():
+        mol.update_geometry()
+        primary = core.BasisSet.build(mol, "ORBITAL", basis)
+        auxiliary = core.BasisSet.build(mol, "DF_BASIS_SCF", "", "JKFIT", basis, puream=primary.has_puream())
+
+        timings = list(core.benchmark_jk(primary, auxiliary, list(jk_types), max_threads, nbuild))
+        if functional is not None:
+            superfunc = build_superfunctional(functional, True)[0]
+            timings += list(core.benchmark_v(primary, superfunc, max_threads, nbuild))
+
+        for timing in timings:
+            row = timing.to_dict()
+            row.update({"molecule": name, "basis": basis, "nbf": primary.nbf(),
+                        "version": __version__, "host": platform.node()})
+            rows.append(row)
+
+    if filename is not None:
+        with open(filename, "w") as handle:
+            json.dump(rows, handle, indent=2)
+
+    return rows
+
+
 def copy_file_to_scratch(filename, prefix, namespace, unit, move=False):
     """Function to move file into scratch with correct naming
     convention.
@@ -54,6 +54,7 @@ from . import dft
 from . import mcscf
 from . import response
 from . import solvent
+from .scf_proc import geometry_guess
 
 
 # ATTN NEW ADDITIONS!
@@ -748,6 +749,9 @@ def select_ccsd(name, **kwargs):
     if kwargs.pop('probe', False):
         return
     else:
+        if func is run_ccenergy:
+            # plain energy: ccenergy never needs the sorted <ab|cd> for AO_BASIS DIRECT
+            kwargs['pure_energy'] = True
         return func(name, **kwargs)
 
 
@@ -856,6 +860,9 @@ def select_ccsd_t_(name, **kwargs):
     if kwargs.pop('probe', False):
         return
     else:
+        if func is run_ccenergy:
+            # plain energy: ccenergy never needs the sorted <ab|cd> for AO_BASIS DIRECT
+            kwargs['pure_energy'] = True
         return func(name, **kwargs)
 
 
@@ -1295,12 +1302,15 @@ def scf_helper(name, post_scf=True, **kwargs):
     scf_wfn = scf_wavefunction_factory(name, base_wfn, core.get_option('SCF', 'REFERENCE'), **kwargs)
     core.set_legacy_wavefunction(scf_wfn)
 
-    # The wfn from_file routine adds the npy suffix if needed, but we add it here so that
+    # The wfn from_file routine adds the suffix if needed, but we add it here so that
     # we can use os.path.isfile to query whether the file exists before attempting to read
-    read_filename = scf_wfn.get_scratch_filename(180) + '.npy'
+    read_filename = scf_wfn.get_scratch_filename(180) + '.wfn'
+    if not os.path.isfile(read_filename):
+        read_filename = scf_wfn.get_scratch_filename(180) + '.npy'
 
     if (core.get_option('SCF', 'GUESS') == 'READ') and os.path.isfile(read_filename):
-        old_wfn = core.Wavefunction.from_file(read_filename)
+        # Only the orbitals are needed for the guess
+        old_wfn = core.Wavefunction.from_file(read_filename, subset=['Ca', 'Cb'])
         Ca_occ = old_wfn.Ca_subset("SO", "OCC")
         Cb_occ = old_wfn.Cb_subset("SO", "OCC")
 
@@ -1343,6 +1353,13 @@ def scf_helper(name, post_scf=True, **kwargs):
                                                    return_atomlist=True)
             scf_wfn.set_sad_fitting_basissets(sad_fitting_list)
 
+    # Extrapolate orbitals from previous geometries, overriding the above guess
+    if not cast:
+        extrap_guess = geometry_guess.extrapolated_guess(scf_wfn)
+        if extrap_guess is not None:
+            scf_wfn.guess_Ca(extrap_guess[0])
+            scf_wfn.guess_Cb(extrap_guess[1])
+
 
     if cast:
         core.print_out("\n  Computing basis projection from %s to %s\n\n" % (ref_wfn.basisset().name(), base_wfn.basisset().name()))
@@ -1397,6 +1414,9 @@ def scf_helper(name, post_scf=True, **kwargs):
         for pv in ["SCF TOTAL ENERGY", "CURRENT ENERGY", "CURRENT REFERENCE ENERGY"]:
             obj.set_variable(pv, e_scf)
 
+    if core.get_option('SCF', 'GUESS_EXTRAP') != 'NONE':
+        geometry_guess.record(scf_wfn)
+
     # We always would like to print a little property information
     if kwargs.get('scf_do_properties', True):
         oeprop = core.OEProp(scf_wfn)
@@ -1440,7 +1460,7 @@ def scf_helper(name, post_scf=True, **kwargs):
         write_filename = scf_wfn.get_scratch_filename(180)
 
         scf_wfn.to_file(write_filename)
-        extras.register_numpy_file(write_filename)
+        extras.register_numpy_file(write_filename + '.wfn')
 
     if do_timer:
         core.tstop()
@@ -2351,8 +2371,13 @@ def run_ccenergy(name, **kwargs):
     optstash = p4util.OptionsState(
         ['TRANSQT2', 'WFN'],
         ['CCSORT', 'WFN'],
+        ['CCTRANSORT', 'DIRECT_VVVV'],
         ['CCENERGY', 'WFN'])
 
+    # Only a plain energy call may leave the <ab|cd> integrals out of the sort;
+    # gradients, properties and EOM read them in later modules.
+    core.set_local_option('CCTRANSORT', 'DIRECT_VVVV', kwargs.pop('pure_energy', False))
+
     if name == 'ccsd':
         core.set_local_option('TRANSQT2', 'WFN', 'CCSD')
         core.set_local_option('CCSORT', 'WFN', 'CCSD')
@@ -278,6 +278,94 @@ def _print_tdscf_header(**options):
     core.print_out("\n")
 
 
+def _solve_python(wfn, restricted, triplet, ptype, solve_function, states_per_irrep, e_tol, r_tol, max_ss_vec,
+                  verbose):
+    """Solve for the excitations with the Python solvers, one state symmetry at a time"""
+    # construct the engine
+    if restricted:
+        engine = TDRSCFEngine(wfn, triplet=triplet, ptype=ptype)
+    else:
+        engine = TDUSCFEngine(wfn, ptype=ptype)
+
+    # just energies for now
+    solver_results = []
+    for state_sym, nstates in enumerate(states_per_irrep):
+        if nstates == 0:
+            continue
+        engine.reset_for_state_symm(state_sym)
+        guess_ = engine.generate_guess(nstates * 2)
+
+        vecs_per_root = max_ss_vec // nstates
+
+        # ret = (ee, rvecs, stats) (TDA)
+        # ret = (ee, rvecs, lvecs, stats) (full TDSCF)
+        ret = solve_function(
+            engine=engine,
+            e_tol=e_tol,
+            r_tol=r_tol,
+            max_vecs_per_root=vecs_per_root,
+            nroot=nstates,
+            guess=guess_,
+            verbose=verbose)
+
+        # store excitation energies tagged with final state symmetry (for printing)
+        # TODO: handle R eigvecs (TDA) R/L eigvecs(full TDSCF): solver maybe should return dicts
+        for ee in ret[0]:
+            solver_results.append((ee, state_sym))
+
+    return solver_results, engine.G_gs
+
+
+def _solve_tda_native(wfn, triplet, states_per_irrep, e_tol, r_tol, max_ss_vec, verbose):
+    """Solve for restricted TDA excitations with the C++ block-Davidson solver.
+
+    Every iteration contracts all trial vectors in a single JK (and Vx) pass.
+    """
+    if wfn.jk() is None:
+        raise ValidationError("TDSCF: The native TDA solver needs the SCF JK object, please set SAVE_JK to True.")
+
+    Co = wfn.Ca_subset("SO", "OCC")
+    Cv = wfn.Ca_subset("SO", "VIR")
+    H = core.TDARHamiltonian(wfn.jk(), wfn.V_potential(), Co, Co, Cv, wfn.epsilon_a_subset("SO", "OCC"),
+                             wfn.epsilon_a_subset("SO", "VIR"))
+    H.set_singlet(not triplet)
+
+    nocc = Co.colspi()
+    nvir = Cv.colspi()
+
+    solver_results = []
+    for state_sym, nstates in enumerate(states_per_irrep):
+        nov = sum(nocc[h] * nvir[h ^ state_sym] for h in range(wfn.nirrep()))
+        nroot = min(nstates, nov)
+        if nroot == 0:
+            continue
+
+        H.set_symmetry(state_sym)
+        solver = core.DLRSolver(H)
+        solver.set_print(verbose + 1)
+        solver.set_nroot(nroot)
+        solver.set_nguess(min(2 * nroot, nov))
+        solver.set_max_subspace(max(max_ss_vec, 3 * nroot))
+        solver.set_min_subspace(2 * nroot)
+        solver.set_convergence(r_tol)
+        solver.set_energy_convergence(e_tol)
+        solver.set_precondition("JACOBI")
+
+        solver.initialize()
+        if verbose > 0:
+            solver.print_header()
+        solver.solve()
+        if not solver.converged():
+            core.print_out("    Warning: TDA solver did not converge for state symmetry {}.\n".format(state_sym))
+
+        E = solver.eigenvalues()
+        for k in range(nroot):
+            solver_results.append((E[k][state_sym], state_sym))
+        solver.finalize()
+
+    return solver_results
+
+
 def tdscf_excitations(wfn, **kwargs):
     """Compute excitations from a scf(HF/KS) wavefunction:
 
@@ -305,6 +393,10 @@ def tdscf_excitations(wfn, **kwargs):
     guess : str
        If string the guess that will be used. Allowed choices:
        - ``denominators``: {default} uses orbital energy differences to generate guess vectors.
+    native_solver : bool {optional ``True``}
+       For restricted references with ``tda``, use the C++ block-Davidson solver (:py:class:`psi4.core.DLRSolver`)
+       which builds all trial-vector products of an iteration in a single JK and Vx pass. The Python solver is
+       always used for RPA and unrestricted references.
 
 
     ..note:: The algorithm employed to solve the non-Hermitian eigenvalue problem
@@ -340,6 +432,8 @@ def tdscf_excitations(wfn, **kwargs):
     else:
         triplet = None
 
+    native = kwargs.pop('native_solver', True) and restricted and (ptype == 'tda')
+
     _print_tdscf_header(
         etol=e_tol,
         rtol=r_tol,
@@ -348,39 +442,15 @@ def tdscf_excitations(wfn, **kwargs):
         guess_type=guess_type,
         restricted=restricted,
         triplet=triplet,
-        ptype=ptype)
+        ptype=ptype,
+        native=native)
 
-    # construct the engine
-    if restricted:
-        engine = TDRSCFEngine(wfn, triplet=triplet, ptype=ptype)
+    if native:
+        solver_results = _solve_tda_native(wfn, triplet, states_per_irrep, e_tol, r_tol, max_ss_vec, verbose)
+        G_gs = 0
     else:
-        engine = TDUSCFEngine(wfn, ptype=ptype)
-
-    # just energies for now
-    solver_results = []
-    for state_sym, nstates in enumerate(states_per_irrep):
-        if nstates == 0:
-            continue
-        engine.reset_for_state_symm(state_sym)
-        guess_ = engine.generate_guess(nstates * 2)
-
-        vecs_per_root = max_ss_vec // nstates
-
-        # ret = (ee, rvecs, stats) (TDA)
-        # ret = (ee, rvecs, lvecs, stats) (full TDSCF)
-        ret = solve_function(
-            engine=engine,
-            e_tol=e_tol,
-            r_tol=r_tol,
-            max_vecs_per_root=vecs_per_root,
-            nroot=nstates,
-            guess=guess_,
-            verbose=verbose)
-
-        # store excitation energies tagged with final state symmetry (for printing)
-        # TODO: handle R eigvecs (TDA) R/L eigvecs(full TDSCF): solver maybe should return dicts
-        for ee in ret[0]:
-            solver_results.append((ee, state_sym))
+        solver_results, G_gs = _solve_python(wfn, restricted, triplet, ptype, solve_function, states_per_irrep,
+                                             e_tol, r_tol, max_ss_vec, verbose)
 
     # sort by energy symmetry is just meta data
     solver_results.sort(key=lambda x: x[0])
@@ -392,10 +462,10 @@ def tdscf_excitations(wfn, **kwargs):
                                                                     "(au)"))
     core.print_out("    {:->4} {:->20} {:->15} {:->15} {:->15}\n".format("-", "-", "-", "-", "-"))
 
-    irrep_GS = wfn.molecule().irrep_labels()[engine.G_gs]
+    irrep_GS = wfn.molecule().irrep_labels()[G_gs]
     for i, (E_ex_au, final_sym) in enumerate(solver_results):
         irrep_ES = wfn.molecule().irrep_labels()[final_sym]
-        irrep_trans = wfn.molecule().irrep_labels()[engine.G_gs ^ final_sym]
+        irrep_trans = wfn.molecule().irrep_labels()[G_gs ^ final_sym]
         sym_descr = "{}->{} ({})".format(irrep_GS, irrep_ES, irrep_trans)
 
         #TODO: psivars/wfnvars
@@ -0,0 +1,238 @@
+#
+# @BEGIN LICENSE
+#
+# Psi4: an open-source quantum chemistry software package
+#
+# Copyright (c) 2007-2019 The Psi4 Developers.
+#
+# The copyrights for code used from other parties are included in
+# the corresponding files.
+#
+# This file is part of Psi4.
+#
+# Psi4 is free software; you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, version 3.
+#
+# Psi4 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License along
+# with Psi4; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+#
+# @END LICENSE
+#
+
+"""
+SCF guesses at a new geometry formed from the converged orbitals of previous
+geometries of the same system, for finite-difference displacements and
+optimization steps (|scf__guess_extrap|).
+
+The occupied orbitals of each geometry are kept in the AO basis, so that a
+point group change between geometries (e.g., a displacement lowering the
+symmetry) does not matter. The guess density is extrapolated, orthonormalized
+against the overlap matrix at the new geometry and symmetry-adapted back to
+the SO basis of the new wavefunction.
+"""
+
+from math import factorial
+
+import numpy as np
+
+from psi4 import core
+
+# References for which the alpha and beta occupied spaces are extrapolated independently
+_SUPPORTED_REFERENCES = ["RHF", "UHF", "RKS", "UKS"]
+
+# Geometries in which any atom moved further than this [a0] are not used
+_MAX_DISPLACEMENT = 0.5
+
+# Converged orbitals of previous geometries, oldest first
+_history = []
+
+
+def aspc_coefficients(npoint):
+    """Coefficients of the always-stable predictor-corrector (ASPC)
+    extrapolation from the last *npoint* geometries, most recent first
+    [Kolafa, J. Comput. Chem. 25, 335 (2004)]. They sum to one.
+
+    """
+    if npoint < 2:
+        return np.ones(1)
+
+    k = npoint - 2
+
+    def binomial(n, m):
+        return 0.0 if m < 0 else float(factorial(n) // (factorial(m) * factorial(n - m)))
+
+    return np.array([(-1)**(j + 1) * j * binomial(2 * k + 4, k + 2 - j) / binomial(2 * k + 2, k + 1)
+                     for j in range(1, npoint + 1)])
+
+
+def _system_key(wfn):
+    mol = wfn.molecule()
+    basis = wfn.basisset()
+    return (tuple(mol.Z(i) for i in range(mol.natom())), basis.name(), basis.nbf(), basis.has_puream(),
+            wfn.nalpha(), wfn.nbeta(), wfn.name())
+
+
+def _occupied_ao(C, nocc, nbf):
+    if nocc == 0:
+        return np.zeros((nbf, 0))
+    return np.array(C.to_array(dense=True))
+
+
+def clear():
+    """Forgets all previous geometries."""
+    del _history[:]
+
+
+def record(wfn):
+    """Stores the converged occupied orbitals of *wfn* for the guesses at later geometries."""
+
+    if wfn.name() not in _SUPPORTED_REFERENCES:
+        return
+
+    key = _system_key(wfn)
+    if _history and _history[-1]["key"] != key:
+        clear()
+
+    nbf = wfn.basisset().nbf()
+    geometry = np.array(wfn.molecule().geometry())
+    _history.append({
+        "key": key,
+        "geometry": geometry,
+        "Ca": _occupied_ao(wfn.Ca_subset("AO", "OCC"), wfn.nalpha(), nbf),
+        "Cb": _occupied_ao(wfn.Cb_subset("AO", "OCC"), wfn.nbeta(), nbf),
+    })
+
+    # Drop the geometries furthest from the latest one rather than the oldest, so that the
+    # reference point of a finite-difference run survives its displacements
+    nkeep = max(1, core.get_option("SCF", "GUESS_EXTRAP_HISTORY"))
+    while len(_history) > nkeep:
+        distances = [np.linalg.norm(entry["geometry"] - geometry) for entry in _history[:-1]]
+        del _history[int(np.argmax(distances))]
+
+
+def _extrapolate_occupied(coefficients, orbitals, S):
+    """Extrapolates the occupied space spanned by *orbitals* (most recent
+    first) as sum_j b_j D_j S C_1, then orthonormalizes it against the new
+    AO overlap *S*. Returns None if the result is (nearly) singular.
+
+    """
+    C_last = orbitals[0]
+    if C_last.shape[1] == 0:
+        return C_last
+
+    SC = np.dot(S, C_last)
+    C = sum(b * np.dot(Cj, np.dot(Cj.T, SC)) for b, Cj in zip(coefficients, orbitals))
+
+    # Loewdin orthonormalization, C (C^T S C)^-1/2
+    evals, evecs = np.linalg.eigh(np.dot(C.T, np.dot(S, C)))
+    if evals.min() < 1.e-8:
+        return None
+    return np.dot(C, np.dot(evecs * evals**-0.5, evecs.T))
+
+
+def _symmetry_adapt(C, S, U, name):
+    """Returns the occupied orbitals spanning the AO density C C^T as a
+    Matrix in the SO basis of the AO to SO transformer *U*, with the
+    occupations per irrep determined by the natural occupation numbers.
+    Returns None if the density does not have the symmetry of *U*.
+
+    """
+    nocc = C.shape[1]
+    nsopi = [Uh.shape[1] for Uh in U]
+
+    # chi_SO = chi_AO U, so the SO density is W D W^T with W = U^-1
+    D = np.dot(C, C.T)
+    W = np.linalg.inv(np.hstack(U))
+
+    offset = 0
+    candidates = []
+    blocks = []
+    for h, nso in enumerate(nsopi):
+        if nso == 0:
+            blocks.append(None)
+            continue
+        Wh = W[offset:offset + nso]
+        offset += nso
+        Dh = np.dot(Wh, np.dot(D, Wh.T))
+        Sh = np.dot(U[h].T, np.dot(S, U[h]))
+
+        # Natural orbitals: S^1/2 D S^1/2 v = n v, C = S^-1/2 v
+        s, V = np.linalg.eigh(Sh)
+        Shalf = np.dot(V * np.sqrt(s), V.T)
+        Sinvhalf = np.dot(V / np.sqrt(s), V.T)
+        n, v = np.linalg.eigh(np.dot(Shalf, np.dot(Dh, Shalf)))
+        Ch = np.dot(Sinvhalf, v)
+        blocks.append(Ch)
+        candidates.extend((n[i], h, i) for i in range(nso))
+
+    candidates.sort(key=lambda c: -c[0])
+    selected = candidates[:nocc]
+    if nocc and selected[-1][0] < 0.5:
+        return None
+
+    noccpi = [0] * len(nsopi)
+    for occ, h, i in selected:
+        noccpi[h] += 1
+
+    Cocc = core.Matrix(name, core.Dimension(nsopi), core.Dimension(noccpi))
+    for h, Ch in enumerate(blocks):
+        if Ch is None or noccpi[h] == 0:
+            continue
+        columns = [i for occ, hh, i in selected if hh == h]
+        Cocc.nph[h][:] = Ch[:, columns]
+    return Cocc
+
+
+def extrapolated_guess(wfn):
+    """Forms guess occupied orbitals for *wfn* from the stored previous
+    geometries according to |scf__guess_extrap|.
+
+    Returns
+    -------
+    tuple of Matrix
+        The alpha and beta occupied orbitals in the SO basis, or None if
+        no usable previous geometry is stored.
+
+    """
+    mode = core.get_option("SCF", "GUESS_EXTRAP")
+    if mode == "NONE" or wfn.name() not in _SUPPORTED_REFERENCES:
+        return None
+
+    key = _system_key(wfn)
+    geometry = np.array(wfn.molecule().geometry())
+    entries = [
+        entry for entry in _history if entry["key"] == key
+        and np.max(np.linalg.norm(entry["geometry"] - geometry, axis=1)) < _MAX_DISPLACEMENT
+    ]
+    if not entries:
+        return None
+
+    if mode == "PROJECT" or len(entries) == 1:
+        entries = [min(entries, key=lambda entry: np.linalg.norm(entry["geometry"] - geometry))]
+    else:
+        entries = entries[::-1]
+    coefficients = aspc_coefficients(len(entries))
+
+    S = np.array(core.MintsHelper(wfn.basisset()).ao_overlap())
+    U = [np.array(Uh) for Uh in wfn.aotoso().nph]
+
+    guess = []
+    for spin in ["Ca", "Cb"]:
+        C = _extrapolate_occupied(coefficients, [entry[spin] for entry in entries], S)
+        if C is None:
+            return None
+        Cocc = _symmetry_adapt(C, S, U, spin + " guess")
+        if Cocc is None:
+            return None
+        guess.append(Cocc)
+
+    core.print_out("  Extrapolating orbitals from %d previous geometr%s (%s).\n\n" %
+                   (len(entries), "y" if len(entries) == 1 else "ies", mode))
+    return tuple(guess)
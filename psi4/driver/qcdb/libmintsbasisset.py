@@ -125,6 +125,10 @@ class BasisSet(object):
         self.xyz = None
         # label/basis to number of core electrons mapping for ECPs
         self.ecp_coreinfo = None
+        # Compiled basis set library and, per atom, the (gbs file, entry) whose
+        # shells were taken from it unmodified
+        self.library = None
+        self.library_refs = {}
 
         # Divert to constructor functions
         if len(args) == 0:
@@ -711,6 +715,8 @@ class BasisSet(object):
             bsdict['blend'] = bs.name.upper()
             bsdict['puream'] = int(bs.has_puream())
             bsdict['shell_map'] = bs.export_for_libmints('BASIS' if fitrole == 'ORBITAL' else fitrole)
+            if bs.library_refs:
+                bsdict['library'] = bs.library
             if ecp:
                 bsdict['ecp_shell_map'] = ecp.export_for_libmints('BASIS')
             return bs, bsdict
@@ -746,9 +752,12 @@ class BasisSet(object):
             from psi4 import core
         except ImportError:
             libraryPath = ''
+            basislib = None
         else:
             psidatadir = core.get_datadir()
             libraryPath = os.pathsep + os.path.join(os.path.abspath(psidatadir), 'basis')
+            # Precompiled binary library of the gbs files, if one has been built
+            basislib = core.BasisSetLibrary.shared_library(cls.library_filename(psidatadir))
         #nolongerenvvar psidatadir = os.environ.get('PSIDATADIR', None)
         #nolongerpredicatble psidatadir = __file__ + '/../../..' if psidatadir is None else psidatadir
 
@@ -775,6 +784,7 @@ class BasisSet(object):
         names = {}
         summary = []
         bastitles = []
+        library_refs = {}
 
         for at in range(mol.natom()):
             symbol = mol.atom_entry(at).symbol()  # O, He
@@ -836,6 +846,7 @@ class BasisSet(object):
                 (bastitle, basgbs, postfunc) = bas
 
                 filename = cls.make_filename(basgbs)
+                libsource = None
                 # -- First seek bas string in input file strings
                 if filename[:-4] in seek['strings']:
                     index = 'inputblock %s' % (filename[:-4])
@@ -848,17 +859,24 @@ class BasisSet(object):
                     if fullfilename is None:
                         # -- Else skip to next bas
                         continue
-                    # Store contents so not reloading files
                     index = 'file %s' % (fullfilename)
-                    if index not in names:
+                    # -- Prefer the compiled library over parsing the file
+                    if basislib is not None and basislib.current(fullfilename):
+                        libsource = fullfilename
+                    # Store contents so not reloading files
+                    elif index not in names:
                         names[index] = parser.load_file(fullfilename)
 
-                lines = names[index]
-
                 for entry in seek['entry']:
 
-                    # Seek entry in lines, else skip to next entry
-                    shells, msg, ecp_shells, ecp_msg, ecp_ncore = parser.parse(entry, lines)
+                    # Seek entry in library or lines, else skip to next entry
+                    if libsource:
+                        record = basislib.lookup(libsource, entry)
+                        if record is None:
+                            continue
+                        shells, msg, ecp_shells, ecp_msg, ecp_ncore = parser.from_library(record)
+                    else:
+                        shells, msg, ecp_shells, ecp_msg, ecp_ncore = parser.parse(entry, names[index])
                     if shells is None:
                         continue
 
@@ -869,6 +887,8 @@ class BasisSet(object):
                         fmsg = 'func {}'.format(postfunc.__name__)
                     else:
                         fmsg = ''
+                        if libsource:
+                            library_refs[at] = (libsource, entry)
                     # -- Assign to Molecule
                     atom_basis_shell[label][bastitle] = shells
                     ecp_atom_basis_shell[label][bastitle] = ecp_shells
@@ -898,6 +918,9 @@ class BasisSet(object):
 
         # Construct the grand BasisSet for mol
         basisset = BasisSet(key, mol, atom_basis_shell)
+        if library_refs:
+            basisset.library = basislib.filename()
+            basisset.library_refs = library_refs
 
         # If an ECP was detected, and we're building BASIS, process it now
         ecpbasisset = None
@@ -1244,6 +1267,11 @@ class BasisSet(object):
 
             atominfo = [label]
             atominfo.append(self.molecule.atoms[A].shell(key=role))
+            if A in self.library_refs:
+                # libmints reads these shells straight from the compiled library
+                atominfo.extend(self.library_refs[A])
+                info.append(atominfo)
+                continue
             if self.ecp_coreinfo:
                 # If core information is present, this is an ECP so we add the
                 # number of electrons this atom's ECP basis accounts for here.
@@ -1382,6 +1410,14 @@ class BasisSet(object):
         """
         raise FeatureNotImplemented('BasisSet::refresh')
 
+    @staticmethod
+    def library_filename(psidatadir):
+        """Location of the compiled binary basis set library for the gbs
+        files of the Psi4 data directory *psidatadir*.
+
+        """
+        return os.path.join(os.path.abspath(psidatadir), 'basis', 'basislib.bin')
+
     @staticmethod
     def make_filename(name):
         """Converts basis set name to a compatible filename.
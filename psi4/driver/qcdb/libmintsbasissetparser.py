@@ -324,3 +324,64 @@ class Gaussian94BasisSetParser(object):
             return None, None, None, None, None
 
         return shell_list, msg, ecp_shell_list, ecp_msg, ncore
+
+    def library_entries(self, filename):
+        """Parse every entry of the gbs file *filename* into the records
+        compiled into a binary basis set library by BasisSetLibrary.compile.
+
+        """
+        lines = self.load_file(filename)
+        atom_array = re.compile(r'^\s*((([A-Z]{1,3}\d*)|([A-Z]{1,3}_\w+))\s+)+0\s*$', re.IGNORECASE)
+
+        symbols = []
+        for line in lines:
+            if atom_array.match(line):
+                for what in line.split()[:-1]:
+                    if what.upper() not in symbols:
+                        symbols.append(what.upper())
+
+        entries = []
+        for symbol in symbols:
+            shells, msg, ecp_shells, ecp_msg, ncore = self.parse(symbol, lines)
+            if shells is None:
+                continue
+            shell0 = shells[0] if shells else (ecp_shells[0] if ecp_shells else None)
+            entries.append({'source': os.path.abspath(filename),
+                            'symbol': symbol,
+                            'puream': 0 if (shell0 is not None and shell0.puream == 'Cartesian') else 1,
+                            'line': int(msg.split()[-1]),
+                            'ecp_line': int(ecp_msg.split()[-1]) if ecp_msg else 0,
+                            'ncore': ncore,
+                            'shells': [sh.aslist() for sh in shells],
+                            'ecp_shells': [sh.aslist() for sh in ecp_shells]})
+        return entries
+
+    def from_library(self, record):
+        """Turn an entry looked up in a binary basis set library into the
+        return of parse, so library and text file are interchangeable.
+
+        """
+        if self.force_puream_or_cartesian:
+            gaussian_type = 'Pure' if self.forced_is_puream else 'Cartesian'
+        else:
+            gaussian_type = 'Pure' if record['puream'] else 'Cartesian'
+        center = [0.0, 0.0, 0.0]
+
+        shell_list = []
+        for shell in record['shells']:
+            exponents = [prim[0] for prim in shell[1:]]
+            contractions = [prim[1] for prim in shell[1:]]
+            shell_list.append(ShellInfo(shell[0], contractions, exponents,
+                gaussian_type, 0, center, 0, 'Unnormalized'))
+
+        ecp_shell_list = []
+        for shell in record['ecp_shells']:
+            exponents = [prim[0] for prim in shell[1:]]
+            contractions = [prim[1] for prim in shell[1:]]
+            rpowers = [prim[2] for prim in shell[1:]]
+            ecp_shell_list.append(ShellInfo(shell[0], contractions, exponents,
+                gaussian_type, 0, center, 0, 'Normalized', rpowers))
+
+        msg = """line %5d""" % (record['line'])
+        ecp_msg = """line %5d""" % (record['ecp_line']) if record['ecp_line'] else None
+        return shell_list, msg, ecp_shell_list, ecp_msg, record['ncore']
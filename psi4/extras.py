@@ -40,7 +40,7 @@ numpy_files = []
 
 
 def register_numpy_file(filename):
-    if not filename.endswith('.npy'): filename += '.npy'
+    if not filename.endswith(('.npy', '.wfn')): filename += '.npy'
     if filename not in numpy_files:
         numpy_files.append(filename)
 
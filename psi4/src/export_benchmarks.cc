@@ -27,9 +27,12 @@
  */
 
 #include "psi4/libmints/benchmark.h"
+#include "psi4/libmints/basisset.h"
+#include "psi4/libfunctional/superfunctional.h"
 #include "psi4/pybind11.h"
 
 namespace py = pybind11;
+using namespace pybind11::literals;
 
 void export_benchmarks(py::module& m) {
     m.def("benchmark_blas1", &psi::benchmark_blas1, "docstring");
@@ -38,4 +41,35 @@ void export_benchmarks(py::module& m) {
     m.def("benchmark_disk", &psi::benchmark_disk, "docstring");
     m.def("benchmark_math", &psi::benchmark_math, "docstring");
     m.def("benchmark_integrals", &psi::benchmark_integrals, "docstring");
+
+    py::class_<psi::BuilderTiming>(m, "BuilderTiming", "One thread count of a JK or V build benchmark")
+        .def_readonly("builder", &psi::BuilderTiming::builder, "JK algorithm or RV")
+        .def_readonly("nthread", &psi::BuilderTiming::nthread, "Number of threads")
+        .def_readonly("nbuild", &psi::BuilderTiming::nbuild, "Number of timed builds")
+        .def_readonly("init_time", &psi::BuilderTiming::init_time, "Construction and initialization time [s]")
+        .def_readonly("time", &psi::BuilderTiming::time, "Time per build [s]")
+        .def_readonly("throughput", &psi::BuilderTiming::throughput, "Work per second, see units")
+        .def_readonly("units", &psi::BuilderTiming::units, "Unit of throughput")
+        .def_readonly("max_rss", &psi::BuilderTiming::max_rss, "Peak memory of the builder [MiB]")
+        .def_readonly("efficiency", &psi::BuilderTiming::efficiency, "Parallel efficiency relative to one thread")
+        .def("to_dict",
+             [](const psi::BuilderTiming& row) {
+                 py::dict d;
+                 d["builder"] = row.builder;
+                 d["nthread"] = row.nthread;
+                 d["nbuild"] = row.nbuild;
+                 d["init_time"] = row.init_time;
+                 d["time"] = row.time;
+                 d["throughput"] = row.throughput;
+                 d["units"] = row.units;
+                 d["max_rss"] = row.max_rss;
+                 d["efficiency"] = row.efficiency;
+                 return d;
+             },
+             "Returns the measurement as a dict, e.g. for json.dump");
+
+    m.def("benchmark_jk", &psi::benchmark_jk, "primary"_a, "auxiliary"_a, "jk_types"_a, "max_threads"_a,
+          "nbuild"_a = 3, "Times JK builds of each algorithm at 1..max_threads threads");
+    m.def("benchmark_v", &psi::benchmark_v, "primary"_a, "functional"_a, "max_threads"_a, "nbuild"_a = 3,
+          "Times RV::compute_V at 1..max_threads threads");
 }
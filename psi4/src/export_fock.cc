@@ -30,6 +30,9 @@
 
 #include "psi4/libfock/jk.h"
 #include "psi4/libfock/soscf.h"
+#include "psi4/libfock/hamiltonian.h"
+#include "psi4/libfock/solver.h"
+#include "psi4/libfock/v.h"
 #include "psi4/lib3index/denominator.h"
 #include "psi4/lib3index/dftensor.h"
 #include "psi4/lib3index/dfhelper.h"
@@ -144,6 +147,47 @@ void export_fock(py::module &m) {
     py::class_<DFSOMCSCF, std::shared_ptr<DFSOMCSCF>, SOMCSCF>(m, "DFSOMCSCF", "docstring");
     py::class_<DiskSOMCSCF, std::shared_ptr<DiskSOMCSCF>, SOMCSCF>(m, "DiskSOMCSCF", "docstring");
 
+    // Response Hamiltonians and the block-Davidson solver
+    py::class_<RHamiltonian, std::shared_ptr<RHamiltonian>>(m, "RHamiltonian", "docstring")
+        .def("diagonal", &RHamiltonian::diagonal, "Returns the diagonal of the Hamiltonian.")
+        .def("set_print", &RHamiltonian::set_print, "Sets the print level.");
+
+    py::class_<TDARHamiltonian, std::shared_ptr<TDARHamiltonian>, RHamiltonian>(
+        m, "TDARHamiltonian", "Restricted TDA (CIS/TDDFT) Hamiltonian with batched JK and Vx products.")
+        .def(py::init<std::shared_ptr<JK>, std::shared_ptr<VBase>, SharedMatrix, SharedMatrix, SharedMatrix,
+                      std::shared_ptr<Vector>, std::shared_ptr<Vector>>(),
+             "jk"_a, "v"_a, "Cocc"_a, "Caocc"_a, "Cavir"_a, "eps_aocc"_a, "eps_avir"_a)
+        .def("set_singlet", &TDARHamiltonian::set_singlet, "Singlet (True) or triplet (False) excitations.")
+        .def("set_symmetry", &TDARHamiltonian::set_symmetry,
+             "Restricts the problem to one transition symmetry, -1 for all irreps.");
+
+    py::class_<DLRSolver, std::shared_ptr<DLRSolver>>(m, "DLRSolver", "Davidson-Liu block eigensolver.")
+        .def(py::init<std::shared_ptr<RHamiltonian>>())
+        .def_static("build_solver",
+                    [](std::shared_ptr<RHamiltonian> H) {
+                        return DLRSolver::build_solver(Process::environment.options, H);
+                    })
+        .def("print_header", &DLRSolver::print_header)
+        .def("initialize", &DLRSolver::initialize)
+        .def("solve", &DLRSolver::solve)
+        .def("finalize", &DLRSolver::finalize)
+        .def("converged", &DLRSolver::converged)
+        .def("iteration", &DLRSolver::iteration)
+        .def("eigenvalues", &DLRSolver::eigenvalues, "Eigenvalues, by root and transition irrep.")
+        .def("eigenvectors", &DLRSolver::eigenvectors, "Eigenvectors, by root.")
+        .def("set_print", &DLRSolver::set_print)
+        .def("set_debug", &DLRSolver::set_debug)
+        .def("set_maxiter", &DLRSolver::set_maxiter)
+        .def("set_convergence", &DLRSolver::set_convergence)
+        .def("set_precondition", &DLRSolver::set_precondition)
+        .def("set_nroot", &DLRSolver::set_nroot)
+        .def("set_nguess", &DLRSolver::set_nguess)
+        .def("set_max_subspace", &DLRSolver::set_max_subspace)
+        .def("set_min_subspace", &DLRSolver::set_min_subspace)
+        .def("set_norm", &DLRSolver::set_norm)
+        .def("set_energy_convergence", &DLRSolver::set_energy_convergence,
+             "Maximum eigenvalue change for a root to converge, in addition to the residual.");
+
     // DF Helper
     typedef SharedMatrix (DFHelper::*take_string)(std::string);
     typedef SharedMatrix (DFHelper::*tensor_access3)(std::string, std::vector<size_t>, std::vector<size_t>,
@@ -50,6 +50,7 @@
 #include "psi4/libmints/mintshelper.h"
 #include "psi4/libmints/multipolesymmetry.h"
 #include "psi4/libmints/eri.h"
+#include "psi4/libmints/fjt.h"
 #include "psi4/libmints/molecule.h"
 #include "psi4/libmints/3coverlap.h"
 #include "psi4/libmints/pseudospectral.h"
@@ -69,6 +70,7 @@
 #include "psi4/libmints/dipole.h"
 #include "psi4/libmints/overlap.h"
 #include "psi4/libmints/sieve.h"
+#include "psi4/libmints/basissetlibrary.h"
 
 #include <string>
 
@@ -102,6 +104,10 @@ std::shared_ptr<BasisSet> construct_basisset_from_pydict(const std::shared_ptr<M
 
     mol->set_basis_all_atoms(name, key);
 
+    // Shells taken unmodified from a compiled basis set library are passed as (gbs file, entry) references
+    std::shared_ptr<BasisSetLibrary> library;
+    if (pybs.contains("library")) library = BasisSetLibrary::shared_library(pybs["library"].cast<std::string>());
+
     // Map of GaussianShells: basis_atom_shell[basisname][atomlabel] = gaussian_shells
     typedef std::map<std::string, std::map<std::string, std::vector<ShellInfo>>> map_ssv;
     map_ssv basis_atom_shell;
@@ -113,20 +119,25 @@ std::shared_ptr<BasisSet> construct_basisset_from_pydict(const std::shared_ptr<M
         py::list atominfo = basisinfo[atom].cast<py::list>();
         std::string atomlabel = atominfo[0].cast<std::string>();
         std::string hash = atominfo[1].cast<std::string>();
-        for (int atomshells = 2; atomshells < py::len(atominfo); ++atomshells) {
-            // Each shell entry has p primitives that look like
-            // [ angmom, [ [ e1, c1 ], [ e2, c2 ], ...., [ ep, cp ] ] ]
-            py::list shellinfo = atominfo[atomshells].cast<py::list>();
-            int am = shellinfo[0].cast<int>();
-            std::vector<double> coefficients;
-            std::vector<double> exponents;
-            int nprim = (pybind11::len(shellinfo)) - 1;  // The leading entry is the angular momentum
-            for (int primitive = 1; primitive <= nprim; primitive++) {
-                py::list primitiveinfo = shellinfo[primitive].cast<py::list>();
-                exponents.push_back(primitiveinfo[0].cast<double>());
-                coefficients.push_back(primitiveinfo[1].cast<double>());
+        if (py::len(atominfo) == 4 && py::isinstance<py::str>(atominfo[2])) {
+            if (!library) throw PSIEXCEPTION("Basis set library referenced for " + atomlabel + " cannot be opened.");
+            vec_shellinfo = library->shells(atominfo[2].cast<std::string>(), atominfo[3].cast<std::string>(), shelltype);
+        } else {
+            for (int atomshells = 2; atomshells < py::len(atominfo); ++atomshells) {
+                // Each shell entry has p primitives that look like
+                // [ angmom, [ [ e1, c1 ], [ e2, c2 ], ...., [ ep, cp ] ] ]
+                py::list shellinfo = atominfo[atomshells].cast<py::list>();
+                int am = shellinfo[0].cast<int>();
+                std::vector<double> coefficients;
+                std::vector<double> exponents;
+                int nprim = (pybind11::len(shellinfo)) - 1;  // The leading entry is the angular momentum
+                for (int primitive = 1; primitive <= nprim; primitive++) {
+                    py::list primitiveinfo = shellinfo[primitive].cast<py::list>();
+                    exponents.push_back(primitiveinfo[0].cast<double>());
+                    coefficients.push_back(primitiveinfo[1].cast<double>());
+                }
+                vec_shellinfo.push_back(ShellInfo(am, coefficients, exponents, shelltype, Unnormalized));
             }
-            vec_shellinfo.push_back(ShellInfo(am, coefficients, exponents, shelltype, Unnormalized));
         }
         mol->set_shell_by_label(atomlabel, hash, key);
         basis_atom_shell[name][atomlabel] = vec_shellinfo;
@@ -196,6 +207,70 @@ std::shared_ptr<BasisSet> construct_basisset_from_pydict(const std::shared_ptr<M
     return basisset;
 }
 
+/** Converts between basis set library entries and their python form
+ *
+ * Shells use the layout of qcdb ShellInfo.aslist(): [am, (e1, c1), (e2, c2), ...],
+ * with the radial power appended to each primitive of an ECP shell.
+ **/
+py::dict basisset_library_entry_to_pydict(const BasisSetLibrary::Entry& entry) {
+    auto shells_to_list = [](const std::vector<BasisSetLibrary::Shell>& shells, bool ecp) {
+        py::list pyshells;
+        for (const auto& shell : shells) {
+            py::list pyshell;
+            pyshell.append(shell.am);
+            for (size_t p = 0; p < shell.exponents.size(); ++p) {
+                if (ecp)
+                    pyshell.append(py::make_tuple(shell.exponents[p], shell.coefficients[p], shell.rpowers[p]));
+                else
+                    pyshell.append(py::make_tuple(shell.exponents[p], shell.coefficients[p]));
+            }
+            pyshells.append(pyshell);
+        }
+        return pyshells;
+    };
+
+    py::dict pyentry;
+    pyentry["source"] = entry.source;
+    pyentry["symbol"] = entry.symbol;
+    pyentry["puream"] = entry.puream;
+    pyentry["line"] = entry.line;
+    pyentry["ecp_line"] = entry.ecp_line;
+    pyentry["ncore"] = entry.ncore;
+    pyentry["shells"] = shells_to_list(entry.shells, false);
+    pyentry["ecp_shells"] = shells_to_list(entry.ecp_shells, true);
+    return pyentry;
+}
+
+BasisSetLibrary::Entry basisset_library_entry_from_pydict(const py::dict& pyentry) {
+    auto list_to_shells = [](const py::list& pyshells, bool ecp) {
+        std::vector<BasisSetLibrary::Shell> shells;
+        for (auto item : pyshells) {
+            py::sequence pyshell = item.cast<py::sequence>();
+            BasisSetLibrary::Shell shell;
+            shell.am = pyshell[0].cast<int>();
+            for (size_t p = 1; p < py::len(pyshell); ++p) {
+                py::sequence primitive = pyshell[p].cast<py::sequence>();
+                shell.exponents.push_back(primitive[0].cast<double>());
+                shell.coefficients.push_back(primitive[1].cast<double>());
+                if (ecp) shell.rpowers.push_back(primitive[2].cast<int>());
+            }
+            shells.push_back(shell);
+        }
+        return shells;
+    };
+
+    BasisSetLibrary::Entry entry;
+    entry.source = pyentry["source"].cast<std::string>();
+    entry.symbol = pyentry["symbol"].cast<std::string>();
+    entry.puream = pyentry["puream"].cast<int>();
+    entry.line = pyentry["line"].cast<int>();
+    entry.ecp_line = pyentry["ecp_line"].cast<int>();
+    entry.ncore = pyentry["ncore"].cast<int>();
+    entry.shells = list_to_shells(pyentry["shells"].cast<py::list>(), false);
+    entry.ecp_shells = list_to_shells(pyentry["ecp_shells"].cast<py::list>(), true);
+    return entry;
+}
+
 bool _has_key(const py::dict& data, const std::string& key) {
     for (auto item : data) {
         if (std::string(py::str(item.first)) == key) return true;
@@ -808,17 +883,40 @@ void export_mints(py::module& m) {
     py::class_<AngularMomentumInt, std::shared_ptr<AngularMomentumInt>>(m, "AngularMomentumInt", pyOneBodyAOInt,
                                                                         "Computes angular momentum integrals");
 
+    m.def("tabulated_boys_function",
+          [](int J, const std::vector<double>& T) {
+              size_t n = T.size();
+              std::vector<double> buffer((J + 1) * n);
+              Tabulated_Fjt::batch_values(J, n, T.data(), buffer.data(), n);
+              std::vector<std::vector<double>> F(J + 1);
+              for (int j = 0; j <= J; ++j) F[j].assign(buffer.begin() + j * n, buffer.begin() + (j + 1) * n);
+              return F;
+          },
+          "Boys function F_j(T[k]), 0 <= j <= J, from the batched table of the potential integrals, as F[j][k]", "J"_a,
+          "T"_a);
+    m.def("reference_boys_function",
+          [](int J, double T) {
+              std::vector<double> F(J + 1);
+              Tabulated_Fjt::reference_values(J, T, F.data());
+              return F;
+          },
+          "Boys function F_j(T), 0 <= j <= J, from the series the table is built from", "J"_a, "T"_a);
+
     typedef size_t (TwoBodyAOInt::*compute_shell_ints)(int, int, int, int);
     py::class_<TwoBodyAOInt, std::shared_ptr<TwoBodyAOInt>> pyTwoBodyAOInt(m, "TwoBodyAOInt",
                                                                            "Two body integral base class");
     pyTwoBodyAOInt.def("compute_shell", compute_shell_ints(&TwoBodyAOInt::compute_shell),
                        "Compute ERIs between 4 shells");  // <-- Semicolon
 
-    py::class_<TwoElectronInt, std::shared_ptr<TwoElectronInt>>(m, "TwoElectronInt", pyTwoBodyAOInt,
-                                                                "Computes two-electron repulsion integrals")
-        .def("compute_shell", compute_shell_ints(&TwoBodyAOInt::compute_shell), "Compute ERIs between 4 shells");
+    py::class_<TwoElectronInt, std::shared_ptr<TwoElectronInt>> pyTwoElectronInt(
+        m, "TwoElectronInt", pyTwoBodyAOInt, "Computes two-electron repulsion integrals");
+    pyTwoElectronInt
+        .def("compute_shell", compute_shell_ints(&TwoBodyAOInt::compute_shell), "Compute ERIs between 4 shells")
+        .def("shares_shell_pairs", &TwoElectronInt::shares_shell_pairs,
+             "Whether both objects use the same shell pair data", "other"_a);
 
-    py::class_<ERI, std::shared_ptr<ERI>>(m, "ERI", pyTwoBodyAOInt, "Computes normal two electron reuplsion integrals");
+    py::class_<ERI, std::shared_ptr<ERI>>(m, "ERI", pyTwoElectronInt,
+                                          "Computes normal two electron reuplsion integrals");
     py::class_<F12, std::shared_ptr<F12>>(m, "F12", pyTwoBodyAOInt, "Computes F12 electron repulsion integrals");
     py::class_<F12G12, std::shared_ptr<F12G12>>(m, "F12G12", pyTwoBodyAOInt,
                                                 "Computes F12G12 electron repulsion integrals");
@@ -907,6 +1005,8 @@ void export_mints(py::module& m) {
              "Returns a OneBodyInt that computes the traceless AO quadrupole integral")
         .def("so_traceless_quadrupole", &IntegralFactory::so_traceless_quadrupole,
              "Returns a OneBodyInt that computes the traceless SO quadrupole integral")
+        .def("ao_operators", &IntegralFactory::ao_operators,
+             "Returns a OneBodyInt that computes several one-electron operators in one pass", "operators"_a)
         .def("electric_field", &IntegralFactory::electric_field,
              "Returns a OneBodyInt that computes the electric field")
         .def("electrostatic", &IntegralFactory::electrostatic,
@@ -988,6 +1088,12 @@ void export_mints(py::module& m) {
              "Vector AO traceless quadrupole integrals")
         .def("so_traceless_quadrupole", &MintsHelper::so_traceless_quadrupole,
              "Vector SO traceless quadrupole integrals")
+        .def("ao_operators", &MintsHelper::ao_operators,
+             "Vector AO integrals of several one-electron operators computed in one pass, one matrix per component",
+             "operators"_a, "origin"_a = std::vector<double>{0, 0, 0})
+        .def("so_operators", &MintsHelper::so_operators,
+             "Vector SO integrals of several one-electron operators computed in one pass, one matrix per component",
+             "operators"_a, "origin"_a = std::vector<double>{0, 0, 0})
         .def("ao_nabla", &MintsHelper::ao_nabla, "Vector AO nabla integrals")
         .def("so_nabla", &MintsHelper::so_nabla, "Vector SO nabla integrals")
         .def("ao_angular_momentum", &MintsHelper::ao_angular_momentum, "Vector AO angular momentum integrals")
@@ -1489,6 +1595,34 @@ void export_mints(py::module& m) {
         .def("max_nprimitive", &BasisSet::max_nprimitive, "The max number of primitives in a shell")
         .def_static("construct_from_pydict", &construct_basisset_from_pydict, "docstring");
 
+    py::class_<BasisSetLibrary, std::shared_ptr<BasisSetLibrary>>(
+        m, "BasisSetLibrary",
+        "Memory-mapped, precompiled binary library of Gaussian94 basis set files, read by BasisSet.build in place of "
+        "parsing the files")
+        .def(py::init<const std::string&>(), "Map a compiled library", "filename"_a)
+        .def_static("shared_library", &BasisSetLibrary::shared_library,
+                    "Open a compiled library once per process, returning None if it is absent or unreadable",
+                    "filename"_a)
+        .def_static("compile",
+                    [](const std::string& filename, const py::list& pyentries) {
+                        std::vector<BasisSetLibrary::Entry> entries;
+                        for (auto item : pyentries) entries.push_back(basisset_library_entry_from_pydict(item.cast<py::dict>()));
+                        BasisSetLibrary::compile(filename, entries);
+                    },
+                    "Write the library of a list of entry dictionaries to filename", "filename"_a, "entries"_a)
+        .def("filename", &BasisSetLibrary::filename, "Path of the mapped library")
+        .def("nsource", &BasisSetLibrary::nsource, "Number of gbs files in the library")
+        .def("nentry", &BasisSetLibrary::nentry, "Number of atom entries in the library")
+        .def("current", &BasisSetLibrary::current,
+             "Whether the gbs file at path is in the library and unchanged since it was compiled", "path"_a)
+        .def("lookup",
+             [](const BasisSetLibrary& library, const std::string& path, const std::string& symbol) -> py::object {
+                 BasisSetLibrary::Entry entry;
+                 if (!library.lookup(path, symbol, entry)) return py::none();
+                 return basisset_library_entry_to_pydict(entry);
+             },
+             "Entry dictionary for symbol in the gbs file at path, or None if absent or stale", "path"_a, "symbol"_a);
+
     py::class_<SOBasisSet, std::shared_ptr<SOBasisSet>>(
         m, "SOBasisSet",
         "An SOBasis object describes the transformation from an atomic orbital basis to a symmetry orbital basis.")
@@ -1513,6 +1647,9 @@ void export_mints(py::module& m) {
                                                       "Class containing orbital localization procedures")
         .def_static("build", localizer_with_type(&Localizer::build), "Build the localization scheme")
         .def("localize", &Localizer::localize, "Perform the localization procedure")
+        .def("set_convergence", &Localizer::set_convergence, "Set the relative convergence of the metric")
+        .def("set_maxiter", &Localizer::set_maxiter, "Set the maximum number of iterations")
+        .def("set_algorithm", &Localizer::set_algorithm, "Set the rotation algorithm (JACOBI, PARALLEL_JACOBI, NEWTON)")
         .def_property_readonly("L", py::cpp_function(&Localizer::L), "Localized orbital coefficients")
         .def_property_readonly("U", py::cpp_function(&Localizer::U), "Orbital rotation matrix")
         .def_property_readonly("converged", py::cpp_function(&Localizer::converged),
@@ -29,6 +29,7 @@
 #include <string>
 
 #include "psi4/pybind11.h"
+#include <pybind11/numpy.h>
 
 #include "psi4/libmints/basisset.h"
 #include "psi4/libmints/sobasis.h"
@@ -39,6 +40,7 @@
 #include "psi4/libmints/oeprop.h"
 #include "psi4/libmints/orbitalspace.h"
 #include "psi4/libmints/extern.h"
+#include "psi4/libmints/checkpoint.h"
 
 #include "psi4/libfock/jk.h"
 #include "psi4/libfock/soscf.h"
@@ -202,6 +204,9 @@ void export_wavefunction(py::module& m) {
              "Removes the requested (case-insensitive) Matrix QC variable.")
         .def("scalar_variables", &Wavefunction::scalar_variables, "Returns the dictionary of all double QC variables.")
         .def("array_variables", &Wavefunction::array_variables, "Returns the dictionary of all Matrix QC variables.")
+        .def("write_checkpoint", &Wavefunction::write_checkpoint, "filename"_a,
+             "strings"_a = std::map<std::string, std::string>(),
+             "Writes the Wavefunction to a binary checkpoint file, with optional additional string records.")
 
 #ifdef USING_PCMSolver
         .def("set_PCM", &Wavefunction::set_PCM, "Set the PCM object")
@@ -209,6 +214,33 @@ void export_wavefunction(py::module& m) {
 #endif
         .def("PCM_enabled", &Wavefunction::PCM_enabled, "Whether running a PCM calculation");
 
+    py::class_<CheckpointFile, std::shared_ptr<CheckpointFile>>(
+        m, "CheckpointFile", "Read-only, memory-mapped binary Wavefunction checkpoint; records are loaded on request")
+        .def(py::init<const std::string&>(), "Map a checkpoint file", "filename"_a)
+        .def_static("is_checkpoint", &CheckpointFile::is_checkpoint,
+                    "Whether filename starts with the checkpoint signature", "filename"_a)
+        .def("filename", &CheckpointFile::filename, "Path of the mapped file")
+        .def("names", &CheckpointFile::names, "Names of all records")
+        .def("contains", &CheckpointFile::contains, "Whether a record is present", "name"_a)
+        .def("matrix", &CheckpointFile::matrix, "Copy of a Matrix record, or None if absent", "name"_a)
+        .def("vector", &CheckpointFile::vector, "Copy of a Vector record, or None if absent", "name"_a)
+        .def("dimension", &CheckpointFile::dimension, "Dimension record, empty if absent", "name"_a)
+        .def("int_value", &CheckpointFile::int_value, "Integer record", "name"_a)
+        .def("double_value", &CheckpointFile::double_value, "Float record", "name"_a)
+        .def("string_value", &CheckpointFile::string_value, "String record", "name"_a)
+        .def("array",
+             [](std::shared_ptr<CheckpointFile> chk, const std::string& name, int h) {
+                 size_t rows, cols;
+                 const double* data = chk->block(name, h, rows, cols);
+                 // The CheckpointFile is the base object, so the mapping lives as long as the view
+                 std::vector<size_t> shape{rows, cols};
+                 py::array array(shape, data, py::cast(chk));
+                 array.attr("setflags")("write"_a = false);
+                 return array;
+             },
+             "Read-only NumPy view, without copying, of irrep block h of a Matrix or Vector record", "name"_a,
+             "h"_a = 0);
+
     py::class_<scf::HF, std::shared_ptr<scf::HF>, Wavefunction>(m, "HF", "docstring")
         .def("form_C", &scf::HF::form_C, "Forms the Orbital Matrices from the current Fock Matrices.")
         .def("form_initial_C", &scf::HF::form_initial_C,
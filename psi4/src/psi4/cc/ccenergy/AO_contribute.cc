@@ -36,6 +36,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
+#include <vector>
 #include "psi4/libciomr/libciomr.h"
 #include "psi4/libiwl/iwl.h"
 #include "psi4/libqt/qt.h"
@@ -48,13 +49,13 @@ namespace ccenergy {
 int CCEnergyWavefunction::AO_contribute(struct iwlbuf *InBuf, dpdbuf4 *tau1_AO, dpdbuf4 *tau2_AO) {
     int p, q, r, s;
     double value = 0.0;
-    int Gp, Gq, Gr, Gs, Gpr, Gps, Gqr, Gqs, Grp, Gsp, Grq, Gsq;
-    int pr, ps, qr, qs, rp, rq, sp, sq, pq, rs;
     int count = 0;
 
     auto lblptr = InBuf->labels;
     auto valptr = InBuf->values;
 
+    std::vector<int> col_start(tau1_AO->params->nirreps, 0);
+
     for (int idx = 4 * InBuf->idx; InBuf->idx < InBuf->inbuf; InBuf->idx++) {
         p = std::abs((int)lblptr[idx++]);
         q = (int)lblptr[idx++];
@@ -64,113 +65,93 @@ int CCEnergyWavefunction::AO_contribute(struct iwlbuf *InBuf, dpdbuf4 *tau1_AO,
         value = (double)valptr[InBuf->idx];
         count++;
 
-        Gp = tau1_AO->params->psym[p];
-        Gq = tau1_AO->params->psym[q];
-        Gr = tau1_AO->params->psym[r];
-        Gs = tau1_AO->params->psym[s];
-
-        Gpr = Grp = Gp ^ Gr;
-        Gps = Gsp = Gp ^ Gs;
-        Gqr = Grq = Gq ^ Gr;
-        Gqs = Gsq = Gq ^ Gs;
-
-        pq = tau1_AO->params->rowidx[p][q];
-        rs = tau1_AO->params->rowidx[r][s];
-
-        pr = tau1_AO->params->rowidx[p][r];
-        rp = tau1_AO->params->rowidx[r][p];
-        ps = tau1_AO->params->rowidx[p][s];
-        sp = tau1_AO->params->rowidx[s][p];
-        qr = tau1_AO->params->rowidx[q][r];
-        rq = tau1_AO->params->rowidx[r][q];
-        qs = tau1_AO->params->rowidx[q][s];
-        sq = tau1_AO->params->rowidx[s][q];
-
-        /* (pq|rs) */
-        if (tau1_AO->params->coltot[Gpr])
-            C_DAXPY(tau1_AO->params->coltot[Gpr], value, tau1_AO->matrix[Gpr][qs], 1, tau2_AO->matrix[Gpr][pr], 1);
-
-        if (p != q && r != s && pq != rs) {
-            /* (pq|sr) */
-            if (tau1_AO->params->coltot[Gps])
-                C_DAXPY(tau1_AO->params->coltot[Gps], value, tau1_AO->matrix[Gps][qr], 1, tau2_AO->matrix[Gps][ps], 1);
-
-            /* (qp|rs) */
-            if (tau1_AO->params->coltot[Gqr])
-                C_DAXPY(tau1_AO->params->coltot[Gqr], value, tau1_AO->matrix[Gqr][ps], 1, tau2_AO->matrix[Gqr][qr], 1);
-
-            /* (qp|sr) */
-            if (tau1_AO->params->coltot[Gqs])
-                C_DAXPY(tau1_AO->params->coltot[Gqs], value, tau1_AO->matrix[Gqs][pr], 1, tau2_AO->matrix[Gqs][qs], 1);
-
-            /* (rs|pq) */
-            if (tau1_AO->params->coltot[Grp])
-                C_DAXPY(tau1_AO->params->coltot[Grp], value, tau1_AO->matrix[Grp][sq], 1, tau2_AO->matrix[Grp][rp], 1);
-
-            /* (sr|pq) */
-            if (tau1_AO->params->coltot[Gsp])
-                C_DAXPY(tau1_AO->params->coltot[Gsp], value, tau1_AO->matrix[Gsp][rq], 1, tau2_AO->matrix[Gsp][sp], 1);
-
-            /* (rs|qp) */
-            if (tau1_AO->params->coltot[Grq])
-                C_DAXPY(tau1_AO->params->coltot[Grq], value, tau1_AO->matrix[Grq][sp], 1, tau2_AO->matrix[Grq][rq], 1);
-
-            /* (sr|qp) */
-            if (tau1_AO->params->coltot[Gsq])
-                C_DAXPY(tau1_AO->params->coltot[Gsq], value, tau1_AO->matrix[Gsq][rp], 1, tau2_AO->matrix[Gsq][sq], 1);
-
-        } else if (p != q && r != s && pq == rs) {
-            /* (pq|sr) */
-            if (tau1_AO->params->coltot[Gps])
-                C_DAXPY(tau1_AO->params->coltot[Gps], value, tau1_AO->matrix[Gps][qr], 1, tau2_AO->matrix[Gps][ps], 1);
-
-            /* (qp|rs) */
-            if (tau1_AO->params->coltot[Gqr])
-                C_DAXPY(tau1_AO->params->coltot[Gqr], value, tau1_AO->matrix[Gqr][ps], 1, tau2_AO->matrix[Gqr][qr], 1);
-
-            /* (qp|sr) */
-            if (tau1_AO->params->coltot[Gqs])
-                C_DAXPY(tau1_AO->params->coltot[Gqs], value, tau1_AO->matrix[Gqs][pr], 1, tau2_AO->matrix[Gqs][qs], 1);
-
-        } else if (p != q && r == s) {
-            /* (qp|rs) */
-            if (tau1_AO->params->coltot[Gqr])
-                C_DAXPY(tau1_AO->params->coltot[Gqr], value, tau1_AO->matrix[Gqr][ps], 1, tau2_AO->matrix[Gqr][qr], 1);
-
-            /* (rs|pq) */
-            if (tau1_AO->params->coltot[Grp])
-                C_DAXPY(tau1_AO->params->coltot[Grp], value, tau1_AO->matrix[Grp][sq], 1, tau2_AO->matrix[Grp][rp], 1);
-
-            /* (rs|qp) */
-            if (tau1_AO->params->coltot[Grq])
-                C_DAXPY(tau1_AO->params->coltot[Grq], value, tau1_AO->matrix[Grq][sp], 1, tau2_AO->matrix[Grq][rq], 1);
-
-        }
-
-        else if (p == q && r != s) {
-            /* (pq|sr) */
-            if (tau1_AO->params->coltot[Gps])
-                C_DAXPY(tau1_AO->params->coltot[Gps], value, tau1_AO->matrix[Gps][qr], 1, tau2_AO->matrix[Gps][ps], 1);
-
-            /* (rs|pq) */
-            if (tau1_AO->params->coltot[Grp])
-                C_DAXPY(tau1_AO->params->coltot[Grp], value, tau1_AO->matrix[Grp][sq], 1, tau2_AO->matrix[Grp][rp], 1);
-
-            /* (sr|pq) */
-            if (tau1_AO->params->coltot[Gsp])
-                C_DAXPY(tau1_AO->params->coltot[Gsp], value, tau1_AO->matrix[Gsp][rq], 1, tau2_AO->matrix[Gsp][sp], 1);
-
-        }
-
-        else if (p == q && r == s && pq != rs) {
-            /* (rs|pq) */
-            if (tau1_AO->params->coltot[Grp])
-                C_DAXPY(tau1_AO->params->coltot[Grp], value, tau1_AO->matrix[Grp][sq], 1, tau2_AO->matrix[Grp][rp], 1);
-        }
+        AO_contribute(p, q, r, s, value, tau1_AO, tau2_AO, col_start.data(), tau1_AO->params->coltot);
     }
 
     return count;
 }
 
+/* Adds the contributions of the canonical SO integral (pq|rs) to tau2_AO.  Only
+   columns col_start[h] ... col_start[h] + ncol[h] - 1 of each irrep block are
+   touched, so several threads may share one integral list by splitting the
+   columns. */
+void CCEnergyWavefunction::AO_contribute(int p, int q, int r, int s, double value, dpdbuf4 *tau1_AO, dpdbuf4 *tau2_AO,
+                                         const int *col_start, const int *ncol) {
+    int Gp, Gq, Gr, Gs, Gpr, Gps, Gqr, Gqs, Grp, Gsp, Grq, Gsq;
+    int pr, ps, qr, qs, rp, rq, sp, sq, pq, rs;
+
+    auto axpy = [&](int G, int row1, int row2) {
+        if (ncol[G])
+            C_DAXPY(ncol[G], value, &(tau1_AO->matrix[G][row1][col_start[G]]), 1,
+                    &(tau2_AO->matrix[G][row2][col_start[G]]), 1);
+    };
+
+    Gp = tau1_AO->params->psym[p];
+    Gq = tau1_AO->params->psym[q];
+    Gr = tau1_AO->params->psym[r];
+    Gs = tau1_AO->params->psym[s];
+
+    Gpr = Grp = Gp ^ Gr;
+    Gps = Gsp = Gp ^ Gs;
+    Gqr = Grq = Gq ^ Gr;
+    Gqs = Gsq = Gq ^ Gs;
+
+    pq = tau1_AO->params->rowidx[p][q];
+    rs = tau1_AO->params->rowidx[r][s];
+
+    pr = tau1_AO->params->rowidx[p][r];
+    rp = tau1_AO->params->rowidx[r][p];
+    ps = tau1_AO->params->rowidx[p][s];
+    sp = tau1_AO->params->rowidx[s][p];
+    qr = tau1_AO->params->rowidx[q][r];
+    rq = tau1_AO->params->rowidx[r][q];
+    qs = tau1_AO->params->rowidx[q][s];
+    sq = tau1_AO->params->rowidx[s][q];
+
+    /* (pq|rs) */
+    axpy(Gpr, qs, pr);
+
+    if (p != q && r != s && pq != rs) {
+        /* (pq|sr) */
+        axpy(Gps, qr, ps);
+        /* (qp|rs) */
+        axpy(Gqr, ps, qr);
+        /* (qp|sr) */
+        axpy(Gqs, pr, qs);
+        /* (rs|pq) */
+        axpy(Grp, sq, rp);
+        /* (sr|pq) */
+        axpy(Gsp, rq, sp);
+        /* (rs|qp) */
+        axpy(Grq, sp, rq);
+        /* (sr|qp) */
+        axpy(Gsq, rp, sq);
+    } else if (p != q && r != s && pq == rs) {
+        /* (pq|sr) */
+        axpy(Gps, qr, ps);
+        /* (qp|rs) */
+        axpy(Gqr, ps, qr);
+        /* (qp|sr) */
+        axpy(Gqs, pr, qs);
+    } else if (p != q && r == s) {
+        /* (qp|rs) */
+        axpy(Gqr, ps, qr);
+        /* (rs|pq) */
+        axpy(Grp, sq, rp);
+        /* (rs|qp) */
+        axpy(Grq, sp, rq);
+    } else if (p == q && r != s) {
+        /* (pq|sr) */
+        axpy(Gps, qr, ps);
+        /* (rs|pq) */
+        axpy(Grp, sq, rp);
+        /* (sr|pq) */
+        axpy(Gsp, rq, sp);
+    } else if (p == q && r == s && pq != rs) {
+        /* (rs|pq) */
+        axpy(Grp, sq, rp);
+    }
+}
+
 }  // namespace ccenergy
 }  // namespace psi
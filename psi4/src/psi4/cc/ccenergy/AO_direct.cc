@@ -0,0 +1,256 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*! \file
+    \ingroup CCENERGY
+    \brief Integral-direct <ab||cd> contribution to T2 in the SO basis
+*/
+#include "psi4/libdpd/dpd.h"
+#include "psi4/libqt/qt.h"
+#include "psi4/libmints/basisset.h"
+#include "psi4/libmints/integral.h"
+#include "psi4/libmints/sobasis.h"
+#include "psi4/libmints/sointegral_twobody.h"
+#include "psi4/libmints/twobody.h"
+#include "psi4/libpsi4util/PsiOutStream.h"
+#include "psi4/libpsi4util/process.h"
+#include "psi4/cc/ccwave.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace psi {
+namespace ccenergy {
+
+namespace {
+
+struct SOIntegral {
+    int p, q, r, s;
+    double value;
+};
+
+/* Collects the canonical SO integrals handed out by TwoBodySOInt */
+class SOIntegralCollector {
+    std::vector<SOIntegral> &ints_;
+
+   public:
+    SOIntegralCollector(std::vector<SOIntegral> &ints) : ints_(ints) {}
+
+    void operator()(int p, int q, int r, int s, int, int, int, int, int, int, int, int, double value) {
+        ints_.push_back({p, q, r, s, value});
+    }
+};
+
+/* Keeps the largest diagonal integral (pq|pq) of a shell quartet (PQ|PQ) */
+class SODiagonalMax {
+    double max_;
+
+   public:
+    SODiagonalMax() : max_(0.0) {}
+
+    void operator()(int p, int q, int r, int s, int, int, int, int, int, int, int, int, double value) {
+        if (p == r && q == s) max_ = std::max(max_, std::fabs(value));
+    }
+
+    double max() const { return max_; }
+};
+
+}  // namespace
+
+/* AO_direct_init(): Builds the SO integral object, the SO index -> SO shell
+** map and the Schwarz bounds of the SO shell pairs P >= Q used by
+** AO_direct_contribute().  None of these depend on the amplitudes, so they are
+** computed on the first CC iteration and kept for the rest. */
+
+void CCEnergyWavefunction::AO_direct_init(int nirreps) {
+    int nthread = Process::environment.get_n_threads();
+
+    auto basis = basisset();
+    auto factory = std::make_shared<IntegralFactory>(basis, basis, basis, basis);
+    std::vector<std::shared_ptr<TwoBodyAOInt>> tb;
+    for (int t = 0; t < nthread; t++) tb.push_back(std::shared_ptr<TwoBodyAOInt>(factory->eri()));
+    direct_eri_ = std::make_shared<TwoBodySOInt>(tb, factory);
+    direct_eri_->set_cutoff(1e-14);
+
+    auto sobasis = direct_eri_->basis1();
+    int nshell = sobasis->nshell();
+
+    /* Map absolute (irrep-ordered) SO indices onto SO shells */
+    std::vector<int> irrep_off(nirreps, 0);
+    for (int h = 1; h < nirreps; h++) irrep_off[h] = irrep_off[h - 1] + sobasis->nfunction_in_irrep(h - 1);
+    int nso = irrep_off[nirreps - 1] + sobasis->nfunction_in_irrep(nirreps - 1);
+    direct_so_shell_.assign(nso, 0);
+    for (int P = 0; P < nshell; P++) {
+        for (int f = 0; f < sobasis->nfunction(P); f++) {
+            int func = sobasis->function(P) + f;
+            direct_so_shell_[irrep_off[sobasis->irrep(func)] + sobasis->function_within_irrep(func)] = P;
+        }
+    }
+
+    /* Schwarz bounds for the SO shell pairs P >= Q */
+    direct_pairs_.clear();
+    for (int P = 0; P < nshell; P++)
+        for (int Q = 0; Q <= P; Q++) direct_pairs_.push_back(std::make_pair(P, Q));
+    size_t npairs = direct_pairs_.size();
+    direct_schwarz_.assign(npairs, 0.0);
+
+    TwoBodySOInt &eri = *direct_eri_;
+#pragma omp parallel for schedule(dynamic) num_threads(nthread)
+    for (size_t PQ = 0; PQ < npairs; PQ++) {
+        int P = direct_pairs_[PQ].first;
+        int Q = direct_pairs_[PQ].second;
+        SODiagonalMax diag;
+        eri.compute_shell(P, Q, P, Q, diag);
+        direct_schwarz_[PQ] = std::sqrt(diag.max());
+    }
+}
+
+/* AO_direct_contribute(): Integral-direct replacement for reading PSIF_SO_TEI
+** in BT2_AO().  tau1_AO holds the half-backtransformed tau(Pq,Ij) and tau2_AO
+** receives sum_rs (pr|qs) tau(Rs,Ij), with both buffers already in core.
+**
+** SO shell quartets are screened with the product of their Schwarz bounds and
+** the largest element of tau1_AO in the shell-pair blocks that the quartet
+** touches.  Surviving quartets are computed in parallel in batches of bra
+** pairs, bounded by the free libdpd memory; each batch is then contracted in
+** parallel by splitting the Ij columns of tau2_AO among the threads, so no
+** two threads ever update the same element.
+**
+** Returns the number of SO integrals processed. */
+
+size_t CCEnergyWavefunction::AO_direct_contribute(dpdbuf4 *tau1_AO, dpdbuf4 *tau2_AO) {
+    double tolerance = 1e-14;
+    int nthread = Process::environment.get_n_threads();
+    int nirreps = tau1_AO->params->nirreps;
+
+    if (!direct_eri_) AO_direct_init(nirreps);
+
+    TwoBodySOInt &eri = *direct_eri_;
+    auto sobasis = eri.basis1();
+    int nshell = sobasis->nshell();
+    const std::vector<int> &so_shell = direct_so_shell_;
+    const std::vector<std::pair<int, int>> &pairs = direct_pairs_;
+    const std::vector<double> &schwarz = direct_schwarz_;
+    size_t npairs = pairs.size();
+
+    /* Largest |tau(pq,Ij)| in each SO shell pair */
+    std::vector<double> tau_max(nshell * nshell, 0.0);
+    for (int h = 0; h < nirreps; h++) {
+        int ncols = tau1_AO->params->coltot[h];
+        for (int row = 0; row < tau1_AO->params->rowtot[h]; row++) {
+            int P = so_shell[tau1_AO->params->roworb[h][row][0]];
+            int Q = so_shell[tau1_AO->params->roworb[h][row][1]];
+            double val = 0.0;
+            for (int col = 0; col < ncols; col++) val = std::max(val, std::fabs(tau1_AO->matrix[h][row][col]));
+            tau_max[P * nshell + Q] = std::max(tau_max[P * nshell + Q], val);
+            tau_max[Q * nshell + P] = std::max(tau_max[Q * nshell + P], val);
+        }
+    }
+
+    /* Upper bound on the number of integrals produced by each bra pair */
+    std::vector<size_t> pair_size(npairs), bra_cost(npairs);
+    for (size_t PQ = 0; PQ < npairs; PQ++)
+        pair_size[PQ] = (size_t)sobasis->nfunction(pairs[PQ].first) * sobasis->nfunction(pairs[PQ].second);
+    for (size_t PQ = 0, ket = 0; PQ < npairs; PQ++) {
+        ket += pair_size[PQ];
+        bra_cost[PQ] = pair_size[PQ] * ket;
+    }
+
+    /* Each stored integral takes three doubles' worth of memory */
+    size_t max_ints = std::max((size_t)(1 << 20), (size_t)std::max(0L, dpd_memfree() / 3));
+
+    size_t count = 0;
+    size_t nquartets = 0, nscreened = 0;
+    std::vector<std::vector<SOIntegral>> ints(nthread);
+
+    for (size_t pq_start = 0; pq_start < npairs;) {
+        size_t pq_stop = pq_start + 1;
+        size_t batch_size = bra_cost[pq_start];
+        while (pq_stop < npairs && batch_size + bra_cost[pq_stop] <= max_ints) batch_size += bra_cost[pq_stop++];
+
+        for (int t = 0; t < nthread; t++) ints[t].clear();
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthread) reduction(+ : nquartets, nscreened)
+        for (size_t PQ = pq_start; PQ < pq_stop; PQ++) {
+            int thread = 0;
+#ifdef _OPENMP
+            thread = omp_get_thread_num();
+#endif
+            SOIntegralCollector collect(ints[thread]);
+            int P = pairs[PQ].first;
+            int Q = pairs[PQ].second;
+            for (size_t RS = 0; RS <= PQ; RS++) {
+                int R = pairs[RS].first;
+                int S = pairs[RS].second;
+                double tau_PQRS = std::max(std::max(tau_max[P * nshell + R], tau_max[P * nshell + S]),
+                                           std::max(tau_max[Q * nshell + R], tau_max[Q * nshell + S]));
+                if (schwarz[PQ] * schwarz[RS] * tau_PQRS < tolerance) {
+                    nscreened++;
+                    continue;
+                }
+                nquartets++;
+                eri.compute_shell(P, Q, R, S, collect);
+            }
+        }
+
+        for (int t = 0; t < nthread; t++) count += ints[t].size();
+
+#pragma omp parallel num_threads(nthread)
+        {
+            int thread = 0, nthreads = 1;
+#ifdef _OPENMP
+            thread = omp_get_thread_num();
+            nthreads = omp_get_num_threads();
+#endif
+            std::vector<int> col_start(nirreps), ncol(nirreps);
+            for (int h = 0; h < nirreps; h++) {
+                int ncols = tau1_AO->params->coltot[h];
+                col_start[h] = (ncols * thread) / nthreads;
+                ncol[h] = (ncols * (thread + 1)) / nthreads - col_start[h];
+            }
+            for (int t = 0; t < nthread; t++)
+                for (const SOIntegral &I : ints[t])
+                    AO_contribute(I.p, I.q, I.r, I.s, I.value, tau1_AO, tau2_AO, col_start.data(), ncol.data());
+        }
+
+        pq_start = pq_stop;
+    }
+
+    if (params_.print & 2)
+        outfile->Printf("     *** Direct <ab||cd>: %zu shell quartets computed, %zu screened out\n", nquartets,
+                        nscreened);
+
+    return count;
+}
+
+}  // namespace ccenergy
+}  // namespace psi
@@ -113,6 +113,8 @@ void CCEnergyWavefunction::get_params(Options &options) {
     params_.memory = Process::environment.get_memory();
 
     params_.aobasis = options.get_str("AO_BASIS");
+    if (params_.aobasis == "DIRECT" && params_.ref != 0)
+        throw PsiException("AO_BASIS = DIRECT is only available for RHF references", __FILE__, __LINE__);
     params_.cachelev = options.get_int("CACHELEVEL");
 
     params_.cachetype = 1;
@@ -86,6 +86,7 @@ struct Eom_params {
     int vectors_cc3;
     int restart_eom_cc3;
     int amps_to_print;
+    bool block_sigma;
 
     /* compute overlap of normalized R with L (must run cclambda first) */
     int dot_with_L;
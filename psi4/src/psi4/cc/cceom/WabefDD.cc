@@ -49,9 +49,10 @@ namespace cceom {
 void c_clean(dpdfile2 *CME, dpdfile2 *Cme, dpdbuf4 *CMNEF, dpdbuf4 *Cmnef, dpdbuf4 *CMnEf);
 
 /* This function computes the H-bar doubles-doubles block contribution
-   from Wabef to a Sigma vector stored at Sigma plus 'i' */
+   from Wabef to a Sigma vector stored at Sigma plus 'i'.  For RHF, the
+   <Ab|Ef> ladder term is skipped if WabefDD_block() has already added it */
 
-void WabefDD(int i, int C_irr) {
+void WabefDD(int i, int C_irr, bool ladder_done) {
     dpdfile2 tIA, tia, SIA, Sia;
     dpdbuf4 SIJAB, Sijab, SIjAb, B;
     dpdbuf4 CMNEF, Cmnef, CMnEf, X, F, tau, D, WM, WP, Z;
@@ -76,7 +77,9 @@ void WabefDD(int i, int C_irr) {
 
         timer_on("WabefDD Z");
 
-        if (params.abcd == "OLD") {
+        if (ladder_done) {
+            /* already added for all new vectors of this iteration */
+        } else if (params.abcd == "OLD") {
             global_dpd_->buf4_init(&CMnEf, PSIF_EOM_CMnEf, C_irr, 0, 5, 0, 5, 0, CMnEf_lbl);
             global_dpd_->buf4_init(&Z, PSIF_EOM_TMP, C_irr, 5, 0, 5, 0, 0, "WabefDD Z(Ab,Ij)");
             global_dpd_->buf4_init(&B, PSIF_CC_BINTS, H_IRR, 5, 5, 5, 5, 0, "B <ab|cd>");
@@ -0,0 +1,147 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*! \file
+    \ingroup CCEOM
+    \brief Blocked <Ab|Ef> ladder contribution for several sigma vectors at once
+*/
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "psi4/libqt/qt.h"
+#include "psi4/psifiles.h"
+#include "MOInfo.h"
+#include "Params.h"
+#include "Local.h"
+#define EXTERN
+#include "globals.h"
+
+namespace psi {
+namespace cceom {
+
+/* This function computes the RHF contribution SIjAb += <Ab|Ef> CIjEf to
+   the sigma vectors first ... last-1 in a single pass over the B integrals.
+
+   For each irrep of B, the C vectors are stacked as rows of one matrix,
+   C(k*Ij,Ef), and every bucket of rows of B(Ab,Ef) read from disk is
+   contracted against all of them with one DGEMM.  The number of vectors
+   handled per pass is bounded by the memory available to libdpd; if it
+   does not fit all of them, B is read once per batch of vectors rather
+   than once per vector.  WabefDD() must be told to skip this term. */
+
+void WabefDD_block(int first, int last, int C_irr) {
+    dpdbuf4 B, CMnEf, SIjAb;
+    char lbl[32];
+    int nvec = last - first;
+
+    if (params.eom_ref != 0 || nvec <= 0) return;
+
+    timer_on("WabefDD block");
+
+    global_dpd_->buf4_init(&B, PSIF_CC_BINTS, H_IRR, 5, 5, 5, 5, 0, "B <ab|cd>");
+
+    bool split = false;
+    for (int h = 0; h < moinfo.nirreps; h++) {
+        int Gef = h ^ H_IRR;
+        int Gij = Gef ^ C_irr;
+        size_t nab = B.params->rowtot[h];
+        size_t nef = B.params->coltot[Gef];
+
+        sprintf(lbl, "%s %d", "CMnEf", first);
+        global_dpd_->buf4_init(&CMnEf, PSIF_EOM_CMnEf, C_irr, 0, 5, 0, 5, 0, lbl);
+        size_t nij = CMnEf.params->rowtot[Gij];
+        global_dpd_->buf4_close(&CMnEf);
+
+        if (!nab || !nef || !nij) continue;
+
+        /* Keep half of the free memory for the stacked C and Z matrices and
+           use the rest for buckets of B */
+        long int memfree = dpd_memfree();
+        long int per_vec = (long int)(nij * (nef + nab));
+        int nvb = (int)std::max(1L, (memfree / 2) / per_vec);
+        nvb = std::min(nvb, nvec);
+        if (nvb < nvec) split = true;
+
+        for (int k0 = 0; k0 < nvec; k0 += nvb) {
+            int nk = std::min(nvb, nvec - k0);
+            size_t ncols = nk * nij;
+
+            /* C(k*Ij,Ef) */
+            double **Cstack = global_dpd_->dpd_block_matrix(ncols, nef);
+            for (int k = 0; k < nk; k++) {
+                sprintf(lbl, "%s %d", "CMnEf", first + k0 + k);
+                global_dpd_->buf4_init(&CMnEf, PSIF_EOM_CMnEf, C_irr, 0, 5, 0, 5, 0, lbl);
+                global_dpd_->buf4_mat_irrep_init(&CMnEf, Gij);
+                global_dpd_->buf4_mat_irrep_rd(&CMnEf, Gij);
+                ::memcpy(Cstack[k * nij], CMnEf.matrix[Gij][0], sizeof(double) * nij * nef);
+                global_dpd_->buf4_mat_irrep_close(&CMnEf, Gij);
+                global_dpd_->buf4_close(&CMnEf);
+            }
+
+            /* Z(Ab,k*Ij) = B(Ab,Ef) C(k*Ij,Ef) */
+            double **Z = global_dpd_->dpd_block_matrix(nab, ncols);
+
+            long int rows_per_bucket = std::max(1L, dpd_memfree() / (long int)nef);
+            if (rows_per_bucket > (long int)nab) rows_per_bucket = nab;
+
+            global_dpd_->buf4_mat_irrep_init_block(&B, h, rows_per_bucket);
+            for (size_t row_start = 0; row_start < nab; row_start += rows_per_bucket) {
+                int nrows = std::min((size_t)rows_per_bucket, nab - row_start);
+                global_dpd_->buf4_mat_irrep_rd_block(&B, h, row_start, nrows);
+                C_DGEMM('n', 't', nrows, ncols, nef, 1.0, B.matrix[h][0], nef, Cstack[0], nef, 0.0, Z[row_start],
+                        ncols);
+            }
+            global_dpd_->buf4_mat_irrep_close_block(&B, h, rows_per_bucket);
+            global_dpd_->free_dpd_block(Cstack, ncols, nef);
+
+            /* SIjAb += Z(Ab,Ij) */
+            for (int k = 0; k < nk; k++) {
+                sprintf(lbl, "%s %d", "SIjAb", first + k0 + k);
+                global_dpd_->buf4_init(&SIjAb, PSIF_EOM_SIjAb, C_irr, 0, 5, 0, 5, 0, lbl);
+                global_dpd_->buf4_mat_irrep_init(&SIjAb, Gij);
+                global_dpd_->buf4_mat_irrep_rd(&SIjAb, Gij);
+                for (size_t ij = 0; ij < nij; ij++)
+                    for (size_t ab = 0; ab < nab; ab++) SIjAb.matrix[Gij][ij][ab] += Z[ab][k * nij + ij];
+                global_dpd_->buf4_mat_irrep_wrt(&SIjAb, Gij);
+                global_dpd_->buf4_mat_irrep_close(&SIjAb, Gij);
+                global_dpd_->buf4_close(&SIjAb);
+            }
+            global_dpd_->free_dpd_block(Z, nab, ncols);
+        }
+    }
+
+    global_dpd_->buf4_close(&B);
+
+    if (split) outfile->Printf("\tWabefDD block: not enough memory for %d vectors in one pass over B.\n", nvec);
+
+    timer_off("WabefDD block");
+}
+
+}  // namespace cceom
+}  // namespace psi
@@ -89,7 +89,8 @@ void c_clean(dpdfile2 *CME, dpdfile2 *Cme, dpdbuf4 *CMNEF, dpdbuf4 *Cmnef, dpdbu
 void sigmaSS(int index, int irrep);
 void sigmaSD(int index, int irrep);
 void sigmaDS(int index, int irrep);
-void sigmaDD(int index, int irrep);
+void sigmaDD(int index, int irrep, bool ladder_done);
+void WabefDD_block(int first, int last, int C_irr);
 void sigma00(int index, int irrep);
 void sigma0S(int index, int irrep);
 void sigma0D(int index, int irrep);
@@ -313,15 +314,27 @@ void diag() {
             numCs = L_start_iter = L;
             num_converged = 0;
 
+            /* Form a zeroed S vector for each C vector
+               SIA and Sia do get overwritten by sigmaSS
+               so this may only be necessary for debugging */
             for (i = already_sigma; i < L; ++i) {
-                /* Form a zeroed S vector for each C vector
-                   SIA and Sia do get overwritten by sigmaSS
-                   so this may only be necessary for debugging */
                 ++nsigma_evaluations;
                 if (params.full_matrix) init_S0(i);
                 init_S1(i, C_irr);
                 init_S2(i, C_irr);
+            }
+
+            /* Add the <Ab|Ef> ladder term for all new vectors at once, so the
+               B integrals are read once per iteration instead of once per vector */
+            bool ladder_done = false;
+            if (eom_params.block_sigma && params.eom_ref == 0 && params.wfn != "EOM_CC2" && L - already_sigma > 1) {
+                timer_on("SIGMA ALL");
+                WabefDD_block(already_sigma, L, C_irr);
+                timer_off("SIGMA ALL");
+                ladder_done = true;
+            }
 
+            for (i = already_sigma; i < L; ++i) {
                 sort_C(i, C_irr);
 
 /* Computing sigma vectors */
@@ -344,7 +357,7 @@ void diag() {
                     sigmaDS(i, C_irr);
                     timer_off("sigmaDS");
                     timer_on("sigmaDD");
-                    sigmaDD(i, C_irr);
+                    sigmaDD(i, C_irr, ladder_done);
                     timer_off("sigmaDD");
                     if (((params.wfn == "EOM_CC3") && (cc3_stage > 0)) || eom_params.restart_eom_cc3) {
                         timer_on("cc3_HC1");
@@ -42,15 +42,16 @@ namespace psi {
 namespace cceom {
 
 void FDD(int i, int C_irr);
-void WabefDD(int i, int C_irr);
+void WabefDD(int i, int C_irr, bool ladder_done);
 void WmnijDD(int i, int C_irr);
 void WmbejDD(int i, int C_irr);
 void WmnefDD(int i, int C_irr);
 
 /* This function computes the H-bar doubles-doubles block contribution
-to a Sigma vector stored at Sigma plus 'i' */
+to a Sigma vector stored at Sigma plus 'i'.  If ladder_done is set, the
+<Ab|Ef> ladder term has already been added by WabefDD_block() */
 
-void sigmaDD(int i, int C_irr) {
+void sigmaDD(int i, int C_irr, bool ladder_done) {
     timer_on("FDD");
     FDD(i, C_irr);
     timer_off("FDD");
@@ -58,7 +59,7 @@ void sigmaDD(int i, int C_irr) {
     WmnijDD(i, C_irr);
     timer_off("WmnijDD");
     timer_on("WabefDD");
-    WabefDD(i, C_irr);
+    WabefDD(i, C_irr, ladder_done);
     timer_off("WabefDD");
     timer_on("WmbejDD");
     WmbejDD(i, C_irr);
@@ -30,6 +30,8 @@
 #define CCWAVE_H
 
 #include <array>
+#include <utility>
+#include <vector>
 
 #include "psi4/libmints/wavefunction.h"
 #include "psi4/libdpd/dpd.h"
@@ -43,6 +45,7 @@ class Options;
 struct dpdfile2;
 struct dpdbuf4;
 struct iwlbuf;
+class TwoBodySOInt;
 }  // namespace psi
 
 namespace psi {
@@ -179,6 +182,10 @@ class CCEnergyWavefunction : public Wavefunction {
                    int **mo_row, int **so_row, int *mospi_left, int *mospi_right, int *sospi, int type, double alpha,
                    double beta);
     int AO_contribute(struct iwlbuf *InBuf, dpdbuf4 *tau1_AO, dpdbuf4 *tau2_AO);
+    void AO_contribute(int p, int q, int r, int s, double value, dpdbuf4 *tau1_AO, dpdbuf4 *tau2_AO,
+                       const int *col_start, const int *ncol);
+    void AO_direct_init(int nirreps);
+    size_t AO_direct_contribute(dpdbuf4 *tau1_AO, dpdbuf4 *tau2_AO);
 
     double rhf_energy();
     double uhf_energy();
@@ -198,6 +205,12 @@ class CCEnergyWavefunction : public Wavefunction {
     Params params_;
     Local local_;
     std::array<dpd_file4_cache_entry, 113> cache_priority_list_;
+
+    /* integral-direct <ab||cd> data, built once by AO_direct_init() */
+    std::shared_ptr<TwoBodySOInt> direct_eri_;
+    std::vector<int> direct_so_shell_;
+    std::vector<std::pair<int, int>> direct_pairs_;
+    std::vector<double> direct_schwarz_;
 };
 
 }  // namespace ccenergy
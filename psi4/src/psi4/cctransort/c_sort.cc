@@ -79,8 +79,8 @@ void c_sort(int reference) {
 
         /* <Ai|Bj> (iA,Bj) (Wmbej.c) */
         global_dpd_->buf4_init(&C, PSIF_CC_CINTS, 0, 26, 26, 26, 26, 0, "C <Ai|Bj>");
-        global_dpd_->buf4_sort(&C, PSIF_CC_CINTS, qpsr, 27, 27, "C <iA|jB>");
-        global_dpd_->buf4_sort(&C, PSIF_CC_CINTS, qprs, 27, 26, "C <Ai|Bj> (iA,Bj)");
+        global_dpd_->buf4_sort_multi(&C, {{PSIF_CC_CINTS, qpsr, 27, 27, "C <iA|jB>"},
+                                          {PSIF_CC_CINTS, qprs, 27, 26, "C <Ai|Bj> (iA,Bj)"}});
         global_dpd_->buf4_close(&C);
 
         /* <Ia|Jb> (Ia,bJ) (Wmbej.c) */
@@ -103,29 +103,17 @@ void c_sort(int reference) {
         global_dpd_->buf4_close(&D);
         global_dpd_->buf4_close(&C);
 
-        /* <ia|jb> (bi,ja) */
+        /* <ia|jb> (bi,ja), <ia|jb> (ia,bj), and <ai|bj> (cchbar/Wabei_RHF.c) in one pass */
         global_dpd_->buf4_init(&C, PSIF_CC_CINTS, 0, 10, 10, 10, 10, 0, "C <ia|jb>");
-        global_dpd_->buf4_sort(&C, PSIF_CC_CINTS, sprq, 11, 10, "C <ia|jb> (bi,ja)");
+        global_dpd_->buf4_sort_multi(&C, {{PSIF_CC_CINTS, sprq, 11, 10, "C <ia|jb> (bi,ja)"},
+                                          {PSIF_CC_CINTS, pqsr, 10, 11, "C <ia|jb> (ia,bj)"},
+                                          {PSIF_CC_CINTS, qpsr, 11, 11, "C <ai|bj>"}});
         global_dpd_->buf4_close(&C);
 
-        /* <ia||jb> (bi,ja) */
+        /* <ia||jb> (bi,ja) and <ia||jb> (ia,bj) (Wmbej.c) in one pass */
         global_dpd_->buf4_init(&C, PSIF_CC_CINTS, 0, 10, 10, 10, 10, 0, "C <ia||jb>");
-        global_dpd_->buf4_sort(&C, PSIF_CC_CINTS, sprq, 11, 10, "C <ia||jb> (bi,ja)");
-        global_dpd_->buf4_close(&C);
-
-        /* <ia|jb> (ia,bj) */
-        global_dpd_->buf4_init(&C, PSIF_CC_CINTS, 0, 10, 10, 10, 10, 0, "C <ia|jb>");
-        global_dpd_->buf4_sort(&C, PSIF_CC_CINTS, pqsr, 10, 11, "C <ia|jb> (ia,bj)");
-        global_dpd_->buf4_close(&C);
-
-        /* <ia||jb> (ia,bj) (Wmbej.c) */
-        global_dpd_->buf4_init(&C, PSIF_CC_CINTS, 0, 10, 10, 10, 10, 0, "C <ia||jb>");
-        global_dpd_->buf4_sort(&C, PSIF_CC_CINTS, pqsr, 10, 11, "C <ia||jb> (ia,bj)");
-        global_dpd_->buf4_close(&C);
-
-        /* <ai|bj> (cchbar/Wabei_RHF.c) */
-        global_dpd_->buf4_init(&C, PSIF_CC_CINTS, 0, 10, 10, 10, 10, 0, "C <ia|jb>");
-        global_dpd_->buf4_sort(&C, PSIF_CC_CINTS, qpsr, 11, 11, "C <ai|bj>");
+        global_dpd_->buf4_sort_multi(&C, {{PSIF_CC_CINTS, sprq, 11, 10, "C <ia||jb> (bi,ja)"},
+                                          {PSIF_CC_CINTS, pqsr, 10, 11, "C <ia||jb> (ia,bj)"}});
         global_dpd_->buf4_close(&C);
     }
 }
@@ -53,7 +53,7 @@ void memcheck(int reference);
 
 vector<int> pitzer2qt(vector<Dimension> &spaces);
 
-void sort_tei_rhf(std::shared_ptr<PSIO> psio, int print);
+void sort_tei_rhf(std::shared_ptr<PSIO> psio, int print, bool vvvv);
 void sort_tei_uhf(std::shared_ptr<PSIO> psio, int print);
 
 void c_sort(int reference);
@@ -110,6 +110,13 @@ PsiReturnType cctransort(SharedWavefunction ref, Options &options) {
         if (semicanonical) reference = 2;
     }
 
+    // The integral-direct ladder in ccenergy (AO_BASIS = DIRECT) replaces every use of the
+    // <ab|cd> integrals in an RHF-CCSD energy, so they are neither transformed nor sorted.
+    // The driver sets DIRECT_VVVV only when no later module (lambda, density, EOM) reads them.
+    bool direct_vvvv = (options.get_bool("DIRECT_VVVV") && reference == 0 &&
+                        options.get_str("AO_BASIS") == "DIRECT" && options.get_str("DERTYPE") == "NONE" &&
+                        (options.get_str("WFN") == "CCSD" || options.get_str("WFN") == "CCSD_T"));
+
     int nirreps = ref->nirrep();
     int nmo = ref->nmo();
     std::vector<std::string> labels = ref->molecule()->irrep_labels();
@@ -455,11 +462,17 @@ PsiReturnType cctransort(SharedWavefunction ref, Options &options) {
     ints->transform_tei(MOSpace::vir, MOSpace::vir, MOSpace::occ, MOSpace::occ,
                         IntegralTransform::HalfTrans::MakeAndKeep);
     outfile->Printf("\t(VV|OV)...\n");
-    ints->transform_tei(MOSpace::vir, MOSpace::vir, MOSpace::occ, MOSpace::vir,
-                        IntegralTransform::HalfTrans::ReadAndKeep);
-    outfile->Printf("\t(VV|VV)...\n");
-    ints->transform_tei(MOSpace::vir, MOSpace::vir, MOSpace::vir, MOSpace::vir,
-                        IntegralTransform::HalfTrans::ReadAndNuke);
+    if (direct_vvvv) {
+        ints->transform_tei(MOSpace::vir, MOSpace::vir, MOSpace::occ, MOSpace::vir,
+                            IntegralTransform::HalfTrans::ReadAndNuke);
+        outfile->Printf("\t(VV|VV) skipped: computed integral-direct in ccenergy.\n");
+    } else {
+        ints->transform_tei(MOSpace::vir, MOSpace::vir, MOSpace::occ, MOSpace::vir,
+                            IntegralTransform::HalfTrans::ReadAndKeep);
+        outfile->Printf("\t(VV|VV)...\n");
+        ints->transform_tei(MOSpace::vir, MOSpace::vir, MOSpace::vir, MOSpace::vir,
+                            IntegralTransform::HalfTrans::ReadAndNuke);
+    }
 
     double efzc;
     psio->open(PSIF_CC_INFO, PSIO_OPEN_OLD);
@@ -529,7 +542,7 @@ PsiReturnType cctransort(SharedWavefunction ref, Options &options) {
     if (reference == 2)
         sort_tei_uhf(psio, print);
     else
-        sort_tei_rhf(psio, print);
+        sort_tei_rhf(psio, print, !direct_vvvv);
     psio->close(PSIF_LIBTRANS_DPD, 0);  // delete file
 
     for (int i = PSIF_CC_MIN; i <= PSIF_CC_MAX; i++) psio->open(i, 1);
@@ -693,7 +706,7 @@ PsiReturnType cctransort(SharedWavefunction ref, Options &options) {
     e_sort(reference);
     f_sort(reference);
     if (reference == 0) {
-        b_spinad(psio);
+        if (!direct_vvvv) b_spinad(psio);
         a_spinad();
         d_spinad();
         e_spinad();
@@ -87,14 +87,14 @@ void d_sort(int reference) {
 
         /*** AB ***/
         global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 22, 28, 22, 28, 0, "D <Ij|Ab>");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, qpsr, 23, 29, "D <iJ|aB>");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, psrq, 24, 26, "D <Ij|Ab> (Ib,Aj)");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, prqs, 20, 30, "D <Ij|Ab> (IA,jb)");
+        global_dpd_->buf4_sort_multi(&D, {{PSIF_CC_DINTS, qpsr, 23, 29, "D <iJ|aB>"},
+                                          {PSIF_CC_DINTS, psrq, 24, 26, "D <Ij|Ab> (Ib,Aj)"},
+                                          {PSIF_CC_DINTS, prqs, 20, 30, "D <Ij|Ab> (IA,jb)"}});
         global_dpd_->buf4_close(&D);
 
         global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 20, 30, 20, 30, 0, "D <Ij|Ab> (IA,jb)");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, rspq, 30, 20, "D <Ij|Ab> (ia,JB)");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, pqsr, 20, 31, "D <Ij|Ab> (IA,bj)");
+        global_dpd_->buf4_sort_multi(&D, {{PSIF_CC_DINTS, rspq, 30, 20, "D <Ij|Ab> (ia,JB)"},
+                                          {PSIF_CC_DINTS, pqsr, 20, 31, "D <Ij|Ab> (IA,bj)"}});
         global_dpd_->buf4_close(&D);
 
         global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 30, 20, 30, 20, 0, "D <Ij|Ab> (ia,JB)");
@@ -129,24 +129,11 @@ void d_sort(int reference) {
         global_dpd_->buf4_copy(&D, PSIF_CC_DINTS, "D <ij||ab>");
         global_dpd_->buf4_close(&D);
 
-        /* <ij|ab> (ia,jb) */
+        /* <ij|ab> (ia,jb), <ij|ab> (aj,ib), and <ij|ab> (bi,ja) in one pass */
         global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 0, 5, 0, 5, 0, "D <ij|ab>");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, prqs, 10, 10, "D <ij|ab> (ia,jb)");
-        global_dpd_->buf4_close(&D);
-
-        /* <ij|ab> (ai,jb) */
-        global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 10, 10, 10, 10, 0, "D <ij|ab> (ia,jb)");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, qprs, 11, 10, "D <ij|ab> (ai,jb)");
-        global_dpd_->buf4_close(&D);
-
-        /* <ij|ab> (aj,ib) */
-        global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 0, 5, 0, 5, 0, "D <ij|ab>");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, rqps, 11, 10, "D <ij|ab> (aj,ib)");
-        global_dpd_->buf4_close(&D);
-
-        /* <ij|ab> (bi,ja) */
-        global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 0, 5, 0, 5, 0, "D <ij|ab>");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, spqr, 11, 10, "D <ij|ab> (bi,ja)");
+        global_dpd_->buf4_sort_multi(&D, {{PSIF_CC_DINTS, prqs, 10, 10, "D <ij|ab> (ia,jb)"},
+                                          {PSIF_CC_DINTS, rqps, 11, 10, "D <ij|ab> (aj,ib)"},
+                                          {PSIF_CC_DINTS, spqr, 11, 10, "D <ij|ab> (bi,ja)"}});
         global_dpd_->buf4_close(&D);
 
         /* <ij||ab> (ia,jb) */
@@ -154,9 +141,11 @@ void d_sort(int reference) {
         global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, prqs, 10, 10, "D <ij||ab> (ia,jb)");
         global_dpd_->buf4_close(&D);
 
-        /* <ij|ab> (ib,ja) */
+        /* <ij|ab> (ai,jb), <ij|ab> (ib,ja), and <ij|ab> (ia,bj) in one pass */
         global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 10, 10, 10, 10, 0, "D <ij|ab> (ia,jb)");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, psrq, 10, 10, "D <ij|ab> (ib,ja)");
+        global_dpd_->buf4_sort_multi(&D, {{PSIF_CC_DINTS, qprs, 11, 10, "D <ij|ab> (ai,jb)"},
+                                          {PSIF_CC_DINTS, psrq, 10, 10, "D <ij|ab> (ib,ja)"},
+                                          {PSIF_CC_DINTS, pqsr, 10, 11, "D <ij|ab> (ia,bj)"}});
         global_dpd_->buf4_close(&D);
 
         /* <ij|ab> (ib,aj) */
@@ -164,11 +153,6 @@ void d_sort(int reference) {
         global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, pqsr, 10, 11, "D <ij|ab> (ib,aj)");
         global_dpd_->buf4_close(&D);
 
-        /* <ij|ab> (ia,bj) */
-        global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 10, 10, 10, 10, 0, "D <ij|ab> (ia,jb)");
-        global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, pqsr, 10, 11, "D <ij|ab> (ia,bj)");
-        global_dpd_->buf4_close(&D);
-
         /* <ij||ab> (ia,bj) */
         global_dpd_->buf4_init(&D, PSIF_CC_DINTS, 0, 10, 10, 10, 10, 0, "D <ij||ab> (ia,jb)");
         global_dpd_->buf4_sort(&D, PSIF_CC_DINTS, pqsr, 10, 11, "D <ij||ab> (ia,bj)");
@@ -80,20 +80,18 @@ void e_sort(int reference) {
         global_dpd_->buf4_sort(&E, PSIF_CC_EINTS, qpsr, 22, 26, "E <Ij|Ak>");
         global_dpd_->buf4_close(&E);
 
-        /* <iJ|aK> */
+        /* <iJ|aK> and <Ia|Jk> in one pass */
         global_dpd_->buf4_init(&E, PSIF_CC_EINTS, 0, 22, 24, 22, 24, 0, "E <Ij|Ka>");
-        global_dpd_->buf4_sort(&E, PSIF_CC_EINTS, qpsr, 23, 25, "E <iJ|aK>");
-        global_dpd_->buf4_close(&E);
-
-        /* <Ia|Jk> */
-        global_dpd_->buf4_init(&E, PSIF_CC_EINTS, 0, 22, 24, 22, 24, 0, "E <Ij|Ka>");
-        global_dpd_->buf4_sort(&E, PSIF_CC_EINTS, rspq, 24, 22, "E <Ia|Jk>");
+        global_dpd_->buf4_sort_multi(&E, {{PSIF_CC_EINTS, qpsr, 23, 25, "E <iJ|aK>"},
+                                          {PSIF_CC_EINTS, rspq, 24, 22, "E <Ia|Jk>"}});
         global_dpd_->buf4_close(&E);
 
     } else { /** RHF/ROHF **/
-        /* <ij|ka> */
+        /* <ij|ka>, <ia|jk>, and <ij|ak> in one pass */
         global_dpd_->buf4_init(&E, PSIF_CC_EINTS, 0, 11, 0, 11, 0, 0, "E <ai|jk>");
-        global_dpd_->buf4_sort(&E, PSIF_CC_EINTS, srqp, 0, 10, "E <ij|ka>");
+        global_dpd_->buf4_sort_multi(&E, {{PSIF_CC_EINTS, srqp, 0, 10, "E <ij|ka>"},
+                                          {PSIF_CC_EINTS, qpsr, 10, 0, "E <ia|jk>"},
+                                          {PSIF_CC_EINTS, rspq, 0, 11, "E <ij|ak>"}});
         global_dpd_->buf4_close(&E);
 
         /* <ij||ka> (i>j,ka) */
@@ -110,16 +108,6 @@ void e_sort(int reference) {
         global_dpd_->buf4_init(&E, PSIF_CC_EINTS, 0, 2, 10, 2, 10, 0, "E <ij||ka> (i>j,ka)");
         global_dpd_->buf4_sort(&E, PSIF_CC_EINTS, pqsr, 2, 11, "E <ij||ka> (i>j,ak)");
         global_dpd_->buf4_close(&E);
-
-        /* <ia|jk> */
-        global_dpd_->buf4_init(&E, PSIF_CC_EINTS, 0, 11, 0, 11, 0, 0, "E <ai|jk>");
-        global_dpd_->buf4_sort(&E, PSIF_CC_EINTS, qpsr, 10, 0, "E <ia|jk>");
-        global_dpd_->buf4_close(&E);
-
-        /* <ij|ak> */
-        global_dpd_->buf4_init(&E, PSIF_CC_EINTS, 0, 11, 0, 11, 0, 0, "E <ai|jk>");
-        global_dpd_->buf4_sort(&E, PSIF_CC_EINTS, rspq, 0, 11, "E <ij|ak>");
-        global_dpd_->buf4_close(&E);
     }
 }
 
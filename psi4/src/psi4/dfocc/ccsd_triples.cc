@@ -26,7 +26,9 @@
  * @END LICENSE
  */
 
+#include <array>
 #include <ctime>
+#include <vector>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -39,31 +41,84 @@
 namespace psi {
 namespace dfoccwave {
 
+namespace {
+
+// Bounded LRU cache for the J[x](ab,e) = (xa|be) virtual slices of the direct
+// (T) algorithm. Slices are handed out as shared pointers, so a slice evicted by
+// one thread stays valid for any thread that is still contracting with it.
+class IabcSliceCache {
+   public:
+    IabcSliceCache(long int nslices, long int capacity)
+        : slices_(nslices), stamps_(nslices, 0), capacity_(capacity), size_(0), clock_(0), misses_(0) {}
+
+    // Returns the cached slice x, or a null pointer if it has to be built
+    SharedTensor2d get(long int x) {
+        SharedTensor2d slice;
+#pragma omp critical(dfocc_iabc_slice_cache)
+        {
+            slice = slices_[x];
+            if (slice) stamps_[x] = ++clock_;
+        }
+        return slice;
+    }
+
+    // Stores a freshly built slice x, evicting the least recently used one if full
+    void put(long int x, const SharedTensor2d &slice) {
+#pragma omp critical(dfocc_iabc_slice_cache)
+        {
+            misses_++;
+            if (capacity_ > 0 && !slices_[x]) {
+                if (size_ == capacity_) {
+                    long int lru = -1;
+                    for (long int y = 0; y < (long int)slices_.size(); ++y) {
+                        if (slices_[y] && (lru < 0 || stamps_[y] < stamps_[lru])) lru = y;
+                    }
+                    slices_[lru].reset();
+                    size_--;
+                }
+                slices_[x] = slice;
+                stamps_[x] = ++clock_;
+                size_++;
+            }
+        }
+    }
+
+    size_t misses() const { return misses_; }
+
+   private:
+    std::vector<SharedTensor2d> slices_;
+    std::vector<size_t> stamps_;
+    long int capacity_;
+    long int size_;
+    size_t clock_;
+    size_t misses_;
+};
+
+}  // namespace
+
 void DFOCC::ccsd_canonic_triples() {
     // defs
-    SharedTensor2d K, L, M, I, J, T, U, Tau, W, X, Y, Z;
-    SharedTensor2d V, J1, J2, J3, Jt;
-    SharedTensor1d Eijk;
-    long int Nijk;
+    SharedTensor2d K, L, M, I, J, T;
 
-    // Find number of unique ijk combinations (i>=j>=k)
-    /*
-    Nijk = 0;
-    for(long int i = 0 ; i < naoccA; ++i){
-        for(long int j = 0 ; j <= i; ++j){
-            for(long int k = 0 ; k <= j; ++k){
-                Nijk++;
+    long int nthreads = 1;
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+
+    // Find the unique ijk combinations (i>=j>=k); they are handed out to the
+    // threads as independent tasks
+    std::vector<long int> ijk_list;
+    for (long int i = 0; i < naoccA; ++i) {
+        for (long int j = 0; j <= i; ++j) {
+            for (long int k = 0; k <= j; ++k) {
+                ijk_list.push_back((i * naoccA + j) * naoccA + k);
             }
         }
     }
-    */
-    Nijk = naoccA * (naoccA + 1) * (naoccA + 2) / 6;
+    long int Nijk = ijk_list.size();
     outfile->Printf("\tNumber of ijk combinations: %i \n", Nijk);
 
-    // Malloc Eijk
-    // Eijk = SharedTensor1d(new Tensor1d("Eijk", Nijk));
-
-    // Memory: 2*O^2V^2 + 5*V^3 + O^3V + V^2N + V^3/2
+    // Memory: 2*O^2V^2 + O^3V + OVN + V^2N/2 + nthreads*(2*V^3 + V^3/2) + nslices*V^3
 
     // Read t2 amps
     t2 = SharedTensor2d(new Tensor2d("T2 (IA|JB)", naoccA, navirA, naoccA, navirA));
@@ -93,210 +148,233 @@ void DFOCC::ccsd_canonic_triples() {
     L = M->transpose();
     M.reset();
 
-    // malloc W[ijk](abc)
-    W = SharedTensor2d(new Tensor2d("W[IJK] <AB|C>", navirA * navirA, navirA));
-    V = SharedTensor2d(new Tensor2d("V[IJK] <BA|C>", navirA * navirA, navirA));
-    J1 = SharedTensor2d(new Tensor2d("J[I] <AB|E>", navirA * navirA, navirA));
-    J2 = SharedTensor2d(new Tensor2d("J[J] <AB|E>", navirA * navirA, navirA));
-    J3 = SharedTensor2d(new Tensor2d("J[K] <AB|E>", navirA * navirA, navirA));
-
     // B(Q,ab)
     K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQ, ntri_abAA));
     K->read(psio_, PSIF_DFOCC_INTS);
-    Jt = SharedTensor2d(new Tensor2d("J[I] <A|B>=C", navirA, ntri_abAA));
+
+    // Thread-private W[ijk](ab,c), V[ijk](ab,c), and J[x] <A|B>=C buffers
+    std::vector<SharedTensor2d> W_thread, V_thread, Jt_thread;
+    for (long int t = 0; t < nthreads; ++t) {
+        W_thread.push_back(SharedTensor2d(new Tensor2d("W[IJK] <AB|C>", navirA * navirA, navirA)));
+        V_thread.push_back(SharedTensor2d(new Tensor2d("V[IJK] <BA|C>", navirA * navirA, navirA)));
+        Jt_thread.push_back(SharedTensor2d(new Tensor2d("J[X] <A|B>=C", navirA, ntri_abAA)));
+    }
+
+    // Size the J[x] slice cache from the memory left over; each thread may also
+    // hold up to three evicted slices while it works on a triplet
+    double cost_slice = (double)navirA * navirA * navirA * sizeof(double) / (1024.0 * 1024.0);
+    double cost_fixed = 2.0 * naoccA * naoccA * navirA * navirA;
+    cost_fixed += (double)naoccA * naoccA * naoccA * navirA;
+    cost_fixed += (double)nQ * naoccA * navirA;
+    cost_fixed += (double)nQ * ntri_abAA;
+    cost_fixed += nthreads * (2.0 * navirA * navirA * navirA + navirA * ntri_abAA);
+    cost_fixed *= sizeof(double) / (1024.0 * 1024.0);
+    long int nslices = 0;
+    if (cost_slice > 0.0 && memory_mb > cost_fixed) nslices = (long int)((memory_mb - cost_fixed) / cost_slice);
+    nslices -= 3 * nthreads;
+    if (nslices < 0) nslices = 0;
+    if (nslices > naoccA) nslices = naoccA;
+    outfile->Printf("\tNumber of cached (ia|bc) slices: %ld of %d \n", nslices, naoccA);
+    IabcSliceCache Jcache(naoccA, nslices);
+
+    // Each thread keeps the slices it last used for i, j and k, so consecutive
+    // triplets sharing an index reuse them even when nothing fits in the cache
+    std::vector<std::array<long int, 3>> held_idx(nthreads, std::array<long int, 3>{{-1, -1, -1}});
+    std::vector<std::array<SharedTensor2d, 3>> held(nthreads);
+
+    // J[x](a,bc) = (xa|bc) = \sum(Q) B[x](aQ) * B(Q,bc)
+    auto get_slice = [&](int thread, int pos, long int x) {
+        SharedTensor2d Jx;
+        for (int p = 0; p < 3 && !Jx; ++p) {
+            if (held_idx[thread][p] == x) Jx = held[thread][p];
+        }
+        if (!Jx) Jx = Jcache.get(x);
+        if (!Jx) {
+            SharedTensor2d Jt = Jt_thread[thread];
+            Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, x * navirA * nQ, 0, 1.0, 0.0);
+            Jx = SharedTensor2d(new Tensor2d("J[X] <AB|E>", navirA * navirA, navirA));
+            Jx->expand23(navirA, navirA, navirA, Jt);
+            Jcache.put(x, Jx);
+        }
+        held_idx[thread][pos] = x;
+        held[thread][pos] = Jx;
+        return Jx;
+    };
 
     // main loop
     E_t = 0.0;
     double sum = 0.0;
-    for (long int i = 0; i < naoccA; ++i) {
-        double Di = FockA->get(i + nfrzc, i + nfrzc);
-
-        // Compute J[i](a,bc) = (ia|bc) = \sum(Q) B[i](aQ) * B(Q,bc)
-        Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, i * navirA * nQ, 0, 1.0, 0.0);
-        J1->expand23(navirA, navirA, navirA, Jt);
-
-        for (long int j = 0; j <= i; ++j) {
-            double Dij = Di + FockA->get(j + nfrzc, j + nfrzc);
-
-            // Compute J[j](a,bc) = (ja|bc) = \sum(Q) B[j](aQ) * B(Q,bc)
-            Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, j * navirA * nQ, 0, 1.0, 0.0);
-            J2->expand23(navirA, navirA, navirA, Jt);
-
-            for (long int k = 0; k <= j; ++k) {
-                // Compute J[k](a,bc) = (ka|bc) = \sum(Q) B[k](aQ) * B(Q,bc)
-                Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, k * navirA * nQ, 0, 1.0, 0.0);
-                J3->expand23(navirA, navirA, navirA, Jt);
-
-                // W[ijk](ab,c) = \sum(e) t_jk^ec (ia|be) (1+)
-                // W[ijk](ab,c) = \sum(e) J[i](ab,e) T[jk](ec)
-                W->contract(false, false, navirA * navirA, navirA, navirA, J1, T, 0,
-                            (j * naoccA * navirA * navirA) + (k * navirA * navirA), 1.0, 0.0);
-
-                // W[ijk](ab,c) -= \sum(m) t_im^ab <jk|mc> (1-)
-                // W[ijk](ab,c) -= \sum(m) T[i](m,ab) I[jk](mc)
-                W->contract(true, false, navirA * navirA, navirA, naoccA, T, I, i * naoccA * navirA * navirA,
-                            (j * naoccA * naoccA * navirA) + (k * naoccA * navirA), -1.0, 1.0);
-
-                // W[ijk](ac,b) = \sum(e) t_kj^eb (ia|ce) (2+)
-                // W[ijk](ac,b) = \sum(e) J[i](ac,e) T[kj](eb)
-                V->contract(false, false, navirA * navirA, navirA, navirA, J1, T, 0,
-                            (k * naoccA * navirA * navirA) + (j * navirA * navirA), 1.0, 0.0);
-
-                // W[ijk](ac,b) -= \sum(m) t_im^ac <kj|mb> (2-)
-                // W[ijk](ac,b) -= \sum(m) T[i](m,ac) I[kj](mb)
-                V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, i * naoccA * navirA * navirA,
-                            (k * naoccA * naoccA * navirA) + (j * naoccA * navirA), -1.0, 1.0);
-#pragma omp parallel for
-                for (long int a = 0; a < navirA; ++a) {
-                    for (long int b = 0; b < navirA; ++b) {
-                        W->axpy((size_t)navirA, a * navirA * navirA + b, navirA, V, a * navirA * navirA + b * navirA, 1,
-                                1.0);
-                    }
-                }
-
-                // W[ijk](ba,c) = \sum(e) t_ik^ec (jb|ae) (3+)
-                // W[ijk](ba,c) = \sum(e) J[j](ba,e) T[ik](ec)
-                V->contract(false, false, navirA * navirA, navirA, navirA, J2, T, 0,
-                            (i * naoccA * navirA * navirA) + (k * navirA * navirA), 1.0, 0.0);
-
-                // W[ijk](ba,c) -= \sum(m) t_jm^ba <ik|mc> (3-)
-                // W[ijk](ba,c) -= \sum(m) T[j](m,ba) I[ik](mc)
-                V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, j * naoccA * navirA * navirA,
-                            (i * naoccA * naoccA * navirA) + (k * naoccA * navirA), -1.0, 1.0);
-#pragma omp parallel for
-                for (long int a = 0; a < navirA; ++a) {
-                    for (long int b = 0; b < navirA; ++b) {
-                        W->axpy((size_t)navirA, b * navirA * navirA + a * navirA, 1, V,
-                                a * navirA * navirA + b * navirA, 1, 1.0);
-                    }
-                }
-
-                // W[ijk](bc,a) = \sum(e) t_ki^ea (jb|ce) (4+)
-                // W[ijk](bc,a) = \sum(e) J[j](bc,e) T[ki](ea)
-                V->contract(false, false, navirA * navirA, navirA, navirA, J2, T, 0,
-                            (k * naoccA * navirA * navirA) + (i * navirA * navirA), 1.0, 0.0);
-
-                // W[ijk](bc,a) -= \sum(m) t_jm^bc <ki|ma> (4-)
-                // W[ijk](bc,a) -= \sum(m) T[j](m,bc) I[ki](ma)
-                V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, j * naoccA * navirA * navirA,
-                            (k * naoccA * naoccA * navirA) + (i * naoccA * navirA), -1.0, 1.0);
-#pragma omp parallel for
-                for (long int a = 0; a < navirA; ++a) {
-                    for (long int b = 0; b < navirA; ++b) {
-                        W->axpy((size_t)navirA, b * navirA * navirA + a, navirA, V, a * navirA * navirA + b * navirA, 1,
-                                1.0);
-                    }
-                }
+#pragma omp parallel for schedule(dynamic) reduction(+ : sum)
+    for (long int ijk = 0; ijk < Nijk; ++ijk) {
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+        long int i = ijk_list[ijk] / (naoccA * naoccA);
+        long int j = (ijk_list[ijk] / naoccA) % naoccA;
+        long int k = ijk_list[ijk] % naoccA;
+        SharedTensor2d W = W_thread[thread];
+        SharedTensor2d V = V_thread[thread];
+
+        SharedTensor2d J1 = get_slice(thread, 0, i);
+        SharedTensor2d J2 = get_slice(thread, 1, j);
+        SharedTensor2d J3 = get_slice(thread, 2, k);
+
+        // W[ijk](ab,c) = \sum(e) t_jk^ec (ia|be) (1+)
+        // W[ijk](ab,c) = \sum(e) J[i](ab,e) T[jk](ec)
+        W->contract(false, false, navirA * navirA, navirA, navirA, J1, T, 0,
+                    (j * naoccA * navirA * navirA) + (k * navirA * navirA), 1.0, 0.0);
+
+        // W[ijk](ab,c) -= \sum(m) t_im^ab <jk|mc> (1-)
+        // W[ijk](ab,c) -= \sum(m) T[i](m,ab) I[jk](mc)
+        W->contract(true, false, navirA * navirA, navirA, naoccA, T, I, i * naoccA * navirA * navirA,
+                    (j * naoccA * naoccA * navirA) + (k * naoccA * navirA), -1.0, 1.0);
+
+        // W[ijk](ac,b) = \sum(e) t_kj^eb (ia|ce) (2+)
+        // W[ijk](ac,b) = \sum(e) J[i](ac,e) T[kj](eb)
+        V->contract(false, false, navirA * navirA, navirA, navirA, J1, T, 0,
+                    (k * naoccA * navirA * navirA) + (j * navirA * navirA), 1.0, 0.0);
+
+        // W[ijk](ac,b) -= \sum(m) t_im^ac <kj|mb> (2-)
+        // W[ijk](ac,b) -= \sum(m) T[i](m,ac) I[kj](mb)
+        V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, i * naoccA * navirA * navirA,
+                    (k * naoccA * naoccA * navirA) + (j * naoccA * navirA), -1.0, 1.0);
+        for (long int a = 0; a < navirA; ++a) {
+            for (long int b = 0; b < navirA; ++b) {
+                W->axpy((size_t)navirA, a * navirA * navirA + b, navirA, V, a * navirA * navirA + b * navirA, 1, 1.0);
+            }
+        }
 
-                // W[ijk](ca,b) = \sum(e) t_ij^eb (kc|ae) (5+)
-                // W[ijk](ca,b) = \sum(e) J[k](ca,e) T[ij](eb)
-                V->contract(false, false, navirA * navirA, navirA, navirA, J3, T, 0,
-                            (i * naoccA * navirA * navirA) + (j * navirA * navirA), 1.0, 0.0);
+        // W[ijk](ba,c) = \sum(e) t_ik^ec (jb|ae) (3+)
+        // W[ijk](ba,c) = \sum(e) J[j](ba,e) T[ik](ec)
+        V->contract(false, false, navirA * navirA, navirA, navirA, J2, T, 0,
+                    (i * naoccA * navirA * navirA) + (k * navirA * navirA), 1.0, 0.0);
+
+        // W[ijk](ba,c) -= \sum(m) t_jm^ba <ik|mc> (3-)
+        // W[ijk](ba,c) -= \sum(m) T[j](m,ba) I[ik](mc)
+        V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, j * naoccA * navirA * navirA,
+                    (i * naoccA * naoccA * navirA) + (k * naoccA * navirA), -1.0, 1.0);
+        for (long int a = 0; a < navirA; ++a) {
+            for (long int b = 0; b < navirA; ++b) {
+                W->axpy((size_t)navirA, b * navirA * navirA + a * navirA, 1, V, a * navirA * navirA + b * navirA, 1,
+                        1.0);
+            }
+        }
 
-                // W[ijk](ca,b) -= \sum(m) t_km^ca <ij|mb> (5-)
-                // W[ijk](ca,b) -= \sum(m) T[k](m,ca) I[ij](mb)
-                V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, k * naoccA * navirA * navirA,
-                            (i * naoccA * naoccA * navirA) + (j * naoccA * navirA), -1.0, 1.0);
-#pragma omp parallel for
-                for (long int a = 0; a < navirA; ++a) {
-                    for (long int b = 0; b < navirA; ++b) {
-                        W->axpy((size_t)navirA, a * navirA + b, navirA * navirA, V, a * navirA * navirA + b * navirA, 1,
-                                1.0);
-                    }
-                }
+        // W[ijk](bc,a) = \sum(e) t_ki^ea (jb|ce) (4+)
+        // W[ijk](bc,a) = \sum(e) J[j](bc,e) T[ki](ea)
+        V->contract(false, false, navirA * navirA, navirA, navirA, J2, T, 0,
+                    (k * naoccA * navirA * navirA) + (i * navirA * navirA), 1.0, 0.0);
+
+        // W[ijk](bc,a) -= \sum(m) t_jm^bc <ki|ma> (4-)
+        // W[ijk](bc,a) -= \sum(m) T[j](m,bc) I[ki](ma)
+        V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, j * naoccA * navirA * navirA,
+                    (k * naoccA * naoccA * navirA) + (i * naoccA * navirA), -1.0, 1.0);
+        for (long int a = 0; a < navirA; ++a) {
+            for (long int b = 0; b < navirA; ++b) {
+                W->axpy((size_t)navirA, b * navirA * navirA + a, navirA, V, a * navirA * navirA + b * navirA, 1, 1.0);
+            }
+        }
 
-                // W[ijk](cb,a) = \sum(e) t_ji^ea (kc|be) (6+)
-                // W[ijk](cb,a) = \sum(e) J[k](cb,e) T[ji](ea)
-                V->contract(false, false, navirA * navirA, navirA, navirA, J3, T, 0,
-                            (j * naoccA * navirA * navirA) + (i * navirA * navirA), 1.0, 0.0);
+        // W[ijk](ca,b) = \sum(e) t_ij^eb (kc|ae) (5+)
+        // W[ijk](ca,b) = \sum(e) J[k](ca,e) T[ij](eb)
+        V->contract(false, false, navirA * navirA, navirA, navirA, J3, T, 0,
+                    (i * naoccA * navirA * navirA) + (j * navirA * navirA), 1.0, 0.0);
+
+        // W[ijk](ca,b) -= \sum(m) t_km^ca <ij|mb> (5-)
+        // W[ijk](ca,b) -= \sum(m) T[k](m,ca) I[ij](mb)
+        V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, k * naoccA * navirA * navirA,
+                    (i * naoccA * naoccA * navirA) + (j * naoccA * navirA), -1.0, 1.0);
+        for (long int a = 0; a < navirA; ++a) {
+            for (long int b = 0; b < navirA; ++b) {
+                W->axpy((size_t)navirA, a * navirA + b, navirA * navirA, V, a * navirA * navirA + b * navirA, 1, 1.0);
+            }
+        }
 
-                // W[ijk](cb,a) -= \sum(m) t_km^cb <ji|ma> (6-)
-                // W[ijk](cb,a) -= \sum(m) T[k](m,cb) I[ji](ma)
-                V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, k * naoccA * navirA * navirA,
-                            (j * naoccA * naoccA * navirA) + (i * naoccA * navirA), -1.0, 1.0);
-#pragma omp parallel for
-                for (long int a = 0; a < navirA; ++a) {
-                    for (long int b = 0; b < navirA; ++b) {
-                        W->axpy((size_t)navirA, b * navirA + a, navirA * navirA, V, a * navirA * navirA + b * navirA, 1,
-                                1.0);
-                    }
-                }
+        // W[ijk](cb,a) = \sum(e) t_ji^ea (kc|be) (6+)
+        // W[ijk](cb,a) = \sum(e) J[k](cb,e) T[ji](ea)
+        V->contract(false, false, navirA * navirA, navirA, navirA, J3, T, 0,
+                    (j * naoccA * navirA * navirA) + (i * navirA * navirA), 1.0, 0.0);
+
+        // W[ijk](cb,a) -= \sum(m) t_km^cb <ji|ma> (6-)
+        // W[ijk](cb,a) -= \sum(m) T[k](m,cb) I[ji](ma)
+        V->contract(true, false, navirA * navirA, navirA, naoccA, T, I, k * naoccA * navirA * navirA,
+                    (j * naoccA * naoccA * navirA) + (i * naoccA * navirA), -1.0, 1.0);
+        for (long int a = 0; a < navirA; ++a) {
+            for (long int b = 0; b < navirA; ++b) {
+                W->axpy((size_t)navirA, b * navirA + a, navirA * navirA, V, a * navirA * navirA + b * navirA, 1, 1.0);
+            }
+        }
 
-                // V[ijk](ab,c) = W[ijk](ab,c)
-                V->copy(W);
+        // V[ijk](ab,c) = W[ijk](ab,c)
+        V->copy(W);
 
-// V[ijk](ab,c) += t_i^a (jb|kc) + t_j^b (ia|kc) + t_k^c (ia|jb)
-// Vt[ijk](ab,c) = V[ijk](ab,c) / (1 + \delta(abc))
-#pragma omp parallel for
-                for (long int a = 0; a < navirA; ++a) {
-                    long int ia = ia_idxAA->get(i, a);
-                    for (long int b = 0; b < navirA; ++b) {
-                        long int jb = ia_idxAA->get(j, b);
-                        long int ab = ab_idxAA->get(a, b);
-                        for (long int c = 0; c < navirA; ++c) {
-                            long int kc = ia_idxAA->get(k, c);
-                            double value = V->get(ab, c) + (t1A->get(i, a) * J->get(jb, kc)) +
-                                           (t1A->get(j, b) * J->get(ia, kc)) + (t1A->get(k, c) * J->get(ia, jb));
-                            double denom = 1 + ((a == b) + (b == c) + (a == c));
-                            V->set(ab, c, value / denom);
-                        }
-                    }
+        // V[ijk](ab,c) += t_i^a (jb|kc) + t_j^b (ia|kc) + t_k^c (ia|jb)
+        // Vt[ijk](ab,c) = V[ijk](ab,c) / (1 + \delta(abc))
+        for (long int a = 0; a < navirA; ++a) {
+            long int ia = ia_idxAA->get(i, a);
+            for (long int b = 0; b < navirA; ++b) {
+                long int jb = ia_idxAA->get(j, b);
+                long int ab = ab_idxAA->get(a, b);
+                for (long int c = 0; c < navirA; ++c) {
+                    long int kc = ia_idxAA->get(k, c);
+                    double value = V->get(ab, c) + (t1A->get(i, a) * J->get(jb, kc)) +
+                                   (t1A->get(j, b) * J->get(ia, kc)) + (t1A->get(k, c) * J->get(ia, jb));
+                    double denom = 1 + ((a == b) + (b == c) + (a == c));
+                    V->set(ab, c, value / denom);
                 }
+            }
+        }
 
-                // Denom
-                double Dijk = Dij + FockA->get(k + nfrzc, k + nfrzc);
-                double factor = 2 - ((i == j) + (j == k) + (i == k));
-
-                // Compute energy
-                double Xvalue, Yvalue, Zvalue;
-#pragma omp parallel for private(Xvalue, Yvalue, Zvalue) reduction(+ : sum)
-                for (long int a = 0; a < navirA; ++a) {
-                    double Dijka = Dijk - FockA->get(a + noccA, a + noccA);
-                    for (long int b = 0; b <= a; ++b) {
-                        double Dijkab = Dijka - FockA->get(b + noccA, b + noccA);
-                        long int ab = ab_idxAA->get(a, b);
-                        long int ba = ab_idxAA->get(b, a);
-                        for (long int c = 0; c <= b; ++c) {
-                            long int ac = ab_idxAA->get(a, c);
-                            long int bc = ab_idxAA->get(b, c);
-                            long int ca = ab_idxAA->get(c, a);
-                            long int cb = ab_idxAA->get(c, b);
-
-                            // X_ijk^abc
-                            Xvalue = (W->get(ab, c) * V->get(ab, c)) + (W->get(ac, b) * V->get(ac, b)) +
-                                     (W->get(ba, c) * V->get(ba, c)) + (W->get(bc, a) * V->get(bc, a)) +
-                                     (W->get(ca, b) * V->get(ca, b)) + (W->get(cb, a) * V->get(cb, a));
-
-                            // Y_ijk^abc
-                            Yvalue = V->get(ab, c) + V->get(bc, a) + V->get(ca, b);
-
-                            // Z_ijk^abc
-                            Zvalue = V->get(ac, b) + V->get(ba, c) + V->get(cb, a);
-
-                            // contributions to energy
-                            double value = (Yvalue - (2.0 * Zvalue)) * (W->get(ab, c) + W->get(bc, a) + W->get(ca, b));
-                            value += (Zvalue - (2.0 * Yvalue)) * (W->get(ac, b) + W->get(ba, c) + W->get(cb, a));
-                            value += 3.0 * Xvalue;
-                            double Dijkabc = Dijkab - FockA->get(c + noccA, c + noccA);
-                            sum += (value * factor) / Dijkabc;
-                        }
-                    }
+        // Denom
+        double Dijk = FockA->get(i + nfrzc, i + nfrzc) + FockA->get(j + nfrzc, j + nfrzc) +
+                      FockA->get(k + nfrzc, k + nfrzc);
+        double factor = 2 - ((i == j) + (j == k) + (i == k));
+
+        // Compute energy
+        for (long int a = 0; a < navirA; ++a) {
+            double Dijka = Dijk - FockA->get(a + noccA, a + noccA);
+            for (long int b = 0; b <= a; ++b) {
+                double Dijkab = Dijka - FockA->get(b + noccA, b + noccA);
+                long int ab = ab_idxAA->get(a, b);
+                long int ba = ab_idxAA->get(b, a);
+                for (long int c = 0; c <= b; ++c) {
+                    long int ac = ab_idxAA->get(a, c);
+                    long int bc = ab_idxAA->get(b, c);
+                    long int ca = ab_idxAA->get(c, a);
+                    long int cb = ab_idxAA->get(c, b);
+
+                    // X_ijk^abc
+                    double Xvalue = (W->get(ab, c) * V->get(ab, c)) + (W->get(ac, b) * V->get(ac, b)) +
+                                    (W->get(ba, c) * V->get(ba, c)) + (W->get(bc, a) * V->get(bc, a)) +
+                                    (W->get(ca, b) * V->get(ca, b)) + (W->get(cb, a) * V->get(cb, a));
+
+                    // Y_ijk^abc
+                    double Yvalue = V->get(ab, c) + V->get(bc, a) + V->get(ca, b);
+
+                    // Z_ijk^abc
+                    double Zvalue = V->get(ac, b) + V->get(ba, c) + V->get(cb, a);
+
+                    // contributions to energy
+                    double value = (Yvalue - (2.0 * Zvalue)) * (W->get(ab, c) + W->get(bc, a) + W->get(ca, b));
+                    value += (Zvalue - (2.0 * Yvalue)) * (W->get(ac, b) + W->get(ba, c) + W->get(cb, a));
+                    value += 3.0 * Xvalue;
+                    double Dijkabc = Dijkab - FockA->get(c + noccA, c + noccA);
+                    sum += (value * factor) / Dijkabc;
                 }
+            }
+        }
+    }  // ijk
+    outfile->Printf("\tNumber of (ia|bc) slice builds: %zu \n", Jcache.misses());
 
-            }  // k
-        }      // j
-    }          // i
     T.reset();
     J.reset();
-    W.reset();
-    V.reset();
-    J1.reset();
-    J2.reset();
-    J3.reset();
     K.reset();
-    Jt.reset();
     L.reset();
     I.reset();
+    W_thread.clear();
+    V_thread.clear();
+    Jt_thread.clear();
 
     // set energy
     E_t = sum;
@@ -710,16 +710,24 @@ void FISAPT::scf() {
     WC->subtract(matrices_["KC"]);
     matrices_["WC"] = WC;
 
-    // => A <= //
+    // => A and B <= //
 
-    outfile->Printf("  ==> SCF A: <==\n\n");
     std::shared_ptr<Matrix> VA_SCF(matrices_["VA"]->clone());
     VA_SCF->copy(matrices_["VA"]);
     if (reference_->external_pot()) VA_SCF->add(matrices_["VE"]);
     std::shared_ptr<FISAPTSCF> scfA =
         std::make_shared<FISAPTSCF>(jk_, matrices_["E NUC"]->get(0, 0), matrices_["S"], matrices_["XC"], matrices_["T"],
                                     VA_SCF, matrices_["WC"], matrices_["LoccA"], options_);
-    scfA->compute_energy();
+
+    std::shared_ptr<Matrix> VB_SCF(matrices_["VB"]->clone());
+    VB_SCF->copy(matrices_["VB"]);
+    if (reference_->external_pot()) VB_SCF->add(matrices_["VE"]);
+    std::shared_ptr<FISAPTSCF> scfB =
+        std::make_shared<FISAPTSCF>(jk_, matrices_["E NUC"]->get(1, 1), matrices_["S"], matrices_["XC"], matrices_["T"],
+                                    VB_SCF, matrices_["WC"], matrices_["LoccB"], options_);
+
+    outfile->Printf("  ==> SCF A and B: <==\n\n");
+    FISAPTSCF::compute_energies(jk_, {scfA, scfB}, {"A", "B"});
 
     scalars_["E0 A"] = scfA->scalars()["E SCF"];
     matrices_["Cocc0A"] = scfA->matrices()["Cocc"];
@@ -729,17 +737,6 @@ void FISAPT::scf() {
     vectors_["eps_occ0A"] = scfA->vectors()["eps_occ"];
     vectors_["eps_vir0A"] = scfA->vectors()["eps_vir"];
 
-    // => B <= //
-
-    outfile->Printf("  ==> SCF B: <==\n\n");
-    std::shared_ptr<Matrix> VB_SCF(matrices_["VB"]->clone());
-    VB_SCF->copy(matrices_["VB"]);
-    if (reference_->external_pot()) VB_SCF->add(matrices_["VE"]);
-    std::shared_ptr<FISAPTSCF> scfB =
-        std::make_shared<FISAPTSCF>(jk_, matrices_["E NUC"]->get(1, 1), matrices_["S"], matrices_["XC"], matrices_["T"],
-                                    VB_SCF, matrices_["WC"], matrices_["LoccB"], options_);
-    scfB->compute_energy();
-
     scalars_["E0 B"] = scfB->scalars()["E SCF"];
     matrices_["Cocc0B"] = scfB->matrices()["Cocc"];
     matrices_["Cvir0B"] = scfB->matrices()["Cvir"];
@@ -4048,6 +4045,8 @@ void FISAPT::fdisp() {
     nT = Process::environment.get_n_threads();
 #endif
 
+    bool do_ssapt0 = options_.get_bool("SSAPT0_SCALE");
+
     // => Targets <= //
 
     matrices_["Disp_AB"] = std::make_shared<Matrix>("Disp_AB", nA + nfa + na, nB + nfb + nb);
@@ -4060,7 +4059,7 @@ void FISAPT::fdisp() {
     int snfb = 0;
     int snb = 0;
 
-    if (options_.get_bool("SSAPT0_SCALE")) {
+    if (do_ssapt0) {
         snA = nA;
         snfa = nfa;
         sna = na;
@@ -4246,10 +4245,34 @@ void FISAPT::fdisp() {
         ncol += (size_t)mat->ncol();
     }
 
+    // => Memory Budget <= //
+
+    // Static: thread work arrays, thread targets, and the (ov) intermediates
+    long int overhead = 0L;
+    overhead += 7L * nT * na * nb;
+    overhead += 2L * na * ns + 2L * nb * nr + 2L * na * nr + 2L * nb * ns;
+    overhead += (long int)Cs[0]->nrow() * ncol;
+
+    // Dynamic: one r and one s slice of the A/B/C/D tensors
+    long int cost_r = 2L * na * nQ + 2L * nb * nQ;
+    long int min_slices = 2L * cost_r;
+    long int all_slices = 2L * cost_r * std::max(nr, ns);
+
+    // The transformed (ov|Q) integrals are kept in core when everything fits
+    // in one block, otherwise they are streamed from DFHelper's disk tensors
+    long int MO_size = (long int)nQ * (nr * (3L * na + 2L * nb) + ns * (3L * nb + 2L * na));
+    bool MO_core = ((long int)doubles_ - overhead - MO_size - all_slices >= 0L);
+
+    long int dfh_mem = (long int)doubles_ - overhead - (MO_core ? MO_size + all_slices : min_slices);
+    if (dfh_mem < 0L) {
+        throw PSIEXCEPTION("Too little static memory for FISAPT::fdisp");
+    }
+
     auto dfh(std::make_shared<DFHelper>(primary_, auxiliary));
-    dfh->set_memory(doubles_ - Cs[0]->nrow() * ncol);
+    dfh->set_memory(dfh_mem);
     dfh->set_method("DIRECT_iaQ");
     dfh->set_nthreads(nT);
+    dfh->set_MO_core(MO_core);
     dfh->initialize();
     dfh->print_header();
 
@@ -4292,24 +4315,24 @@ void FISAPT::fdisp() {
 
     // => Blocking <= //
 
-    long int overhead = 0L;
-    overhead += 5L * nT * na * nb;
-    overhead += 2L * na * ns + 2L * nb * nr + 2L * na * nr + 2L * nb * ns;
-    long int rem = doubles_ - overhead;
-
-    if (rem < 0L) {
-        throw PSIEXCEPTION("Too little static memory for DFTSAPT::mp2_terms");
-    }
+    // Whatever DFHelper did not claim (in-core AO or MO integrals) goes to the slices
+    long int rem = (long int)doubles_ - overhead;
+    if (dfh->get_AO_core()) rem -= dfh->get_core_size();
+    if (MO_core) rem -= MO_size;
 
-    long int cost_r = 2L * na * nQ + 2L * nb * nQ;
     long int max_r = rem / (2L * cost_r);
     long int max_s = max_r;
     max_r = (max_r > nr ? nr : max_r);
     max_s = (max_s > ns ? ns : max_s);
     if (max_r < 1L || max_s < 1L) {
-        throw PSIEXCEPTION("Too little dynamic memory for DFTSAPT::mp2_terms");
+        throw PSIEXCEPTION("Too little dynamic memory for FISAPT::fdisp");
     }
 
+    outfile->Printf("    MO Integrals in Core = %11s\n", (MO_core ? "True" : "False"));
+    outfile->Printf("    Virtual Block Size   = %11ld\n", max_r);
+    outfile->Printf("    Number of Blocks     = %11ld\n", ((nr + max_r - 1) / max_r) * ((ns + max_s - 1) / max_s));
+    outfile->Printf("\n");
+
     // => Tensor Slices <= //
 
     auto Aar = std::make_shared<Matrix>("Aar", max_r * na, nQ);
@@ -4404,13 +4427,12 @@ void FISAPT::fdisp() {
 
     // => Local Targets <= //
 
+    // The sSAPT0 orbital-pair matrix is a rescaling of E_exch_disp20, formed after the loop
     std::vector<std::shared_ptr<Matrix> > E_disp20_threads;
     std::vector<std::shared_ptr<Matrix> > E_exch_disp20_threads;
-    std::vector<std::shared_ptr<Matrix> > sE_exch_disp20_threads;
     for (int t = 0; t < nT; t++) {
         E_disp20_threads.push_back(std::make_shared<Matrix>("E_disp20", na, nb));
         E_exch_disp20_threads.push_back(std::make_shared<Matrix>("E_exch_disp20", na, nb));
-        sE_exch_disp20_threads.push_back(std::make_shared<Matrix>("sE_exch_disp20", sna, snb));
     }
 
     // => MO => LO Transform <= //
@@ -4421,7 +4443,7 @@ void FISAPT::fdisp() {
     // ==> Master Loop <== //
 
     double scale = 1.0;
-    if (options_.get_bool("SSAPT0_SCALE")) {
+    if (do_ssapt0) {
         scale = sSAPT0_scale_;
     }
 
@@ -4455,7 +4477,6 @@ void FISAPT::fdisp() {
 
                 double** E_disp20Tp = E_disp20_threads[thread]->pointer();
                 double** E_exch_disp20Tp = E_exch_disp20_threads[thread]->pointer();
-                double** sE_exch_disp20Tp = sE_exch_disp20_threads[thread]->pointer();
 
                 double** Tabp = Tab[thread]->pointer();
                 double** Vabp = Vab[thread]->pointer();
@@ -4506,8 +4527,6 @@ void FISAPT::fdisp() {
                 for (int a = 0; a < na; a++) {
                     for (int b = 0; b < nb; b++) {
                         E_exch_disp20Tp[a][b] -= 2.0 * T2abp[a][b] * V2abp[a][b];
-                        if (options_.get_bool("SSAPT0_SCALE"))
-                            sE_exch_disp20Tp[a][b] -= scale * 2.0 * T2abp[a][b] * V2abp[a][b];
                         ExchDisp20 -= 2.0 * T2abp[a][b] * V2abp[a][b];
                         sExchDisp20 -= scale * 2.0 * T2abp[a][b] * V2abp[a][b];
                     }
@@ -4532,7 +4551,7 @@ void FISAPT::fdisp() {
         }
     }
 
-    if (options_.get_bool("SSAPT0_SCALE")) {
+    if (do_ssapt0) {
         auto sE_exch_disp20 = std::make_shared<Matrix>("sE_exch_disp20", na, nb);
         sE_exch_disp20->copy(E_exch_disp20);
         double** sE_exch_disp20p = sE_exch_disp20->pointer();
@@ -4550,10 +4569,10 @@ void FISAPT::fdisp() {
 
     scalars_["Disp20"] = Disp20;
     scalars_["Exch-Disp20"] = ExchDisp20;
-    if (options_.get_bool("SSAPT0_SCALE")) scalars_["sExch-Disp20"] = sExchDisp20;
+    if (do_ssapt0) scalars_["sExch-Disp20"] = sExchDisp20;
     outfile->Printf("    Disp20              = %18.12lf [Eh]\n", Disp20);
     outfile->Printf("    Exch-Disp20         = %18.12lf [Eh]\n", ExchDisp20);
-    if (options_.get_bool("SSAPT0_SCALE")) outfile->Printf("    sExch-Disp20         = %18.12lf [Eh]\n", sExchDisp20);
+    if (do_ssapt0) outfile->Printf("    sExch-Disp20         = %18.12lf [Eh]\n", sExchDisp20);
     outfile->Printf("\n");
     // fflush(outfile);
 }
@@ -4588,14 +4607,7 @@ FISAPTSCF::FISAPTSCF(std::shared_ptr<JK> jk, double enuc, std::shared_ptr<Matrix
     matrices_["C0"] = C;
 }
 FISAPTSCF::~FISAPTSCF() {}
-void FISAPTSCF::compute_energy() {
-    // => Sizing <= //
-
-    int nbf = matrices_["X"]->rowspi()[0];
-    int nmo = matrices_["X"]->colspi()[0];
-    int nocc = matrices_["C0"]->colspi()[0];
-    int nvir = nmo - nocc;
-
+void FISAPTSCF::initialize(const std::string& diis_label) {
     // => One-electron potential <= //
 
     matrices_["H"] = std::shared_ptr<Matrix>(matrices_["T"]->clone());
@@ -4609,139 +4621,129 @@ void FISAPTSCF::compute_energy() {
     matrices_["F"] = std::shared_ptr<Matrix>(matrices_["T"]->clone());
     matrices_["F"]->set_name("F");
 
-    // => For Convenience <= //
-
-    std::shared_ptr<Matrix> H = matrices_["H"];
-    std::shared_ptr<Matrix> F = matrices_["F"];
-    std::shared_ptr<Matrix> S = matrices_["S"];
-    std::shared_ptr<Matrix> X = matrices_["X"];
-    std::shared_ptr<Matrix> W = matrices_["W"];
-
-    // matrices_["S"]->print();
-    // matrices_["X"]->print();
-    // matrices_["T"]->print();
-    // matrices_["V"]->print();
-    // matrices_["W"]->print();
-    // matrices_["C0"]->print();
-
     // => Guess <= //
 
-    std::shared_ptr<Matrix> Cocc2(matrices_["C0"]->clone());
-    Cocc2->copy(matrices_["C0"]);
-
-    // => Convergence Criteria <= //
-
-    int maxiter = options_.get_int("MAXITER");
-    double Etol = options_.get_double("E_CONVERGENCE");
-    double Gtol = options_.get_double("D_CONVERGENCE");
-    bool converged = false;
-    double Eold = 0.0;
-
-    outfile->Printf("    Maxiter = %11d\n", maxiter);
-    outfile->Printf("    E Tol   = %11.3E\n", Etol);
-    outfile->Printf("    D Tol   = %11.3E\n", Gtol);
-    outfile->Printf("\n");
+    Cocc_ = std::shared_ptr<Matrix>(matrices_["C0"]->clone());
+    Cocc_->copy(matrices_["C0"]);
 
     // => DIIS Setup <= //
 
-    int max_diis_vectors = options_.get_int("DIIS_MAX_VECS");
-    outfile->Printf("    Max DIIS Vectors = %d\n", max_diis_vectors);
-    outfile->Printf("\n");
-
-    bool diised = false;
+    int nmo = matrices_["X"]->colspi()[0];
     auto Gsize = std::make_shared<Matrix>("Gsize", nmo, nmo);
-    auto diis = std::make_shared<DIISManager>(max_diis_vectors, "FISAPT DIIS");
-    diis->set_error_vector_size(1, DIISEntry::Matrix, Gsize.get());
-    diis->set_vector_size(1, DIISEntry::Matrix, F.get());
-    Gsize.reset();
+    diis_ = std::make_shared<DIISManager>(options_.get_int("DIIS_MAX_VECS"), diis_label);
+    diis_->set_error_vector_size(1, DIISEntry::Matrix, Gsize.get());
+    diis_->set_vector_size(1, DIISEntry::Matrix, matrices_["F"].get());
+
+    Eold_ = 0.0;
+    Ediff_ = 0.0;
+    Gnorm_ = 0.0;
+    diised_ = false;
+    converged_ = false;
+}
+void FISAPTSCF::print_criteria() {
+    outfile->Printf("    Maxiter = %11d\n", options_.get_int("MAXITER"));
+    outfile->Printf("    E Tol   = %11.3E\n", options_.get_double("E_CONVERGENCE"));
+    outfile->Printf("    D Tol   = %11.3E\n", options_.get_double("D_CONVERGENCE"));
+    outfile->Printf("\n");
 
-    // ==> Master Loop <== //
+    outfile->Printf("    Max DIIS Vectors = %d\n", options_.get_int("DIIS_MAX_VECS"));
+    outfile->Printf("\n");
+}
+bool FISAPTSCF::iterate(std::shared_ptr<Matrix> J, std::shared_ptr<Matrix> K) {
+    // => Sizing <= //
 
-    outfile->Printf("    Iter %3s: %24s %11s %11s\n", "N", "E", "dE", "|D|");
-    for (int iter = 1; iter <= maxiter; iter++) {
-        // => Compute Density Matrix <= //
+    int nbf = matrices_["X"]->rowspi()[0];
+    int nmo = matrices_["X"]->colspi()[0];
+    int nocc = matrices_["C0"]->colspi()[0];
 
-        std::shared_ptr<Matrix> D = linalg::doublet(Cocc2, Cocc2, false, true);
+    // => For Convenience <= //
 
-        // => Compute Fock Matrix <= //
+    std::shared_ptr<Matrix> H = matrices_["H"];
+    std::shared_ptr<Matrix> F = matrices_["F"];
+    std::shared_ptr<Matrix> S = matrices_["S"];
+    std::shared_ptr<Matrix> X = matrices_["X"];
+    std::shared_ptr<Matrix> W = matrices_["W"];
 
-        std::vector<SharedMatrix>& Cl = jk_->C_left();
-        std::vector<SharedMatrix>& Cr = jk_->C_right();
+    // => Density Matrix (from the orbitals J and K were built with) <= //
 
-        const std::vector<SharedMatrix>& Js = jk_->J();
-        const std::vector<SharedMatrix>& Ks = jk_->K();
+    std::shared_ptr<Matrix> D = linalg::doublet(Cocc_, Cocc_, false, true);
 
-        Cl.clear();
-        Cr.clear();
+    // => Keep J and K, the JK object reuses its buffers on the next call <= //
 
-        Cl.push_back(Cocc2);
-        Cr.push_back(Cocc2);
+    matrices_["J"] = std::shared_ptr<Matrix>(J->clone());
+    matrices_["K"] = std::shared_ptr<Matrix>(K->clone());
+    matrices_["J"]->set_name("J");
+    matrices_["K"]->set_name("K");
 
-        jk_->compute();
+    // => Compute Fock Matrix <= //
 
-        std::shared_ptr<Matrix> J = Js[0];
-        std::shared_ptr<Matrix> K = Ks[0];
+    F->copy(H);
+    F->add(W);
+    F->add(J);
+    F->add(J);
+    F->subtract(K);
 
-        F->copy(H);
-        F->add(W);
-        F->add(J);
-        F->add(J);
-        F->subtract(K);
+    // => Compute Energy <= //
 
-        // => Compute Energy <= //
+    double E = scalars_["E NUC"] + D->vector_dot(H) + D->vector_dot(F) + D->vector_dot(W);
+    Ediff_ = E - Eold_;
+    scalars_["E SCF"] = E;
 
-        double E = scalars_["E NUC"] + D->vector_dot(H) + D->vector_dot(F) + D->vector_dot(W);
-        double Ediff = E - Eold;
-        scalars_["E SCF"] = E;
+    // => Compute Orbital Gradient <= //
 
-        // => Compute Orbital Gradient <= //
+    std::shared_ptr<Matrix> G1 = linalg::triplet(F, D, S);
+    std::shared_ptr<Matrix> G2 = linalg::triplet(S, D, F);
+    G1->subtract(G2);
+    std::shared_ptr<Matrix> G3 = linalg::triplet(X, G1, X, true, false, false);
+    Gnorm_ = G3->rms();
 
-        std::shared_ptr<Matrix> G1 = linalg::triplet(F, D, S);
-        std::shared_ptr<Matrix> G2 = linalg::triplet(S, D, F);
-        G1->subtract(G2);
-        std::shared_ptr<Matrix> G3 = linalg::triplet(X, G1, X, true, false, false);
-        double Gnorm = G3->rms();
+    // => Check Convergence <= //
 
-        // => Print and Check Convergence <= //
+    if (std::fabs(Ediff_) < options_.get_double("E_CONVERGENCE") &&
+        std::fabs(Gnorm_) < options_.get_double("D_CONVERGENCE")) {
+        converged_ = true;
+        return true;
+    }
 
-        outfile->Printf("    Iter %3d: %24.16E %11.3E %11.3E %s\n", iter, E, Ediff, Gnorm, (diised ? "DIIS" : ""));
+    Eold_ = E;
 
-        if (std::fabs(Ediff) < Etol && std::fabs(Gnorm) < Gtol) {
-            converged = true;
-            break;
-        }
+    // => DIIS <= //
 
-        Eold = E;
+    diis_->add_entry(2, G3.get(), F.get());
+    diised_ = diis_->extrapolate(1, F.get());
 
-        // => DIIS <= //
+    // => Diagonalize Fock Matrix <= //
 
-        diis->add_entry(2, G3.get(), F.get());
-        diised = diis->extrapolate(1, F.get());
+    std::shared_ptr<Matrix> F2 = linalg::triplet(X, F, X, true, false, false);
+    auto U2 = std::make_shared<Matrix>("C", nmo, nmo);
+    auto e2 = std::make_shared<Vector>("eps", nmo);
+    F2->diagonalize(U2, e2, ascending);
+    std::shared_ptr<Matrix> C = linalg::doublet(X, U2, false, false);
 
-        // => Diagonalize Fock Matrix <= //
+    // => Assign New Orbitals <= //
 
-        std::shared_ptr<Matrix> F2 = linalg::triplet(X, F, X, true, false, false);
-        auto U2 = std::make_shared<Matrix>("C", nmo, nmo);
-        auto e2 = std::make_shared<Vector>("eps", nmo);
-        F2->diagonalize(U2, e2, ascending);
-        std::shared_ptr<Matrix> C = linalg::doublet(X, U2, false, false);
+    double** Coccp = Cocc_->pointer();
+    double** Cp = C->pointer();
+    for (int m = 0; m < nbf; m++) {
+        for (int i = 0; i < nocc; i++) {
+            Coccp[m][i] = Cp[m][i];
+        }
+    }
 
-        // => Assign New Orbitals <= //
+    matrices_["C"] = C;
+    vectors_["eps"] = e2;
 
-        double** Coccp = Cocc2->pointer();
-        double** Cp = C->pointer();
-        for (int m = 0; m < nbf; m++) {
-            for (int i = 0; i < nocc; i++) {
-                Coccp[m][i] = Cp[m][i];
-            }
-        }
+    return false;
+}
+void FISAPTSCF::finalize() {
+    // => Sizing <= //
 
-        matrices_["C"] = C;
-        vectors_["eps"] = e2;
-    }
-    outfile->Printf("\n");
+    int nbf = matrices_["X"]->rowspi()[0];
+    int nmo = matrices_["X"]->colspi()[0];
+    int nocc = matrices_["C0"]->colspi()[0];
+    int nvir = nmo - nocc;
 
-    if (converged) {
+    if (converged_) {
         outfile->Printf("    FISAPTSCF Converged.\n\n");
     } else {
         outfile->Printf("    FISAPTSCF Failed.\n\n");
@@ -4791,15 +4793,8 @@ void FISAPTSCF::compute_energy() {
     matrices_["Cocc"] = Cocc;
     matrices_["Cvir"] = Cvir;
 
-    const std::vector<SharedMatrix>& Js = jk_->J();
-    const std::vector<SharedMatrix>& Ks = jk_->K();
-
-    matrices_["J"] = std::shared_ptr<Matrix>(Js[0]->clone());
-    matrices_["K"] = std::shared_ptr<Matrix>(Ks[0]->clone());
-    matrices_["J"]->copy(Js[0]);
-    matrices_["K"]->copy(Ks[0]);
-    matrices_["J"]->set_name("J");
-    matrices_["K"]->set_name("K");
+    diis_.reset();
+    Cocc_.reset();
 
     // => Print Final Info <= //
 
@@ -4808,6 +4803,101 @@ void FISAPTSCF::compute_energy() {
     print_orbitals("Occupied Orbital Energies", 1, eps_occ);
     print_orbitals("Virtual Orbital Energies", nocc + 1, eps_vir);
 }
+void FISAPTSCF::compute_energy() {
+    initialize("FISAPT DIIS");
+    print_criteria();
+
+    // ==> Master Loop <== //
+
+    int maxiter = options_.get_int("MAXITER");
+
+    std::vector<SharedMatrix>& Cl = jk_->C_left();
+    std::vector<SharedMatrix>& Cr = jk_->C_right();
+    const std::vector<SharedMatrix>& Js = jk_->J();
+    const std::vector<SharedMatrix>& Ks = jk_->K();
+
+    outfile->Printf("    Iter %3s: %24s %11s %11s\n", "N", "E", "dE", "|D|");
+    for (int iter = 1; iter <= maxiter; iter++) {
+        Cl.clear();
+        Cr.clear();
+        Cl.push_back(Cocc_);
+        Cr.push_back(Cocc_);
+
+        jk_->compute();
+
+        bool diised = diised_;
+        bool done = iterate(Js[0], Ks[0]);
+
+        outfile->Printf("    Iter %3d: %24.16E %11.3E %11.3E %s\n", iter, scalars_["E SCF"], Ediff_, Gnorm_,
+                        (diised ? "DIIS" : ""));
+        if (done) break;
+    }
+    outfile->Printf("\n");
+
+    finalize();
+}
+void FISAPTSCF::compute_energies(std::shared_ptr<JK> jk, const std::vector<std::shared_ptr<FISAPTSCF> >& scfs,
+                                 const std::vector<std::string>& labels) {
+    size_t nscf = scfs.size();
+    if (nscf == 0) return;
+
+    for (size_t k = 0; k < nscf; k++) {
+        scfs[k]->initialize("FISAPT DIIS " + labels[k]);
+    }
+    scfs[0]->print_criteria();
+
+    // ==> Lockstep Master Loop <== //
+
+    // Every monomer that has not converged contributes its occupied orbitals to
+    // the same JK call, so the integrals are traversed once per iteration
+    int maxiter = scfs[0]->options_.get_int("MAXITER");
+
+    std::vector<SharedMatrix>& Cl = jk->C_left();
+    std::vector<SharedMatrix>& Cr = jk->C_right();
+    const std::vector<SharedMatrix>& Js = jk->J();
+    const std::vector<SharedMatrix>& Ks = jk->K();
+
+    outfile->Printf("    %-4s", "Iter");
+    for (size_t k = 0; k < nscf; k++) {
+        outfile->Printf(" %24s %11s ", ("E " + labels[k]).c_str(), ("|D| " + labels[k]).c_str());
+    }
+    outfile->Printf("\n");
+
+    std::vector<size_t> active;
+    for (size_t k = 0; k < nscf; k++) active.push_back(k);
+
+    for (int iter = 1; iter <= maxiter && !active.empty(); iter++) {
+        Cl.clear();
+        Cr.clear();
+        for (size_t k : active) {
+            Cl.push_back(scfs[k]->Cocc_);
+            Cr.push_back(scfs[k]->Cocc_);
+        }
+
+        jk->compute();
+
+        std::vector<size_t> remaining;
+        for (size_t ind = 0; ind < active.size(); ind++) {
+            size_t k = active[ind];
+            if (!scfs[k]->iterate(Js[ind], Ks[ind])) remaining.push_back(k);
+        }
+
+        outfile->Printf("    %-4d", iter);
+        for (size_t k = 0; k < nscf; k++) {
+            outfile->Printf(" %24.16E %11.3E%1s", scfs[k]->scalars_["E SCF"], scfs[k]->Gnorm_,
+                            (scfs[k]->converged_ ? "*" : " "));
+        }
+        outfile->Printf("\n");
+
+        active = remaining;
+    }
+    outfile->Printf("\n");
+
+    for (size_t k = 0; k < nscf; k++) {
+        outfile->Printf("  ==> SCF %s: <==\n\n", labels[k].c_str());
+        scfs[k]->finalize();
+    }
+}
 void FISAPTSCF::print_orbitals(const std::string& header, int start, std::shared_ptr<Vector> eps) {
     outfile->Printf("   => %s <=\n\n", header.c_str());
     outfile->Printf("    ");
@@ -42,6 +42,7 @@ namespace psi {
 class JK;
 class BasisSet;
 class DFHelper;
+class DIISManager;
 
 namespace fisapt {
 
@@ -178,6 +179,30 @@ class FISAPTSCF {
     /// Map of matrices
     std::map<std::string, std::shared_ptr<Matrix> > matrices_;
 
+    /// Current occupied orbitals [nbf x nocc]
+    std::shared_ptr<Matrix> Cocc_;
+    /// DIIS extrapolator
+    std::shared_ptr<DIISManager> diis_;
+    /// Energy of the previous iteration
+    double Eold_;
+    /// Energy change of the last iteration
+    double Ediff_;
+    /// Orbital gradient RMS of the last iteration
+    double Gnorm_;
+    /// Was the last Fock matrix extrapolated?
+    bool diised_;
+    /// Has this SCF converged?
+    bool converged_;
+
+    /// Build H, the guess and the DIIS object
+    void initialize(const std::string& diis_label);
+    /// Print the convergence criteria
+    void print_criteria();
+    /// One Roothaan step given J and K for Cocc_, returns true if converged
+    bool iterate(std::shared_ptr<Matrix> J, std::shared_ptr<Matrix> K);
+    /// Post the final orbitals and print
+    void finalize();
+
     /// Print orbitals
     void print_orbitals(const std::string& header, int start, std::shared_ptr<Vector> eps);
 
@@ -195,6 +220,10 @@ class FISAPTSCF {
 
     void compute_energy();
 
+    /// Converge several SCFs in lockstep, sharing one JK call per iteration
+    static void compute_energies(std::shared_ptr<JK> jk, const std::vector<std::shared_ptr<FISAPTSCF> >& scfs,
+                                 const std::vector<std::string>& labels);
+
     std::map<std::string, double>& scalars() { return scalars_; }
     std::map<std::string, std::shared_ptr<Vector> >& vectors() { return vectors_; }
     std::map<std::string, std::shared_ptr<Matrix> >& matrices() { return matrices_; }
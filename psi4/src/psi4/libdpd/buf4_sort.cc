@@ -242,6 +242,7 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum
                 for (h = 0; h < nirreps; h++) {
                     r_irrep = h ^ my_irrep;
 
+#pragma omp parallel for private(p, q, r, s, rs, row, col, qp, sr) schedule(static)
                     for (pq = 0; pq < OutBuf.params->rowtot[h]; pq++) {
                         p = OutBuf.params->roworb[h][pq][0];
                         q = OutBuf.params->roworb[h][pq][1];
@@ -896,6 +897,7 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum
                 for (h = 0; h < nirreps; h++) {
                     r_irrep = h ^ my_irrep;
 
+#pragma omp parallel for private(p, q, r, s, rs, row, col, qp, sr) schedule(static)
                     for (pq = 0; pq < OutBuf.params->rowtot[h]; pq++) {
                         p = OutBuf.params->roworb[h][pq][0];
                         q = OutBuf.params->roworb[h][pq][1];
@@ -1020,6 +1022,7 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum
                 for (h = 0; h < nirreps; h++) {
                     r_irrep = h ^ my_irrep;
 
+#pragma omp parallel for private(p, q, r, s, rs, row, col, qp, sr) schedule(static)
                     for (pq = 0; pq < OutBuf.params->rowtot[h]; pq++) {
                         p = OutBuf.params->roworb[h][pq][0];
                         q = OutBuf.params->roworb[h][pq][1];
@@ -1585,6 +1588,7 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum
                 for (h = 0; h < nirreps; h++) {
                     r_irrep = h ^ my_irrep;
 
+#pragma omp parallel for private(p, q, r, s, rs, row, col, qp, sr) schedule(static)
                     for (pq = 0; pq < OutBuf.params->rowtot[h]; pq++) {
                         p = OutBuf.params->roworb[h][pq][0];
                         q = OutBuf.params->roworb[h][pq][1];
@@ -1623,6 +1627,7 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum
                 for (h = 0; h < nirreps; h++) {
                     r_irrep = h ^ my_irrep;
 
+#pragma omp parallel for private(p, q, r, s, rs, row, col, qp, sr) schedule(static)
                     for (pq = 0; pq < OutBuf.params->rowtot[h]; pq++) {
                         p = OutBuf.params->roworb[h][pq][0];
                         q = OutBuf.params->roworb[h][pq][1];
@@ -1783,6 +1788,7 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum
                 for (h = 0; h < nirreps; h++) {
                     r_irrep = h ^ my_irrep;
 
+#pragma omp parallel for private(p, q, r, s, rs, row, col, qp, sr) schedule(static)
                     for (pq = 0; pq < OutBuf.params->rowtot[h]; pq++) {
                         p = OutBuf.params->roworb[h][pq][0];
                         q = OutBuf.params->roworb[h][pq][1];
@@ -1820,6 +1826,7 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum
                 for (h = 0; h < nirreps; h++) {
                     r_irrep = h ^ my_irrep;
 
+#pragma omp parallel for private(p, q, r, s, rs, row, col, qp, sr) schedule(static)
                     for (pq = 0; pq < OutBuf.params->rowtot[h]; pq++) {
                         p = OutBuf.params->roworb[h][pq][0];
                         q = OutBuf.params->roworb[h][pq][1];
@@ -0,0 +1,111 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*! \file
+    \ingroup DPD
+    \brief Fused sorting of one DPD buffer into several targets
+*/
+
+#include "dpd.h"
+
+#include "psi4/libqt/qt.h"
+#include "psi4/psi4-dec.h"
+#include "psi4/libpsi4util/PsiOutStream.h"
+
+namespace psi {
+
+/*
+** dpd_buf4_sort_multi(): Sorts a single DPD buffer into several target
+** buffers using one read pass over the source data.
+**
+** A sequence of buf4_sort() calls on the same source re-reads every
+** symmetry block of the source from disk for each target.  Here the
+** source file4 is placed in the file4 cache and locked for the duration
+** of the sorts, so each subsequent buf4_sort() picks up the in-core
+** blocks instead of going back to libpsio.  The targets are processed in
+** the order given, so a later entry may use an earlier one as its own
+** source in a separate call.
+**
+** If there is not enough memory to hold the source alongside the
+** largest target, this falls back to independent buf4_sort() calls.
+**
+** Arguments:
+**   dpdbuf4 *InBuf: A pointer to the already-initialized input buffer.
+**   std::vector<dpdsorttarget> targets: The list of sorts to perform;
+**     each entry carries the arguments of the equivalent buf4_sort().
+*/
+
+int DPD::buf4_sort_multi(dpdbuf4 *InBuf, const std::vector<dpdsorttarget> &targets) {
+    int h, nirreps, my_irrep, cached;
+    long int srcsize, outsize, maxsize;
+
+#ifdef DPD_TIMER
+    timer_on("buf4_sort_multi");
+#endif
+
+    nirreps = InBuf->params->nirreps;
+    my_irrep = InBuf->file.my_irrep;
+
+    /* size of the source file4 and of the largest target */
+    srcsize = 0;
+    for (h = 0; h < nirreps; h++)
+        srcsize += ((long)InBuf->file.params->rowtot[h]) * ((long)InBuf->file.params->coltot[h ^ my_irrep]);
+
+    maxsize = 0;
+    for (const dpdsorttarget &target : targets) {
+        outsize = 0;
+        for (h = 0; h < nirreps; h++)
+            outsize += ((long)params4[target.pqnum][target.rsnum].rowtot[h]) *
+                       ((long)params4[target.pqnum][target.rsnum].coltot[h ^ my_irrep]);
+        if (outsize > maxsize) maxsize = outsize;
+    }
+
+    /* only cache the source if it (and the in-core sort) fits */
+    cached = 0;
+    if (targets.size() > 1 && !InBuf->file.incore && srcsize && (srcsize + 2 * maxsize) <= dpd_memfree()) {
+        file4_cache_add(&(InBuf->file), 0);
+        file4_cache_lock(&(InBuf->file));
+        cached = 1;
+    }
+
+    for (const dpdsorttarget &target : targets)
+        buf4_sort(InBuf, target.outfilenum, target.index, target.pqnum, target.rsnum, target.label.c_str());
+
+    if (cached) {
+        file4_cache_unlock(&(InBuf->file));
+        file4_cache_del(&(InBuf->file));
+    }
+
+#ifdef DPD_TIMER
+    timer_off("buf4_sort_multi");
+#endif
+
+    return 0;
+}
+
+}  // namespace psi
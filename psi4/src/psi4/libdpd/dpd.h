@@ -289,6 +289,15 @@ enum indices {
 /* Useful for the 3-index sorting function dpd_3d_sort() */
 enum pattern { abc, acb, cab, cba, bca, bac };
 
+/* One target of a fused buf4_sort_multi() pass */
+struct dpdsorttarget {
+    int outfilenum;     /* libpsio unit number of the target */
+    enum indices index; /* desired sorting pattern */
+    int pqnum;          /* bra index combination of the target */
+    int rsnum;          /* ket index combination of the target */
+    std::string label;  /* libpsio TOC keyword of the target */
+};
+
 class PSI_API DPD {
    public:
     // These used to live in the dpd_data struct
@@ -393,6 +402,7 @@ class PSI_API DPD {
     int buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum, int rsnum, const char *label);
     int buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index, std::string pq, std::string rs,
                   const char *label);
+    int buf4_sort_multi(dpdbuf4 *InBuf, const std::vector<dpdsorttarget> &targets);
     int buf4_sort_ooc(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum, int rsnum, const char *label);
     int buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index, int pqnum, int rsnum, const char *label,
                        double alpha);
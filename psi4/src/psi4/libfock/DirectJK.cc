@@ -47,6 +47,8 @@
 #include "psi4/libmints/integral.h"
 #include "psi4/lib3index/cholesky.h"
 
+#include <algorithm>
+#include <limits>
 #include <sstream>
 #include "psi4/libpsi4util/PsiOutStream.h"
 #ifdef _OPENMP
@@ -140,6 +142,44 @@ void DirectJK::build_JK(std::vector<std::shared_ptr<TwoBodyAOInt> >& ints, std::
         K[ind]->zero();
     }
 
+    // => Integrals and digestion <= //
+
+    // Engines that batch shell pairs (e.g. simint) only reach their full
+    // throughput through compute_shell_blocks. The blocked path accumulates
+    // into one J/K copy per thread, so fall back to the atomic task path
+    // when those copies do not fit in memory.
+    int nbf = primary_->nbf();
+    size_t blocked_memory = 2L * D.size() * (df_ints_num_threads_ - 1) * nbf * nbf;
+
+    size_t computed_shells;
+    if (ints[0]->blocks_batched() && blocked_memory <= memory_) {
+        computed_shells = build_JK_blocked(ints, D, J, K);
+    } else {
+        computed_shells = build_JK_tasks(ints, D, J, K);
+    }
+
+    for (size_t ind = 0; ind < D.size(); ind++) {
+        J[ind]->scale(2.0);
+        J[ind]->hermitivitize();
+        if (lr_symmetric_) {
+            K[ind]->scale(2.0);
+            K[ind]->hermitivitize();
+        }
+    }
+
+    if (bench_) {
+        auto mode = std::ostream::app;
+        auto printer = std::make_shared<PsiOutStream>("bench.dat", mode);
+        size_t nshell = primary_->nshell();
+        size_t ntri = nshell * (nshell + 1L) / 2L;
+        size_t possible_shells = ntri * (ntri + 1L) / 2L;
+        printer->Printf("Computed %20zu Shell Quartets out of %20zu, (%11.3E ratio)\n", computed_shells,
+                        possible_shells, computed_shells / (double)possible_shells);
+    }
+}
+size_t DirectJK::build_JK_tasks(std::vector<std::shared_ptr<TwoBodyAOInt> >& ints,
+                                std::vector<std::shared_ptr<Matrix> >& D, std::vector<std::shared_ptr<Matrix> >& J,
+                                std::vector<std::shared_ptr<Matrix> >& K) {
     // => Sizing <= //
 
     int nshell = primary_->nshell();
@@ -579,23 +619,178 @@ void DirectJK::build_JK(std::vector<std::shared_ptr<TwoBodyAOInt> >& ints, std::
 
     }  // End master task list
 
-    for (size_t ind = 0; ind < D.size(); ind++) {
-        J[ind]->scale(2.0);
-        J[ind]->hermitivitize();
-        if (lr_symmetric_) {
-            K[ind]->scale(2.0);
-            K[ind]->hermitivitize();
+    return computed_shells;
+}
+size_t DirectJK::build_JK_blocked(std::vector<std::shared_ptr<TwoBodyAOInt> >& ints,
+                                  std::vector<std::shared_ptr<Matrix> >& D, std::vector<std::shared_ptr<Matrix> >& J,
+                                  std::vector<std::shared_ptr<Matrix> >& K) {
+    // => Sizing <= //
+
+    int nbf = primary_->nbf();
+    int nthread = df_ints_num_threads_;
+
+    // All engines share the blocking of the first one
+    const std::vector<ShellPairBlock> blocks12 = ints[0]->get_blocks12();
+    const std::vector<ShellPairBlock> blocks34 = ints[0]->get_blocks34();
+    size_t nblock12 = blocks12.size();
+    size_t nblock34 = blocks34.size();
+
+    // => Block Screening <= //
+
+    // Only significant canonical pairs (P >= Q) are digested. The range of
+    // triangular pair indices in each block lets us skip block pairs whose
+    // quartets all lie above the (PQ| >= |RS) diagonal without computing them.
+    auto block_range = [&](const std::vector<ShellPairBlock>& blocks, std::vector<size_t>& lo,
+                           std::vector<size_t>& hi, std::vector<bool>& significant) {
+        for (size_t block = 0; block < blocks.size(); block++) {
+            lo[block] = std::numeric_limits<size_t>::max();
+            hi[block] = 0L;
+            significant[block] = false;
+            for (const auto& pair : blocks[block]) {
+                int P = pair.first;
+                int Q = pair.second;
+                if (Q > P || !sieve_->shell_pair_significant(P, Q)) continue;
+                size_t PQ = P * (P + 1L) / 2L + Q;
+                lo[block] = std::min(lo[block], PQ);
+                hi[block] = std::max(hi[block], PQ);
+                significant[block] = true;
+            }
+        }
+    };
+
+    std::vector<size_t> lo12(nblock12), hi12(nblock12), lo34(nblock34), hi34(nblock34);
+    std::vector<bool> significant12(nblock12), significant34(nblock34);
+    block_range(blocks12, lo12, hi12, significant12);
+    block_range(blocks34, lo34, hi34, significant34);
+
+    // Should the quartet (PQ|RS) of a computed block be digested?
+    auto quartet_needed = [&](int P, int Q, int R, int S) {
+        if (Q > P || S > R) return false;
+        if (R * (R + 1L) / 2L + S > P * (P + 1L) / 2L + Q) return false;
+        if (!sieve_->shell_pair_significant(P, Q) || !sieve_->shell_pair_significant(R, S)) return false;
+        return sieve_->shell_significant(P, Q, R, S);
+    };
+
+    // => Intermediate Buffers <= //
+
+    // Thread 0 accumulates straight into J and K
+    std::vector<std::vector<std::shared_ptr<Matrix> > > JT(nthread);
+    std::vector<std::vector<std::shared_ptr<Matrix> > > KT(nthread);
+    JT[0] = J;
+    KT[0] = K;
+    for (int thread = 1; thread < nthread; thread++) {
+        for (size_t ind = 0; ind < D.size(); ind++) {
+            JT[thread].push_back(std::make_shared<Matrix>("JT", nbf, nbf));
+            KT[thread].push_back(std::make_shared<Matrix>("KT", nbf, nbf));
         }
     }
 
-    if (bench_) {
-        auto mode = std::ostream::app;
-        auto printer = std::make_shared<PsiOutStream>("bench.dat", mode);
-        size_t ntri = nshell * (nshell + 1L) / 2L;
-        size_t possible_shells = ntri * (ntri + 1L) / 2L;
-        printer->Printf("Computed %20zu Shell Quartets out of %20zu, (%11.3E ratio)\n", computed_shells,
-                        possible_shells, computed_shells / (double)possible_shells);
+    size_t computed_shells = 0L;
+
+// ==> Master Block Loop <== //
+
+#pragma omp parallel for num_threads(nthread) schedule(dynamic) reduction(+ : computed_shells)
+    for (size_t block12 = 0L; block12 < nblock12; block12++) {
+        if (!significant12[block12]) continue;
+
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+
+        const ShellPairBlock& bra = blocks12[block12];
+
+        for (size_t block34 = 0L; block34 < nblock34; block34++) {
+            if (!significant34[block34] || lo34[block34] > hi12[block12]) continue;
+
+            const ShellPairBlock& ket = blocks34[block34];
+
+            bool needed = false;
+            for (const auto& PQ : bra) {
+                for (const auto& RS : ket) {
+                    if (quartet_needed(PQ.first, PQ.second, RS.first, RS.second)) {
+                        needed = true;
+                        break;
+                    }
+                }
+                if (needed) break;
+            }
+            if (!needed) continue;
+
+            ints[thread]->compute_shell_blocks(block12, block34);
+            const double* buffer = ints[thread]->buffer();
+
+            // => Digest the block, quartet by quartet in engine order <= //
+
+            for (const auto& PQ : bra) {
+                int P = PQ.first;
+                int Q = PQ.second;
+                int Psize = primary_->shell(P).nfunction();
+                int Qsize = primary_->shell(Q).nfunction();
+                int Poff = primary_->shell(P).function_index();
+                int Qoff = primary_->shell(Q).function_index();
+
+                for (const auto& RS : ket) {
+                    int R = RS.first;
+                    int S = RS.second;
+                    int Rsize = primary_->shell(R).nfunction();
+                    int Ssize = primary_->shell(S).nfunction();
+                    int Roff = primary_->shell(R).function_index();
+                    int Soff = primary_->shell(S).function_index();
+
+                    const double* quartet = buffer;
+                    buffer += (size_t)Psize * Qsize * Rsize * Ssize;
+                    if (!quartet_needed(P, Q, R, S)) continue;
+                    computed_shells++;
+
+                    double prefactor = 1.0;
+                    if (P == Q) prefactor *= 0.5;
+                    if (R == S) prefactor *= 0.5;
+                    if (P == R && Q == S) prefactor *= 0.5;
+
+                    for (size_t ind = 0; ind < D.size(); ind++) {
+                        double** Dp = D[ind]->pointer();
+                        double** Jp = JT[thread][ind]->pointer();
+                        double** Kp = KT[thread][ind]->pointer();
+                        const double* buffer2 = quartet;
+
+                        for (int p = Poff; p < Poff + Psize; p++) {
+                            for (int q = Qoff; q < Qoff + Qsize; q++) {
+                                for (int r = Roff; r < Roff + Rsize; r++) {
+                                    for (int s = Soff; s < Soff + Ssize; s++) {
+                                        double val = prefactor * (*buffer2++);
+                                        Jp[p][q] += (Dp[r][s] + Dp[s][r]) * val;
+                                        Jp[r][s] += (Dp[p][q] + Dp[q][p]) * val;
+                                        Kp[p][r] += Dp[q][s] * val;
+                                        Kp[p][s] += Dp[q][r] * val;
+                                        Kp[q][r] += Dp[p][s] * val;
+                                        Kp[q][s] += Dp[p][r] * val;
+                                        if (!lr_symmetric_) {
+                                            Kp[r][p] += Dp[s][q] * val;
+                                            Kp[s][p] += Dp[r][q] * val;
+                                            Kp[r][q] += Dp[s][p] * val;
+                                            Kp[s][q] += Dp[r][p] * val;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }  // End master block list
+
+    // => Reduction <= //
+
+    for (int thread = 1; thread < nthread; thread++) {
+        for (size_t ind = 0; ind < D.size(); ind++) {
+            J[ind]->add(JT[thread][ind]);
+            K[ind]->add(KT[thread][ind]);
+        }
     }
+
+    return computed_shells;
 }
 
 #if 0
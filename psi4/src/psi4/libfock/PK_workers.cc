@@ -368,13 +368,22 @@ void PKWorker::first_quartet(size_t i) {
     }
 }
 
-bool PKWorker::is_shell_relevant() {
+void PKWorker::initialize_block_task(size_t i) {
+    bufidx_ = i;
+    offset_ = bufidx_ * buf_size_;
+    initialize_task();
+    shells_left_ = false;
+}
+
+bool PKWorker::is_shell_relevant() { return is_shell_relevant(P_, Q_, R_, S_); }
+
+bool PKWorker::is_shell_relevant(size_t P, size_t Q, size_t R, size_t S) {
     // May implement the sieve here
 
-    size_t lowi = primary_->shell_to_basis_function(P_);
-    size_t lowj = primary_->shell_to_basis_function(Q_);
-    size_t lowk = primary_->shell_to_basis_function(R_);
-    size_t lowl = primary_->shell_to_basis_function(S_);
+    size_t lowi = primary_->shell_to_basis_function(P);
+    size_t lowj = primary_->shell_to_basis_function(Q);
+    size_t lowk = primary_->shell_to_basis_function(R);
+    size_t lowl = primary_->shell_to_basis_function(S);
 
     size_t low_ijkl = INDEX4(lowi, lowj, lowk, lowl);
     size_t low_ikjl = INDEX4(lowi, lowk, lowj, lowl);
@@ -388,10 +397,10 @@ bool PKWorker::is_shell_relevant() {
         return false;
     }
 
-    int ni = primary_->shell(P_).nfunction();
-    int nj = primary_->shell(Q_).nfunction();
-    int nk = primary_->shell(R_).nfunction();
-    int nl = primary_->shell(S_).nfunction();
+    int ni = primary_->shell(P).nfunction();
+    int nj = primary_->shell(Q).nfunction();
+    int nk = primary_->shell(R).nfunction();
+    int nl = primary_->shell(S).nfunction();
 
     size_t hii = lowi + ni - 1;
     size_t hij = lowj + nj - 1;
@@ -413,7 +422,7 @@ bool PKWorker::is_shell_relevant() {
     }
 
     // Now we loop over unique basis function quartets in the shell quartet
-    AOFctSieveIterator bfiter = shelliter_->integrals_iterator();
+    AOFctSieveIterator bfiter(primary_->shell(P), primary_->shell(Q), primary_->shell(R), primary_->shell(S), sieve_);
     for (bfiter.first(); bfiter.is_done() == false; bfiter.next()) {
         size_t i = bfiter.i();
         size_t j = bfiter.j();
@@ -295,6 +295,12 @@ class PKWorker {
     /// Overloaded by specific derived classes
     virtual void initialize_task() = 0;
 
+    /// Set up task i without iterating over shell quartets, for
+    /// integral engines that compute whole blocks of shell pairs
+    void initialize_block_task(size_t i);
+    /// Is the unique shell quartet PQRS needed by the current task ?
+    bool is_shell_relevant(size_t P, size_t Q, size_t R, size_t S);
+
     /// Set up the first shell quartet to be computed
     void first_quartet(size_t i);
     /// Is there a shell quartet left to compute ?
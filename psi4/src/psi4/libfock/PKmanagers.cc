@@ -31,6 +31,7 @@
 
 #include "psi4/psi4-dec.h"
 #include "psi4/psifiles.h"
+#include "psi4/libpsio/psio.h"
 #include "psi4/libpsio/psio.hpp"
 #include "psi4/libiwl/iwl.hpp"
 #include "psi4/liboptions/liboptions.h"
@@ -45,6 +46,10 @@
 #include "psi4/libpsio/aiohandler.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
 #ifdef _OPENMP
 #include <omp.h>
 #include "psi4/libpsi4util/process.h"
@@ -218,6 +223,16 @@ void PKManager::compute_integrals(bool wK) {
         }
     }
 
+    // Engines that batch shell pairs (e.g. simint) get whole blocks
+    bool blocked = tb[0]->blocks_batched();
+    std::vector<ShellPairBlock> blocks12, blocks34;
+    std::vector<std::vector<std::pair<size_t, size_t>>> task_blocks;
+    if (blocked) {
+        blocks12 = tb[0]->get_blocks12();
+        blocks34 = tb[0]->get_blocks34();
+        task_blocks = block_pairs_per_task(blocks12, blocks34);
+    }
+
     size_t nshqu = 0;
 #pragma omp parallel for num_threads(nthreads_) schedule(dynamic) reduction(+ : nshqu)
     for (size_t i = 0; i < ntasks_; ++i) {
@@ -228,7 +243,14 @@ void PKManager::compute_integrals(bool wK) {
 #endif
         SharedPKWrkr buf = get_buffer();
         // DEBUG        outfile->Printf("Starting task %d\n", i);
-        if (!wK) {  // Computing usual integrals
+        if (blocked) {  // Computing blocks of shell quartets
+            if (wK) buf->set_do_wK(true);
+            buf->initialize_block_task(i);
+            auto relevant = [&buf](int P, int Q, int R, int S) { return buf->is_shell_relevant(P, Q, R, S); };
+            for (const auto& blocks : task_blocks[i]) {
+                nshqu += compute_block_pair(tb[thread], blocks12, blocks34, blocks.first, blocks.second, relevant, wK);
+            }
+        } else if (!wK) {  // Computing usual integrals
             for (buf->first_quartet(i); buf->more_work(); buf->next_quartet()) {
                 size_t P = buf->P();
                 size_t Q = buf->Q();
@@ -370,6 +392,117 @@ void PKManager::integrals_buffering_wK(const double* buffer, size_t P, size_t Q,
     }
 }
 
+std::vector<std::vector<std::pair<size_t, size_t>>> PKManager::block_pairs_per_task(
+    const std::vector<ShellPairBlock>& blocks12, const std::vector<ShellPairBlock>& blocks34) {
+    // Window of canonical indices [offset, max_idx] held by each task's buffer
+    std::vector<std::pair<size_t, size_t>> windows(ntasks_);
+    SharedPKWrkr buf = get_buffer();
+    for (size_t i = 0; i < ntasks_; ++i) {
+        buf->initialize_block_task(i);
+        windows[i] = std::make_pair(buf->offset(), buf->max_idx());
+    }
+
+    std::vector<std::vector<std::pair<size_t, size_t>>> task_blocks(ntasks_);
+    for (size_t block12 = 0; block12 < blocks12.size(); ++block12) {
+        const ShellPairBlock& bra = blocks12[block12];
+        for (size_t block34 = 0; block34 < blocks34.size(); ++block34) {
+            const ShellPairBlock& ket = blocks34[block34];
+
+            // Lowest and highest J and K indices the significant unique quartets
+            // of this block pair can reach, with the bounds of is_shell_relevant
+            bool any = false;
+            size_t lo = 0, hi = 0;
+            for (const auto& PQ : bra) {
+                int P = PQ.first;
+                int Q = PQ.second;
+                if (Q > P || !sieve_->shell_pair_significant(P, Q)) continue;
+                size_t lowi = primary_->shell_to_basis_function(P);
+                size_t lowj = primary_->shell_to_basis_function(Q);
+                size_t hii = lowi + primary_->shell(P).nfunction() - 1;
+                size_t hij = lowj + primary_->shell(Q).nfunction() - 1;
+                for (const auto& RS : ket) {
+                    int R = RS.first;
+                    int S = RS.second;
+                    if (S > R || INDEX2(R, S) > INDEX2(P, Q)) continue;
+                    if (!sieve_->shell_pair_significant(R, S) || !sieve_->shell_significant(P, Q, R, S)) continue;
+                    size_t lowk = primary_->shell_to_basis_function(R);
+                    size_t lowl = primary_->shell_to_basis_function(S);
+                    size_t hik = lowk + primary_->shell(R).nfunction() - 1;
+                    size_t hil = lowl + primary_->shell(S).nfunction() - 1;
+                    size_t low = std::min(
+                        {INDEX4(lowi, lowj, lowk, lowl), INDEX4(lowi, lowk, lowj, lowl), INDEX4(lowi, lowl, lowj, lowk)});
+                    size_t high =
+                        std::max({INDEX4(hii, hij, hik, hil), INDEX4(hii, hik, hij, hil), INDEX4(hii, hil, hij, hik)});
+                    lo = any ? std::min(lo, low) : low;
+                    hi = any ? std::max(hi, high) : high;
+                    any = true;
+                }
+            }
+            if (!any) continue;
+
+            for (size_t i = 0; i < ntasks_; ++i) {
+                if (lo <= windows[i].second && hi >= windows[i].first) {
+                    task_blocks[i].push_back(std::make_pair(block12, block34));
+                }
+            }
+        }
+    }
+    return task_blocks;
+}
+
+size_t PKManager::compute_block_pair(std::shared_ptr<TwoBodyAOInt> tb, const std::vector<ShellPairBlock>& blocks12,
+                                     const std::vector<ShellPairBlock>& blocks34, size_t block12, size_t block34,
+                                     const std::function<bool(int, int, int, int)>& relevant, bool wK) {
+    const ShellPairBlock& bra = blocks12[block12];
+    const ShellPairBlock& ket = blocks34[block34];
+
+    // Blocks may hold pairs in any order, keep the unique quartets
+    // P >= Q, R >= S, PQ >= RS that the sieve iterators visit
+    std::vector<bool> needed(bra.size() * ket.size(), false);
+    bool any = false;
+    for (size_t PQ = 0; PQ < bra.size(); ++PQ) {
+        int P = bra[PQ].first;
+        int Q = bra[PQ].second;
+        if (Q > P || !sieve_->shell_pair_significant(P, Q)) continue;
+        for (size_t RS = 0; RS < ket.size(); ++RS) {
+            int R = ket[RS].first;
+            int S = ket[RS].second;
+            if (S > R || INDEX2(R, S) > INDEX2(P, Q)) continue;
+            if (!sieve_->shell_pair_significant(R, S) || !sieve_->shell_significant(P, Q, R, S)) continue;
+            if (relevant(P, Q, R, S)) {
+                needed[PQ * ket.size() + RS] = true;
+                any = true;
+            }
+        }
+    }
+    if (!any) return 0;
+
+    tb->compute_shell_blocks(block12, block34);
+
+    // The block buffer holds the quartets one after the other, bra pairs outermost
+    const double* buffer = tb->buffer();
+    size_t nshqu = 0;
+    for (size_t PQ = 0; PQ < bra.size(); ++PQ) {
+        int P = bra[PQ].first;
+        int Q = bra[PQ].second;
+        size_t nPQ = primary_->shell(P).nfunction() * primary_->shell(Q).nfunction();
+        for (size_t RS = 0; RS < ket.size(); ++RS) {
+            int R = ket[RS].first;
+            int S = ket[RS].second;
+            if (needed[PQ * ket.size() + RS]) {
+                if (wK) {
+                    integrals_buffering_wK(buffer, P, Q, R, S);
+                } else {
+                    integrals_buffering(buffer, P, Q, R, S);
+                }
+                ++nshqu;
+            }
+            buffer += nPQ * primary_->shell(R).nfunction() * primary_->shell(S).nfunction();
+        }
+    }
+    return nshqu;
+}
+
 // use the vectors of Cleft and Cright to determine which of these densities,
 // if any, are symmetric matrices.
 void PKManager::form_D_vec(std::vector<SharedMatrix> D, std::vector<SharedMatrix> Cl, std::vector<SharedMatrix> Cr) {
@@ -590,22 +723,6 @@ void PKMgrDisk::batch_sizing() {
         outfile->Printf("  PK computation needs %d batches, max. number: %d\n", nbatches, max_batches_);
         throw PSIEXCEPTION("  PK Failure: max batches exceeded\n");
     }
-
-    // Finally, we want to store the pairs of indices p,q corresponding
-    // to min pq and max pq for each batch (useful for non-sym. density matrices)
-    // We go beyond the number of pq to make sure we include the last one.
-    outfile->Printf("  Building batch lookup table.\n");
-    ind_for_pq_[0] = std::make_pair(0, 0);
-    int nb = 0;
-    for (int p = 0; p <= nbf(); ++p) {
-        for (int q = 0; q <= p; ++q) {
-            pq = INDEX2(p, q);
-            if (nb < batch_pq_max_.size() && batch_pq_max_[nb] == pq) {
-                ind_for_pq_[pq] = std::make_pair(p, q);
-                ++nb;
-            }
-        }
-    }
 }
 
 void PKMgrDisk::print_batches() {
@@ -655,143 +772,199 @@ void PKMgrDisk::finalize_PK() {
     }
 }
 
-void PKMgrDisk::form_J(std::vector<SharedMatrix> J, std::string exch, std::vector<SharedMatrix> K) {
-    make_J_vec(J);
-
-    // Now loop over batches
-    for (int batch = 0; batch < batch_pq_min_.size(); ++batch) {
-        size_t min_index = batch_index_min_[batch];
-        size_t max_index = batch_index_max_[batch];
-        size_t batch_size = max_index - min_index;
-        size_t min_pq = batch_pq_min_[batch];
-        size_t max_pq = batch_pq_max_[batch];
-        double* j_block = new double[batch_size];
-
-        char* label;
-        if (exch == "K") {
-            label = PKWorker::get_label_K(batch);
-        } else if (exch == "wK") {
-            label = PKWorker::get_label_wK(batch);
-        } else {
-            label = PKWorker::get_label_J(batch);
-        }
-        psio_->read_entry(pk_file_, label, (char*)j_block, batch_size * sizeof(double));
+namespace {
+// Inverse of INDEX2 for p >= q
+void pair_of_pq(size_t pq, int& p, int& q) {
+    size_t pp = (size_t)((std::sqrt(8.0 * pq + 1.0) - 1.0) / 2.0);
+    while (pp * (pp + 1) / 2 > pq) --pp;
+    while ((pp + 1) * (pp + 2) / 2 <= pq) ++pp;
+    p = pp;
+    q = pq - pp * (pp + 1) / 2;
+}
+}  // namespace
 
-        // Read one entry, use it for all density matrices
-        for (int N = 0; N < J.size(); ++N) {
-            // Symmetric density matrix, pure triangular
-            if (is_sym(N) && exch != "wK") {
-                double* D_vec = D_glob_vecs(N);
-                double* J_vec = JK_glob_vecs(N);
-                double* j_ptr = j_block;
-                // TODO Could consider parallelizing this loop
-                for (size_t pq = min_pq; pq < max_pq; ++pq) {
-                    double D_pq = D_vec[pq];
-                    double* D_rs = D_vec;
-                    double J_pq = 0.0;
-                    double* J_rs = J_vec;
-                    for (size_t rs = 0; rs <= pq; ++rs) {
-                        // DEBUG                        if(!exch && rs == 0) {
-                        // DEBUG                          outfile->Printf("PK int (%lu|%lu) = %20.16f\n",pq,rs,*j_ptr);
-                        // DEBUG                        }
-                        J_pq += *j_ptr * (*D_rs);
-                        *J_rs += *j_ptr * D_pq;
-                        ++D_rs;
-                        ++J_rs;
-                        ++j_ptr;
-                    }
-                    J_vec[pq] += J_pq;
+void PKMgrDisk::contract_block(const double* j_block, size_t min_pq, size_t max_pq, std::vector<SharedMatrix>& J,
+                               const std::string& exch, std::vector<SharedMatrix>& K) {
+    // Apply the block to all density matrices
+    for (int N = 0; N < J.size(); ++N) {
+        // Symmetric density matrix, pure triangular
+        if (is_sym(N) && exch != "wK") {
+            double* D_vec = D_glob_vecs(N);
+            double* J_vec = JK_glob_vecs(N);
+            const double* j_ptr = j_block;
+            // TODO Could consider parallelizing this loop
+            for (size_t pq = min_pq; pq < max_pq; ++pq) {
+                double D_pq = D_vec[pq];
+                double* D_rs = D_vec;
+                double J_pq = 0.0;
+                double* J_rs = J_vec;
+                for (size_t rs = 0; rs <= pq; ++rs) {
+                    // DEBUG                        if(!exch && rs == 0) {
+                    // DEBUG                          outfile->Printf("PK int (%lu|%lu) = %20.16f\n",pq,rs,*j_ptr);
+                    // DEBUG                        }
+                    J_pq += *j_ptr * (*D_rs);
+                    *J_rs += *j_ptr * D_pq;
+                    ++D_rs;
+                    ++J_rs;
+                    ++j_ptr;
                 }
-                // Non-symmetric density matrix case
-            } else if (exch == "" || exch == "wK") {
-                double* j_ptr = j_block;
-                const int fp = ind_for_pq_[min_pq].first;
-                const int fq = ind_for_pq_[min_pq].second;
-                const int maxp = ind_for_pq_[max_pq].first;
-                if (exch != "wK") {
-                    double* D_vec = D_glob_vecs(N);
-                    double** J_vec = J[N]->pointer();
-                    for (int p = fp; p <= maxp; ++p) {
-                        int maxq = (p == maxp) ? ind_for_pq_[max_pq].second : p + 1;
-                        int poffs = p * nbf();
-                        int q = (p == fp) ? fq : 0;
-                        for (; q < maxq; ++q) {
-                            int qoffs = q * nbf();
-                            for (int r = 0; r <= p; ++r) {
-                                int roffs = r * nbf();
-                                int maxs = (r == p) ? q : r;
-                                for (int s = 0; s <= maxs; ++s) {
-                                    //                            if(!exch && INDEX2(r,s) == 0) {
-                                    //                              outfile->Printf("PK int (%lu|%lu) =
-                                    //                              %20.16f\n",INDEX2(p,q),INDEX2(r,s),*j_ptr);
-                                    //                              int x = 0;  // For the lolz
-                                    //                            }
-                                    J_vec[p][q] += *j_ptr * (D_vec[roffs + s] + D_vec[s * nbf() + r]);
-                                    J_vec[q][p] += *j_ptr * (D_vec[roffs + s] + D_vec[s * nbf() + r]);
-                                    J_vec[r][s] += *j_ptr * (D_vec[poffs + q] + D_vec[qoffs + p]);
-                                    J_vec[s][r] += *j_ptr * (D_vec[poffs + q] + D_vec[qoffs + p]);
-                                    ++j_ptr;
-                                }
+                J_vec[pq] += J_pq;
+            }
+            // Non-symmetric density matrix case
+        } else if (exch == "" || exch == "wK") {
+            const double* j_ptr = j_block;
+            int fp, fq, maxp, maxq_last;
+            pair_of_pq(min_pq, fp, fq);
+            pair_of_pq(max_pq, maxp, maxq_last);
+            if (exch != "wK") {
+                double* D_vec = D_glob_vecs(N);
+                double** J_vec = J[N]->pointer();
+                for (int p = fp; p <= maxp; ++p) {
+                    int maxq = (p == maxp) ? maxq_last : p + 1;
+                    int poffs = p * nbf();
+                    int q = (p == fp) ? fq : 0;
+                    for (; q < maxq; ++q) {
+                        int qoffs = q * nbf();
+                        for (int r = 0; r <= p; ++r) {
+                            int roffs = r * nbf();
+                            int maxs = (r == p) ? q : r;
+                            for (int s = 0; s <= maxs; ++s) {
+                                //                            if(!exch && INDEX2(r,s) == 0) {
+                                //                              outfile->Printf("PK int (%lu|%lu) =
+                                //                              %20.16f\n",INDEX2(p,q),INDEX2(r,s),*j_ptr);
+                                //                              int x = 0;  // For the lolz
+                                //                            }
+                                J_vec[p][q] += *j_ptr * (D_vec[roffs + s] + D_vec[s * nbf() + r]);
+                                J_vec[q][p] += *j_ptr * (D_vec[roffs + s] + D_vec[s * nbf() + r]);
+                                J_vec[r][s] += *j_ptr * (D_vec[poffs + q] + D_vec[qoffs + p]);
+                                J_vec[s][r] += *j_ptr * (D_vec[poffs + q] + D_vec[qoffs + p]);
+                                ++j_ptr;
                             }
                         }
                     }
                 }
-                // Since we just read a batch, might as well compute K
-                // Primitive algorithm, just contract integrals with appropriate
-                // element on the fly. Might be faster than reading/writing the appropriate
-                // PK supermatrix
-                if (K.size() || exch == "wK") {
-                    double** Dmat = original_D(N)->pointer();
-                    double** K_vec;
-                    if (exch == "wK") {
-                        K_vec = J[N]->pointer();
-                    } else {
-                        K_vec = K[N]->pointer();
-                    }
-                    j_ptr = j_block;
-                    for (int p = fp; p <= maxp; ++p) {
-                        int maxq = (p == maxp) ? ind_for_pq_[max_pq].second : p + 1;
-                        //       int poffs = p * nbf();
-                        int q = (p == fp) ? fq : 0;
-                        for (; q < maxq; ++q) {
-                            //       int qoffs = q * nbf();
-                            for (int r = 0; r <= p; ++r) {
-                                //       int roffs = r * nbf();
-                                int maxs = (r == p) ? q : r;
-                                for (int s = 0; s <= maxs; ++s) {
-                                    // Need ugly factors for now. A better solution would be great.
-                                    double fac = 1.0;
-                                    //       int soffs = s * nbf();
-                                    if (p == q && r == s && p == r) {
-                                        fac = 0.25;  // Divide only be 4, PK stores integral with a
-                                        // factor 0.5 on the (pq|pq) diagonal.
-                                    } else if ((p == q && q == r) || (q == r && r == s)) {
-                                        fac = 0.5;
-                                    } else if (p == q && r == s) {
-                                        fac = 0.25;
-                                    } else if (p == q || r == s) {
-                                        fac = 0.5;
-                                    }
-                                    K_vec[p][r] += (*j_ptr) * fac * Dmat[q][s];
-                                    K_vec[r][p] += (*j_ptr) * fac * Dmat[s][q];
-                                    K_vec[q][r] += (*j_ptr) * fac * Dmat[p][s];
-                                    K_vec[p][s] += (*j_ptr) * fac * Dmat[q][r];
-                                    K_vec[s][p] += (*j_ptr) * fac * Dmat[r][q];
-                                    K_vec[r][q] += (*j_ptr) * fac * Dmat[s][p];
-                                    K_vec[s][q] += (*j_ptr) * fac * Dmat[r][p];
-                                    K_vec[q][s] += (*j_ptr) * fac * Dmat[p][r];
-                                    ++j_ptr;
+            }
+            // Since we just read a batch, might as well compute K
+            // Primitive algorithm, just contract integrals with appropriate
+            // element on the fly. Might be faster than reading/writing the appropriate
+            // PK supermatrix
+            if (K.size() || exch == "wK") {
+                double** Dmat = original_D(N)->pointer();
+                double** K_vec;
+                if (exch == "wK") {
+                    K_vec = J[N]->pointer();
+                } else {
+                    K_vec = K[N]->pointer();
+                }
+                j_ptr = j_block;
+                for (int p = fp; p <= maxp; ++p) {
+                    int maxq = (p == maxp) ? maxq_last : p + 1;
+                    //       int poffs = p * nbf();
+                    int q = (p == fp) ? fq : 0;
+                    for (; q < maxq; ++q) {
+                        //       int qoffs = q * nbf();
+                        for (int r = 0; r <= p; ++r) {
+                            //       int roffs = r * nbf();
+                            int maxs = (r == p) ? q : r;
+                            for (int s = 0; s <= maxs; ++s) {
+                                // Need ugly factors for now. A better solution would be great.
+                                double fac = 1.0;
+                                //       int soffs = s * nbf();
+                                if (p == q && r == s && p == r) {
+                                    fac = 0.25;  // Divide only be 4, PK stores integral with a
+                                    // factor 0.5 on the (pq|pq) diagonal.
+                                } else if ((p == q && q == r) || (q == r && r == s)) {
+                                    fac = 0.5;
+                                } else if (p == q && r == s) {
+                                    fac = 0.25;
+                                } else if (p == q || r == s) {
+                                    fac = 0.5;
                                 }
+                                K_vec[p][r] += (*j_ptr) * fac * Dmat[q][s];
+                                K_vec[r][p] += (*j_ptr) * fac * Dmat[s][q];
+                                K_vec[q][r] += (*j_ptr) * fac * Dmat[p][s];
+                                K_vec[p][s] += (*j_ptr) * fac * Dmat[q][r];
+                                K_vec[s][p] += (*j_ptr) * fac * Dmat[r][q];
+                                K_vec[r][q] += (*j_ptr) * fac * Dmat[s][p];
+                                K_vec[s][q] += (*j_ptr) * fac * Dmat[r][p];
+                                K_vec[q][s] += (*j_ptr) * fac * Dmat[p][r];
+                                ++j_ptr;
                             }
                         }
                     }
                 }
-            }  // end of non-symmetric case
-        }      // End of loop over J matrices
+            }
+        }  // end of non-symmetric case
+    }      // End of loop over J matrices
+
+}
+
+void PKMgrDisk::form_J(std::vector<SharedMatrix> J, std::string exch, std::vector<SharedMatrix> K) {
+    make_J_vec(J);
+
+    // Each batch is read in chunks of whole pq rows, at most half the memory each,
+    // so that the AIO thread can read the next chunk while this one is contracted
+    // with every density matrix.
+    struct Chunk {
+        int batch;
+        size_t min_pq;
+        size_t max_pq;
+        size_t offset;
+        size_t size;
+    };
+    std::vector<Chunk> chunks;
+    size_t max_chunk = 0;
+    size_t chunk_mem = std::max<size_t>(memory() / 2, 1);
+    for (int batch = 0; batch < batch_pq_min_.size(); ++batch) {
+        size_t pq0 = batch_pq_min_[batch];
+        while (pq0 < batch_pq_max_[batch]) {
+            size_t pq1 = pq0 + 1;
+            size_t size = pq1;
+            while (pq1 < batch_pq_max_[batch] && size + pq1 + 1 <= chunk_mem) {
+                size += pq1 + 1;
+                ++pq1;
+            }
+            size_t offset = pq0 * (pq0 + 1) / 2 - batch_pq_min_[batch] * (batch_pq_min_[batch] + 1) / 2;
+            chunks.push_back({batch, pq0, pq1, offset, size});
+            max_chunk = std::max(max_chunk, size);
+            pq0 = pq1;
+        }
+    }
+
+    std::vector<char*> labels(batch_pq_min_.size());
+    for (int batch = 0; batch < batch_pq_min_.size(); ++batch) {
+        if (exch == "K") {
+            labels[batch] = PKWorker::get_label_K(batch);
+        } else if (exch == "wK") {
+            labels[batch] = PKWorker::get_label_wK(batch);
+        } else {
+            labels[batch] = PKWorker::get_label_J(batch);
+        }
+    }
 
-        delete[] label;
-        delete[] j_block;
-    }  // End of batch loop
+    int nbuf = chunks.size() > 1 ? 2 : 1;
+    std::vector<std::unique_ptr<double[]>> j_blocks(nbuf);
+    for (int i = 0; i < nbuf; ++i) j_blocks[i] = std::unique_ptr<double[]>(new double[max_chunk]);
+    std::vector<size_t> jobs(chunks.size());
+    std::vector<psio_address> ends(chunks.size());
+
+    auto read_chunk = [&](size_t c) {
+        const Chunk& chunk = chunks[c];
+        psio_address start = psio_get_address(PSIO_ZERO, chunk.offset * sizeof(double));
+        jobs[c] = AIO_->read(pk_file_, labels[chunk.batch], (char*)j_blocks[c % nbuf].get(),
+                             chunk.size * sizeof(double), start, &ends[c]);
+    };
+
+    if (chunks.size()) read_chunk(0);
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        if (c + 1 < chunks.size()) read_chunk(c + 1);
+        AIO_->wait_for_job(jobs[c]);
+        contract_block(j_blocks[c % nbuf].get(), chunks[c].min_pq, chunks[c].max_pq, J, exch, K);
+    }
+    // The last read issued must not outlive the buffers and labels
+    AIO_->synchronize();
+
+    for (int batch = 0; batch < labels.size(); ++batch) delete[] labels[batch];
     get_results(J, exch);
 }
 
@@ -1054,6 +1227,31 @@ void PKMgrYoshimine::compute_integrals(bool wK) {
         }
     }
 
+    // Engines that batch shell pairs (e.g. simint) get whole blocks
+    if (tb[0]->blocks_batched()) {
+        std::vector<ShellPairBlock> blocks12 = tb[0]->get_blocks12();
+        std::vector<ShellPairBlock> blocks34 = tb[0]->get_blocks34();
+        auto all = [](int P, int Q, int R, int S) { return true; };
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads())
+        for (size_t block12 = 0; block12 < blocks12.size(); ++block12) {
+            int thread = 0;
+#ifdef _OPENMP
+            thread = omp_get_thread_num();
+#endif
+            for (size_t block34 = 0; block34 < blocks34.size(); ++block34) {
+                compute_block_pair(tb[thread], blocks12, blocks34, block12, block34, all, wK);
+            }
+        }
+
+        // We write all remaining buffers to disk.
+        if (!wK) {
+            write();
+        } else {
+            write_wK();
+        }
+        return;
+    }
+
     // Loop over significant shell pairs from ERISieve
     const std::vector<std::pair<int, int>>& sh_pairs = sieve()->shell_pairs();
     size_t npairs = sh_pairs.size();
@@ -1453,15 +1651,47 @@ void PKMgrInCore::print_batches() {
     outfile->Printf("  Using %lu doubles for integral storage.\n", nbufincore * pk_size());
 }
 
+void PKMgrInCore::partition_rows() {
+    // Row pq holds pq + 1 integrals, starting at pq * (pq + 1) / 2
+    row_start_.assign(nthreads() + 1, pk_pairs());
+    row_start_[0] = 0;
+    size_t pq = 0;
+    for (int t = 1; t < nthreads(); ++t) {
+        size_t target = (pk_size() / nthreads()) * t;
+        while (pq < pk_pairs() && pq * (pq + 1) / 2 < target) ++pq;
+        row_start_[t] = pq;
+    }
+}
+
+void PKMgrInCore::first_touch(double* ints) {
+    // Pages are placed on the NUMA node of the thread that first writes them,
+    // so the thread that will sweep a slice in form_J zeroes it here.
+#pragma omp parallel num_threads(nthreads())
+    {
+        int thread = 0;
+        int nthread = 1;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+        nthread = omp_get_num_threads();
+#endif
+        for (int t = thread; t < nthreads(); t += nthread) {
+            size_t start = row_start_[t] * (row_start_[t] + 1) / 2;
+            size_t end = row_start_[t + 1] * (row_start_[t + 1] + 1) / 2;
+            ::memset((void*)(ints + start), '\0', (end - start) * sizeof(double));
+        }
+    }
+}
+
 void PKMgrInCore::allocate_buffers() {
     // Need to allocate two big arrays
+    partition_rows();
     J_ints_ = std::unique_ptr<double[]>(new double[pk_size()]);
     K_ints_ = std::unique_ptr<double[]>(new double[pk_size()]);
-    ::memset((void*)J_ints_.get(), '\0', pk_size() * sizeof(double));
-    ::memset((void*)K_ints_.get(), '\0', pk_size() * sizeof(double));
+    first_touch(J_ints_.get());
+    first_touch(K_ints_.get());
     if (do_wk()) {
         wK_ints_ = std::unique_ptr<double[]>(new double[pk_size()]);
-        ::memset((void*)wK_ints_.get(), '\0', pk_size() * sizeof(double));
+        first_touch(wK_ints_.get());
     }
 
     // Now we allocate a derived class of IOBuffer_PK that takes care of
@@ -1508,9 +1738,68 @@ void PKMgrInCore::prepare_JK(std::vector<SharedMatrix> D, std::vector<SharedMatr
     form_D_vec(D, Cl, Cr);
 }
 
+void PKMgrInCore::contract_sym(const double* ints, const std::vector<int>& DN) {
+    size_t nD = DN.size();
+    // Each slice accumulates into its own J, which only spans the rows up to
+    // the end of the slice; the slices are summed afterwards.
+    std::vector<std::unique_ptr<double[]>> J_slice(nthreads());
+
+#pragma omp parallel num_threads(nthreads())
+    {
+        int thread = 0;
+        int nthread = 1;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+        nthread = omp_get_num_threads();
+#endif
+        for (int t = thread; t < nthreads(); t += nthread) {
+            size_t len = row_start_[t + 1];
+            J_slice[t] = std::unique_ptr<double[]>(new double[nD * len]);
+            ::memset((void*)J_slice[t].get(), '\0', nD * len * sizeof(double));
+
+            for (size_t pq = row_start_[t]; pq < row_start_[t + 1]; ++pq) {
+                // The row stays in cache while it is contracted with every density
+                const double* I_rs = ints + pq * (pq + 1) / 2;
+                for (size_t n = 0; n < nD; ++n) {
+                    const double* D_rs = D_glob_vecs(DN[n]);
+                    double* J_rs = J_slice[t].get() + n * len;
+                    double D_pq = D_rs[pq];
+                    double J_pq = 0.0;
+                    for (size_t rs = 0; rs <= pq; ++rs) {
+                        J_pq += I_rs[rs] * D_rs[rs];
+                        J_rs[rs] += I_rs[rs] * D_pq;
+                    }
+                    J_rs[pq] += J_pq;
+                }
+            }
+        }
+    }
+
+#pragma omp parallel for num_threads(nthreads()) schedule(static)
+    for (size_t pq = 0; pq < pk_pairs(); ++pq) {
+        for (size_t n = 0; n < nD; ++n) {
+            double J_pq = 0.0;
+            for (int t = 0; t < nthreads(); ++t) {
+                size_t len = row_start_[t + 1];
+                if (pq < len) J_pq += J_slice[t][n * len + pq];
+            }
+            JK_glob_vecs(DN[n])[pq] += J_pq;
+        }
+    }
+}
+
 void PKMgrInCore::form_J(std::vector<SharedMatrix> J, std::string exch, std::vector<SharedMatrix> K) {
     make_J_vec(J);
 
+    // All symmetric densities are contracted together in one pass over the supermatrix
+    if (exch != "wK") {
+        std::vector<int> DN;
+        for (int N = 0; N < J.size(); ++N) {
+            if (is_sym(N)) DN.push_back(N);
+        }
+        if (DN.size()) contract_sym(exch == "K" ? K_ints_.get() : J_ints_.get(), DN);
+    }
+
     for (int N = 0; N < J.size(); ++N) {
         double* j_ptr;
         if (exch == "K") {
@@ -1518,32 +1807,12 @@ void PKMgrInCore::form_J(std::vector<SharedMatrix> J, std::string exch, std::vec
         } else {
             j_ptr = J_ints_.get();
         }
-        // TODO We should totally parallelize this loop now.
-        // Symmetric density matrix case
-        if (is_sym(N) && exch != "wK") {
-            double* J_vec = JK_glob_vecs(N);
-            double* D_vec = D_glob_vecs(N);
-            for (size_t pq = 0; pq < pk_pairs(); ++pq) {
-                double D_pq = D_vec[pq];
-                double* D_rs = D_vec;
-                double J_pq = 0.0;
-                double* J_rs = J_vec;
-                for (size_t rs = 0; rs <= pq; ++rs) {
-                    // DEBUG               if(!exch && rs == 0) {
-                    // DEBUG                 outfile->Printf("PK int (%lu|%lu) = %20.16f\n",pq,rs,*j_ptr);
-                    // DEBUG               }
-                    J_pq += *j_ptr * (*D_rs);
-                    *J_rs += *j_ptr * D_pq;
-                    ++D_rs;
-                    ++J_rs;
-                    ++j_ptr;
-                }
-                J_vec[pq] += J_pq;
-            }
+        // Symmetric density matrices were contracted above
+        if (is_sym(N) && exch != "wK") continue;
 
-            // TODO ? Fuse J and K loops ?
-            // Non-symmetric density matrix
-        } else if (exch == "" || exch == "wK") {
+        // TODO ? Fuse J and K loops ?
+        // Non-symmetric density matrix
+        if (exch == "" || exch == "wK") {
             if (exch == "") {
                 double* D_vec = D_glob_vecs(N);
                 double** J_vec = J[N]->pointer();
@@ -31,7 +31,9 @@
 
 // TODO Const correctness of everything
 #include "psi4/libmints/typedefs.h"
+#include "psi4/libmints/twobody.h"
 #include <psi4/libpsio/psio.hpp>
+#include <functional>
 #include <vector>
 
 namespace psi {
@@ -215,6 +217,16 @@ class PKManager {
     void integrals_buffering(const double* buffer, size_t P, size_t Q, size_t R, size_t S);
     /// Store the computed wK integrals in the appropriate buffers
     void integrals_buffering_wK(const double* buffer, size_t P, size_t Q, size_t R, size_t S);
+    /// List, for every task, the shell pair blocks (block12|block34) with
+    /// significant unique quartets that can fall into the task's buffer
+    std::vector<std::vector<std::pair<size_t, size_t>>> block_pairs_per_task(
+        const std::vector<ShellPairBlock>& blocks12, const std::vector<ShellPairBlock>& blocks34);
+    /// Compute the shell pair blocks (block12|block34) in one compute_shell_blocks
+    /// call if any of their significant unique quartets passes \p relevant,
+    /// and buffer those quartets. Returns the number of quartets buffered.
+    size_t compute_block_pair(std::shared_ptr<TwoBodyAOInt> tb, const std::vector<ShellPairBlock>& blocks12,
+                              const std::vector<ShellPairBlock>& blocks34, size_t block12, size_t block34,
+                              const std::function<bool(int, int, int, int)>& relevant, bool wK);
 
     /// Write the buffers of integrals to PK storage
     virtual void write() = 0;
@@ -255,9 +267,6 @@ class PKMgrDisk : public PKManager {
     /// Mapping pq indices to the correct batch
     std::vector<int> batch_for_pq_;
 
-    /// Mapping the min and max pq's to p,q pairs
-    std::map<size_t, std::pair<int, int> > ind_for_pq_;
-
     /// Maximum number of batches
     int max_batches_;
 
@@ -321,7 +330,11 @@ class PKMgrDisk : public PKManager {
     /// Closing the files
     virtual void close_PK_file(bool keep);
 
-    /// Form J from PK supermatrix, shared_ptr() initialized to null
+    /// Contract the PK rows [min_pq, max_pq) in j_block with all density matrices
+    void contract_block(const double* j_block, size_t min_pq, size_t max_pq, std::vector<SharedMatrix>& J,
+                        const std::string& exch, std::vector<SharedMatrix>& K);
+    /// Form J from PK supermatrix, shared_ptr() initialized to null.
+    /// The supermatrix is read once, with read-ahead, for all density matrices.
     void form_J(std::vector<SharedMatrix> J, std::string exch = "",
                 std::vector<SharedMatrix> K = std::vector<SharedMatrix>()) override;
 
@@ -472,6 +485,16 @@ class PKMgrInCore : public PKManager {
     std::unique_ptr<double[]> J_ints_;
     std::unique_ptr<double[]> K_ints_;
     std::unique_ptr<double[]> wK_ints_;
+    /// First pq row of each thread's slice of the supermatrices, plus pk_pairs() at the end.
+    /// Each slice is first touched, and later contracted, by the same thread.
+    std::vector<size_t> row_start_;
+
+    /// Split the pq rows into nthreads() slices holding about the same number of integrals
+    void partition_rows();
+    /// Zero the supermatrix slice by slice from the threads that contract it
+    void first_touch(double* ints);
+    /// Contract the supermatrix ints with all symmetric densities in DN in one threaded pass
+    void contract_sym(const double* ints, const std::vector<int>& DN);
 
    public:
     /// Constructor for in-core class
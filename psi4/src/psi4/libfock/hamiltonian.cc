@@ -35,6 +35,8 @@
 #include "psi4/psi4-dec.h"
 #include "psi4/libmints/vector.h"
 #include "psi4/libmints/matrix.h"
+#include "psi4/libfunctional/superfunctional.h"
+#include "psi4/libpsi4util/exception.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
 
 #include <sstream>
@@ -811,40 +813,61 @@ std::vector<SharedMatrix> CPHFRHamiltonian::unpack(const std::vector<std::shared
 TDARHamiltonian::TDARHamiltonian(std::shared_ptr<JK> jk, std::shared_ptr<VBase> v, SharedMatrix Cocc,
                                  SharedMatrix Caocc, SharedMatrix Cavir, std::shared_ptr<Vector> eps_aocc,
                                  std::shared_ptr<Vector> eps_avir)
-    : CISRHamiltonian(jk, Caocc, Cavir, eps_aocc, eps_avir, v), Cocc_(Cocc) {
-    // std::vector<SharedMatrix>& C = v->C();
-    // C.clear();
-    // C.push_back(Cocc);
-
-    // std::vector<SharedMatrix>& Cao = v->Caocc();
-    // Cao.clear();
-    // Cao.push_back(Caocc);
-
-    // std::vector<SharedMatrix>& Cav = v->Cavir();
-    // Cav.clear();
-    // Cav.push_back(Cavir);
-}
+    : CISRHamiltonian(jk, Caocc, Cavir, eps_aocc, eps_avir, v), Cocc_(Cocc), symmetry_(-1) {}
 TDARHamiltonian::~TDARHamiltonian() {}
 void TDARHamiltonian::print_header() const {
     if (print_) {
         outfile->Printf("  ==> TDARHamiltonian (by Rob Parrish) <== \n\n");
     }
 }
+std::shared_ptr<Vector> TDARHamiltonian::diagonal() {
+    std::shared_ptr<Vector> diag = CISRHamiltonian::diagonal();
+    if (symmetry_ < 0) return diag;
+
+    // Zero-dimensional blocks drop the other transition symmetries from the solver
+    int nirrep = diag->nirrep();
+    Dimension nov(nirrep);
+    nov[symmetry_] = diag->dimpi()[symmetry_];
+
+    auto diag2 = std::make_shared<Vector>("TDA Diagonal", nov);
+    if (nov[symmetry_]) {
+        ::memcpy((void*)diag2->pointer(symmetry_), (void*)diag->pointer(symmetry_), sizeof(double) * nov[symmetry_]);
+    }
+    return diag2;
+}
 void TDARHamiltonian::product(const std::vector<std::shared_ptr<Vector> >& x,
                               std::vector<std::shared_ptr<Vector> >& b) {
     std::vector<SharedMatrix>& C_left = jk_->C_left();
     std::vector<SharedMatrix>& C_right = jk_->C_right();
-    // std::vector<SharedMatrix >& P = v_->P();
 
     C_left.clear();
     C_right.clear();
-    // P.clear();
 
     int nirrep = (x.size() ? x[0]->nirrep() : 0);
 
+    // Exchange and XC kernel weights, HF if there is no V object
+    double alpha = 1.0;
+    double beta = 0.0;
+    bool do_xc = false;
+    if (v_) {
+        std::shared_ptr<SuperFunctional> func = v_->functional();
+        alpha = (func->is_x_hybrid() ? func->x_alpha() : 0.0);
+        beta = (func->is_x_lrc() ? func->x_beta() : 0.0);
+        // The XC kernel is only spin-adapted for singlets
+        do_xc = singlet_ && func->needs_xc();
+    }
+
+    // Only the transition symmetries present in x are built
+    std::vector<int> symms;
     for (int symm = 0; symm < nirrep; ++symm) {
+        if (x[0]->dimpi()[symm]) symms.push_back(symm);
+    }
+
+    std::vector<SharedMatrix> Dx;
+    std::vector<SharedMatrix> Vx;
+
+    for (int symm : symms) {
         for (size_t N = 0; N < x.size(); ++N) {
-            C_left.push_back(Caocc_);
             double* xp = x[N]->pointer(symm);
 
             std::stringstream ss;
@@ -867,38 +890,42 @@ void TDARHamiltonian::product(const std::vector<std::shared_ptr<Vector> >& x,
                 offset += nocc * nvir;
             }
 
+            C_left.push_back(Caocc_);
             C_right.push_back(Cr);
 
-            std::stringstream ss2;
-            ss2 << "P, h = " << symm << ", N = " << N;
-            auto P2 = std::make_shared<Matrix>(ss2.str(), Caocc_->colspi(), Cavir_->colspi(), symm);
-
-            offset = 0L;
-            for (int h = 0; h < Caocc_->nirrep(); ++h) {
-                double* xp = x[N]->pointer(symm);
-                int nocc = Caocc_->colspi()[h];
-                int nvir = Cavir_->colspi()[h ^ symm];
-                if (!nocc || !nvir) continue;
-                double** P2p = P2->pointer(h);
-                ::memcpy((void*)P2p[0], (void*)&xp[offset], sizeof(double) * nocc * nvir);
-                offset += nocc * nvir;
+            if (do_xc) {
+                Dx.push_back(linalg::doublet(Caocc_, Cr, false, true));
+                Vx.push_back(std::make_shared<Matrix>("Vx", Caocc_->rowspi(), Caocc_->rowspi(), symm));
             }
-
-            // P.push_back(P2);
         }
     }
 
     jk_->compute();
-    // v_->compute();
+    if (do_xc) v_->compute_Vx(Dx, Vx);
 
     const std::vector<SharedMatrix>& J = jk_->J();
-    //    const std::vector<SharedMatrix >& K = jk_->K();
-    //    const std::vector<SharedMatrix >& V = v_->V();
+    const std::vector<SharedMatrix>& K = jk_->K();
+    const std::vector<SharedMatrix>& wK = jk_->wK();
+
+    size_t nprod = symms.size() * x.size();
+    if ((alpha != 0.0 && K.size() < nprod) || (beta != 0.0 && wK.size() < nprod)) {
+        throw PSIEXCEPTION("TDARHamiltonian: JK object must compute K (and wK for LRC functionals).");
+    }
 
     auto* Tp = new double[Caocc_->max_nrow() * Caocc_->max_ncol()];
 
-    for (int symm = 0; symm < nirrep; ++symm) {
-        for (size_t N = 0; N < x.size(); ++N) {
+    size_t ind = 0;
+    for (int symm : symms) {
+        for (size_t N = 0; N < x.size(); ++N, ++ind) {
+            // F = 2(J + Vx) - alpha K - beta wK, in the SO basis
+            auto F = std::make_shared<Matrix>("F", Caocc_->rowspi(), Caocc_->rowspi(), symm);
+            if (singlet_) {
+                F->axpy(2.0, J[ind]);
+                if (do_xc) F->axpy(2.0, Vx[ind]);
+            }
+            if (alpha != 0.0) F->axpy(-alpha, K[ind]);
+            if (beta != 0.0) F->axpy(-beta, wK[ind]);
+
             double* bp = b[N]->pointer(symm);
             double* xp = x[N]->pointer(symm);
             long int offset = 0L;
@@ -915,25 +942,11 @@ void TDARHamiltonian::product(const std::vector<std::shared_ptr<Vector> >& x,
                 double** Cvp = Cavir_->pointer(h ^ symm);
                 double* eop = eps_aocc_->pointer(h);
                 double* evp = eps_avir_->pointer(h ^ symm);
+                double** Fp = F->pointer(h);
 
-                double** Jp = J[symm * x.size() + N]->pointer(h);
-                //                double** Kp  = K[symm * x.size() + N]->pointer(h);
-                //                double** Vp  = V[symm * x.size() + N]->pointer(h);
-
-                // TODO: hybrid/RC terms
-                // -(ij|ab)P_jb = C_im K_mn C_na
-                // C_DGEMM('T','N',nocc,nsovir,nsoocc,1.0,Cop[0],nocc,Kp[0],nsovir,0.0,Tp,nsovir);
-                // C_DGEMM('N','N',nocc,nvir,nsovir,-1.0,Tp,nsovir,Cvp[0],nvir,0.0,&bp[offset],nvir);
-
-                if (singlet_) {
-                    // 2(ia|jb)P_jb = C_im J_mn C_na
-                    C_DGEMM('T', 'N', nocc, nsovir, nsoocc, 1.0, Cop[0], nocc, Jp[0], nsovir, 0.0, Tp, nsovir);
-                    C_DGEMM('N', 'N', nocc, nvir, nsovir, 2.0, Tp, nsovir, Cvp[0], nvir, 1.0, &bp[offset], nvir);
-                }
-
-                // V matrix
-                // C_DGEMM('T','N',nocc,nsovir,nsoocc,1.0,Cop[0],nocc,Vp[0],nsovir,0.0,Tp,nsovir);
-                // C_DGEMM('N','N',nocc,nvir,nsovir,1.0,Tp,nsovir,Cvp[0],nvir,1.0,&bp[offset],nvir);
+                // C_im F_mn C_na
+                C_DGEMM('T', 'N', nocc, nsovir, nsoocc, 1.0, Cop[0], nocc, Fp[0], nsovir, 0.0, Tp, nsovir);
+                C_DGEMM('N', 'N', nocc, nvir, nsovir, 1.0, Tp, nsovir, Cvp[0], nvir, 0.0, &bp[offset], nvir);
 
                 for (int i = 0; i < nocc; ++i) {
                     for (int a = 0; a < nvir; ++a) {
@@ -263,6 +263,8 @@ class CPHFRHamiltonian : public RHamiltonian {
 class TDARHamiltonian : public CISRHamiltonian {
    protected:
     SharedMatrix Cocc_;
+    /// Transition symmetry to solve for, or -1 for all irreps
+    int symmetry_;
 
    public:
     TDARHamiltonian(std::shared_ptr<JK> jk, std::shared_ptr<VBase> v, SharedMatrix Cocc, SharedMatrix Caocc,
@@ -270,7 +272,12 @@ class TDARHamiltonian : public CISRHamiltonian {
     ~TDARHamiltonian() override;
 
     void print_header() const override;
+    std::shared_ptr<Vector> diagonal() override;
+    /// All trial vectors are contracted in a single JK and Vx pass
     void product(const std::vector<std::shared_ptr<Vector> >& x, std::vector<std::shared_ptr<Vector> >& b) override;
+
+    /// Restrict the problem to a single transition symmetry (-1, the default, keeps all irreps)
+    void set_symmetry(int symmetry) { symmetry_ = symmetry; }
 };
 
 class TDDFTRHamiltonian : public TDHFRHamiltonian {
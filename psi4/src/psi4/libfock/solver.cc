@@ -589,6 +589,7 @@ DLRSolver::DLRSolver(std::shared_ptr<RHamiltonian> H)
       max_subspace_(6),
       min_subspace_(2),
       nguess_(1),
+      e_criteria_(0.0),
       nsubspace_(0),
       nconverged_(0) {
     name_ = "DLR";
@@ -642,6 +643,7 @@ void DLRSolver::print_header() const {
         outfile->Printf("   Minimum subspace size   = %11d\n", min_subspace_);
         outfile->Printf("   Subspace expansion norm = %11.0E\n", norm_);
         outfile->Printf("   Convergence cutoff      = %11.0E\n", criteria_);
+        if (e_criteria_ > 0.0) outfile->Printf("   Eigenvalue cutoff       = %11.0E\n", e_criteria_);
         outfile->Printf("   Maximum iterations      = %11d\n", maxiter_);
         outfile->Printf("   Preconditioning         = %11s\n\n", precondition_.c_str());
     }
@@ -659,6 +661,7 @@ void DLRSolver::initialize() {
 
     c_.clear();
     E_.clear();
+    E_old_.clear();
 
     diag_ = H_->diagonal();
 }
@@ -949,6 +952,7 @@ void DLRSolver::eigenvecs() {
     }
 }
 void DLRSolver::eigenvals() {
+    E_old_ = E_;
     E_.clear();
     E_.resize(nroot_);
 
@@ -968,6 +972,14 @@ void DLRSolver::eigenvals() {
         outfile->Printf("\n");
     }
 }
+bool DLRSolver::eigenvalue_converged(int k) const {
+    if (e_criteria_ <= 0.0) return true;
+    if (E_old_.size() != E_.size()) return false;
+    for (size_t h = 0; h < E_[k].size(); ++h) {
+        if (std::fabs(E_[k][h] - E_old_[k][h]) >= e_criteria_) return false;
+    }
+    return true;
+}
 void DLRSolver::residuals() {
     n_.resize(nroot_);
     nconverged_ = 0;
@@ -1011,7 +1023,7 @@ void DLRSolver::residuals() {
         // Residual norm k
         double rnorm = sqrt(R2 / S2);
         n_[k] = rnorm;
-        if (rnorm < criteria_) {
+        if (rnorm < criteria_ && eigenvalue_converged(k)) {
             nconverged_++;
         }
     }
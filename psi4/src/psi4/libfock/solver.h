@@ -276,6 +276,8 @@ class DLRSolver : public RSolver {
     int min_subspace_;
     /// Number of guess vectors to build
     int nguess_;
+    /// Maximum eigenvalue change for a root to converge, in addition to the residual (0.0 disables)
+    double e_criteria_;
 
     // => Iteration values <= //
 
@@ -290,6 +292,8 @@ class DLRSolver : public RSolver {
     std::vector<std::shared_ptr<Vector> > c_;
     /// Current eigenvalues (nroots)
     std::vector<std::vector<double> > E_;
+    /// Eigenvalues of the previous iteration (nroots)
+    std::vector<std::vector<double> > E_old_;
     /// B vectors (nsubspace)
     std::vector<std::shared_ptr<Vector> > b_;
     /// Sigma vectors (nsubspace)
@@ -329,6 +333,8 @@ class DLRSolver : public RSolver {
     void eigenvals();
     // Find residuals, update convergence
     void residuals();
+    // Whether the eigenvalues of root k changed by less than e_criteria_
+    bool eigenvalue_converged(int k) const;
     // Find correctors
     virtual void correctors();
     // Orthogonalize/add significant correctors
@@ -374,6 +380,8 @@ class DLRSolver : public RSolver {
     void set_nguess(int nguess) { nguess_ = nguess; }
     /// Set norm critera for adding vectors to subspace (defaults to 1.0E-6)
     void set_norm(double norm) { norm_ = norm; }
+    /// Set eigenvalue change criteria for convergence (defaults to 0.0, residual only)
+    void set_energy_convergence(double e_criteria) { e_criteria_ = e_criteria; }
 };
 
 class RayleighRSolver : public DLRSolver {
@@ -372,6 +372,28 @@ std::vector<std::tuple<std::string, int, double>> LibXCFunctional::get_mix_data(
     }
     return ret;
 }
+size_t LibXCFunctional::workspace_size(int npoints, int deriv) const {
+    // Per-point doubles, laid out as the arrays are taken in compute_functional
+    size_t nper = 0;
+    if (unpolarized_) {
+        if (deriv >= 1) {
+            nper += 2;  // fv, fv_rho
+            if (gga_) nper += 1;  // fv_gamma
+            if (meta_) nper += 3;  // flapl, fv_lapl, fv_tau
+        }
+        if (deriv >= 2) {
+            nper += (gga_ ? 3 : 1);  // fv2_rho2 (, fv2_rho_gamma, fv2_gamma2)
+        }
+    } else {
+        nper += 2 + 1 + 2;  // frho, fv, fv_rho
+        if (gga_) nper += 3 + 3;  // fgamma, fv_gamma
+        if (meta_) nper += 4 * 2;  // ftau, flapl, fv_lapl, fv_tau
+        if (deriv >= 2) {
+            nper += (gga_ ? 3 + 6 + 6 : 3);  // fv2_rho2 (, fv2_rhogamma, fv2_gamma2)
+        }
+    }
+    return nper * npoints;
+}
 void LibXCFunctional::compute_functional(const std::map<std::string, SharedVector>& in,
                                          const std::map<std::string, SharedVector>& out, int npoints, int deriv) {
     // => Input variables <= //
@@ -555,6 +577,24 @@ void LibXCFunctional::compute_functional(const std::map<std::string, SharedVecto
         }
     }
 
+    // => Scratch <= //
+
+    // Carved from the workspace shared with the other functionals of this thread, zeroed as fresh vectors would be
+    size_t nwork = workspace_size(npoints, deriv);
+    if (!workspace_) {
+        workspace_ = std::make_shared<std::vector<double>>();
+    }
+    if (workspace_->size() < nwork) {
+        workspace_->resize(nwork);
+    }
+    std::fill_n(workspace_->data(), nwork, 0.0);
+    double* work = workspace_->data();
+    auto take = [&work](size_t n) {
+        double* block = work;
+        work += n;
+        return block;
+    };
+
     if (unpolarized_) {
         if (deriv == 0) {
             throw PSIEXCEPTION("LibXCFunction deriv=0 is not implemented, call deriv >=1");
@@ -563,38 +603,39 @@ void LibXCFunctional::compute_functional(const std::map<std::string, SharedVecto
         // Compute deriv
         if (deriv >= 1) {
             // Allocate
-            std::vector<double> fv(npoints);
-            std::vector<double> fv_rho(npoints);
+            double* fv = take(npoints);
+            double* fv_rho = take(npoints);
 
             // GGA
-            std::vector<double> fgamma, fv_gamma;
+            double* fv_gamma = nullptr;
             if (gga_) {
-                fgamma.resize(npoints);
-                fv_gamma.resize(npoints);
+                fv_gamma = take(npoints);
             }
 
             // Meta
-            std::vector<double> flapl, fv_lapl, fv_tau;
+            double* flapl = nullptr;
+            double* fv_lapl = nullptr;
+            double* fv_tau = nullptr;
             if (meta_) {
-                flapl.resize(npoints);
-                fv_lapl.resize(npoints);
-                fv_tau.resize(npoints);
+                flapl = take(npoints);
+                fv_lapl = take(npoints);
+                fv_tau = take(npoints);
             }
 
             double* fvp = nullptr;
             if (exc_) {
-                fvp = fv.data();
+                fvp = fv;
             }
 
             // Compute
             if (meta_) {
-                xc_mgga_exc_vxc(xc_functional_.get(), npoints, rho_ap, gamma_aap, flapl.data(), tau_ap, fvp,
-                                fv_rho.data(), fv_gamma.data(), fv_lapl.data(), fv_tau.data());
+                xc_mgga_exc_vxc(xc_functional_.get(), npoints, rho_ap, gamma_aap, flapl, tau_ap, fvp, fv_rho,
+                                fv_gamma, fv_lapl, fv_tau);
             } else if (gga_) {
-                xc_gga_exc_vxc(xc_functional_.get(), npoints, rho_ap, gamma_aap, fvp, fv_rho.data(), fv_gamma.data());
+                xc_gga_exc_vxc(xc_functional_.get(), npoints, rho_ap, gamma_aap, fvp, fv_rho, fv_gamma);
 
             } else {
-                xc_lda_exc_vxc(xc_functional_.get(), npoints, rho_ap, fvp, fv_rho.data());
+                xc_lda_exc_vxc(xc_functional_.get(), npoints, rho_ap, fvp, fv_rho);
             }
             // printf("%s | %lf %lf\n", xc_func_name_.c_str(), fv_rho[0], fv_gamma[0]);
 
@@ -605,14 +646,14 @@ void LibXCFunctional::compute_functional(const std::map<std::string, SharedVecto
                 }
             }
 
-            C_DAXPY(npoints, alpha_, fv_rho.data(), 1, v_rho_a, 1);
+            C_DAXPY(npoints, alpha_, fv_rho, 1, v_rho_a, 1);
 
             if (gga_) {
-                C_DAXPY(npoints, alpha_, fv_gamma.data(), 1, v_gamma_aa, 1);
+                C_DAXPY(npoints, alpha_, fv_gamma, 1, v_gamma_aa, 1);
             }
 
             if (meta_) {
-                C_DAXPY(npoints, 0.5 * alpha_, fv_tau.data(), 1, v_tau_a, 1);
+                C_DAXPY(npoints, 0.5 * alpha_, fv_tau, 1, v_tau_a, 1);
             }
         }
 
@@ -624,55 +665,58 @@ void LibXCFunctional::compute_functional(const std::map<std::string, SharedVecto
                     "available");
 
             } else if (gga_) {
-                std::vector<double> fv2_rho2(npoints);
-                std::vector<double> fv2_rho_gamma(npoints);
-                std::vector<double> fv2_gamma2(npoints);
+                double* fv2_rho2 = take(npoints);
+                double* fv2_rho_gamma = take(npoints);
+                double* fv2_gamma2 = take(npoints);
 
-                xc_gga_fxc(xc_functional_.get(), npoints, rho_ap, gamma_aap, fv2_rho2.data(), fv2_rho_gamma.data(),
-                           fv2_gamma2.data());
+                xc_gga_fxc(xc_functional_.get(), npoints, rho_ap, gamma_aap, fv2_rho2, fv2_rho_gamma, fv2_gamma2);
 
-                C_DAXPY(npoints, alpha_, fv2_rho2.data(), 1, v_rho_a_rho_a, 1);
-                C_DAXPY(npoints, alpha_, fv2_gamma2.data(), 1, v_gamma_aa_gamma_aa, 1);
-                C_DAXPY(npoints, alpha_, fv2_rho_gamma.data(), 1, v_rho_a_gamma_aa, 1);
+                C_DAXPY(npoints, alpha_, fv2_rho2, 1, v_rho_a_rho_a, 1);
+                C_DAXPY(npoints, alpha_, fv2_gamma2, 1, v_gamma_aa_gamma_aa, 1);
+                C_DAXPY(npoints, alpha_, fv2_rho_gamma, 1, v_rho_a_gamma_aa, 1);
 
             } else {
-                std::vector<double> fv2_rho2(npoints);
+                double* fv2_rho2 = take(npoints);
 
-                xc_lda_fxc(xc_functional_.get(), npoints, rho_ap, fv2_rho2.data());
+                xc_lda_fxc(xc_functional_.get(), npoints, rho_ap, fv2_rho2);
 
-                C_DAXPY(npoints, alpha_, fv2_rho2.data(), 1, v_rho_a_rho_a, 1);
+                C_DAXPY(npoints, alpha_, fv2_rho2, 1, v_rho_a_rho_a, 1);
             }
         }
 
     } else {  // End unpolarized
 
         // Allocate input data
-        std::vector<double> frho(npoints * 2);
-        std::vector<double> fv(npoints);
-        std::vector<double> fv_rho(npoints * 2);
+        double* frho = take(npoints * 2);
+        double* fv = take(npoints);
+        double* fv_rho = take(npoints * 2);
 
-        C_DCOPY(npoints, rho_ap, 1, frho.data(), 2);
-        C_DCOPY(npoints, rho_bp, 1, (frho.data() + 1), 2);
+        C_DCOPY(npoints, rho_ap, 1, frho, 2);
+        C_DCOPY(npoints, rho_bp, 1, (frho + 1), 2);
 
-        std::vector<double> fgamma, fv_gamma;
+        double* fgamma = nullptr;
+        double* fv_gamma = nullptr;
         if (gga_) {
-            fgamma.resize(npoints * 3);
-            fv_gamma.resize(npoints * 3);
+            fgamma = take(npoints * 3);
+            fv_gamma = take(npoints * 3);
 
-            C_DCOPY(npoints, gamma_aap, 1, fgamma.data(), 3);
-            C_DCOPY(npoints, gamma_abp, 1, (fgamma.data() + 1), 3);
-            C_DCOPY(npoints, gamma_bbp, 1, (fgamma.data() + 2), 3);
+            C_DCOPY(npoints, gamma_aap, 1, fgamma, 3);
+            C_DCOPY(npoints, gamma_abp, 1, (fgamma + 1), 3);
+            C_DCOPY(npoints, gamma_bbp, 1, (fgamma + 2), 3);
         }
 
-        std::vector<double> ftau, flapl, fv_lapl, fv_tau;
+        double* ftau = nullptr;
+        double* flapl = nullptr;
+        double* fv_lapl = nullptr;
+        double* fv_tau = nullptr;
         if (meta_) {
-            ftau.resize(npoints * 2);
-            flapl.resize(npoints * 2);
-            fv_lapl.resize(npoints * 2);
-            fv_tau.resize(npoints * 2);
+            ftau = take(npoints * 2);
+            flapl = take(npoints * 2);
+            fv_lapl = take(npoints * 2);
+            fv_tau = take(npoints * 2);
 
-            C_DCOPY(npoints, tau_ap, 1, ftau.data(), 2);
-            C_DCOPY(npoints, tau_bp, 1, (ftau.data() + 1), 2);
+            C_DCOPY(npoints, tau_ap, 1, ftau, 2);
+            C_DCOPY(npoints, tau_bp, 1, (ftau + 1), 2);
         }
 
         // Compute first deriv
@@ -683,21 +727,20 @@ void LibXCFunctional::compute_functional(const std::map<std::string, SharedVecto
             // Special cases
             double* fvp;
             if (exc_) {
-                fvp = fv.data();
+                fvp = fv;
             } else {
                 fvp = nullptr;
             }
 
             if (meta_) {
-                xc_mgga_exc_vxc(xc_functional_.get(), npoints, frho.data(), fgamma.data(), flapl.data(), ftau.data(),
-                                fvp, fv_rho.data(), fv_gamma.data(), fv_lapl.data(), fv_tau.data());
+                xc_mgga_exc_vxc(xc_functional_.get(), npoints, frho, fgamma, flapl, ftau, fvp, fv_rho, fv_gamma,
+                                fv_lapl, fv_tau);
 
             } else if (gga_) {
-                xc_gga_exc_vxc(xc_functional_.get(), npoints, frho.data(), fgamma.data(), fvp, fv_rho.data(),
-                               fv_gamma.data());
+                xc_gga_exc_vxc(xc_functional_.get(), npoints, frho, fgamma, fvp, fv_rho, fv_gamma);
 
             } else {
-                xc_lda_exc_vxc(xc_functional_.get(), npoints, frho.data(), fvp, fv_rho.data());
+                xc_lda_exc_vxc(xc_functional_.get(), npoints, frho, fvp, fv_rho);
             }
 
             // Re-apply
@@ -707,18 +750,18 @@ void LibXCFunctional::compute_functional(const std::map<std::string, SharedVecto
                 }
             }
 
-            C_DAXPY(npoints, alpha_, fv_rho.data(), 2, v_rho_a, 1);
-            C_DAXPY(npoints, alpha_, (fv_rho.data() + 1), 2, v_rho_b, 1);
+            C_DAXPY(npoints, alpha_, fv_rho, 2, v_rho_a, 1);
+            C_DAXPY(npoints, alpha_, (fv_rho + 1), 2, v_rho_b, 1);
 
             if (gga_) {
-                C_DAXPY(npoints, alpha_, fv_gamma.data(), 3, v_gamma_aa, 1);
-                C_DAXPY(npoints, alpha_, (fv_gamma.data() + 1), 3, v_gamma_ab, 1);
-                C_DAXPY(npoints, alpha_, (fv_gamma.data() + 2), 3, v_gamma_bb, 1);
+                C_DAXPY(npoints, alpha_, fv_gamma, 3, v_gamma_aa, 1);
+                C_DAXPY(npoints, alpha_, (fv_gamma + 1), 3, v_gamma_ab, 1);
+                C_DAXPY(npoints, alpha_, (fv_gamma + 2), 3, v_gamma_bb, 1);
             }
 
             if (meta_) {
-                C_DAXPY(npoints, 0.5 * alpha_, fv_tau.data(), 2, v_tau_a, 1);
-                C_DAXPY(npoints, 0.5 * alpha_, (fv_tau.data() + 1), 2, v_tau_b, 1);
+                C_DAXPY(npoints, 0.5 * alpha_, fv_tau, 2, v_tau_a, 1);
+                C_DAXPY(npoints, 0.5 * alpha_, (fv_tau + 1), 2, v_tau_b, 1);
             }
         }
 
@@ -728,12 +771,11 @@ void LibXCFunctional::compute_functional(const std::map<std::string, SharedVecto
                 throw PSIEXCEPTION("Second derivative for meta functionals is not yet available");
 
             } else if (gga_) {
-                std::vector<double> fv2_rho2(npoints * 3);
-                std::vector<double> fv2_rhogamma(npoints * 6);
-                std::vector<double> fv2_gamma2(npoints * 6);
+                double* fv2_rho2 = take(npoints * 3);
+                double* fv2_rhogamma = take(npoints * 6);
+                double* fv2_gamma2 = take(npoints * 6);
 
-                xc_gga_fxc(xc_functional_.get(), npoints, frho.data(), fgamma.data(), fv2_rho2.data(),
-                           fv2_rhogamma.data(), fv2_gamma2.data());
+                xc_gga_fxc(xc_functional_.get(), npoints, frho, fgamma, fv2_rho2, fv2_rhogamma, fv2_gamma2);
 
                 for (size_t i = 0; i < npoints; i++) {
                     // v2rho2(3)       = (u_u, u_d, d_d)
@@ -759,9 +801,9 @@ void LibXCFunctional::compute_functional(const std::map<std::string, SharedVecto
                 }
 
             } else {
-                std::vector<double> fv2_rho2(npoints * 3);
+                double* fv2_rho2 = take(npoints * 3);
 
-                xc_lda_fxc(xc_functional_.get(), npoints, frho.data(), fv2_rho2.data());
+                xc_lda_fxc(xc_functional_.get(), npoints, frho, fv2_rho2);
 
                 for (size_t i = 0; i < npoints; i++) {
                     // v2rho2(3)       = (u_u, u_d, d_d)
@@ -72,6 +72,7 @@ class LibXCFunctional : public Functional {
 
     void compute_functional(const std::map<std::string, SharedVector>& in,
                             const std::map<std::string, SharedVector>& out, int npoints, int deriv) override;
+    size_t workspace_size(int npoints, int deriv) const override;
 
     // Clones a *worker* for the functional. This is not a complete functional
     std::shared_ptr<Functional> build_worker() override;
@@ -79,6 +79,10 @@ class Functional {
     // Tau-based cutoff
     double meta_cutoff_;
 
+    // Scratch for intermediate LibXC-layout arrays, shared with the other components of one (per-thread)
+    // SuperFunctional, see SuperFunctional::allocate
+    std::shared_ptr<std::vector<double>> workspace_;
+
     // Initialize null functional
     void common_init();
 
@@ -99,6 +103,11 @@ class Functional {
     virtual void compute_functional(const std::map<std::string, SharedVector>& in,
                                     const std::map<std::string, SharedVector>& out, int npoints, int deriv) = 0;
 
+    // Number of scratch doubles compute_functional needs for a block of npoints
+    virtual size_t workspace_size(int npoints, int deriv) const { return 0; }
+    // Evaluate into the given scratch instead of allocating per block (it is grown if ever too small)
+    void set_workspace(std::shared_ptr<std::vector<double>> workspace) { workspace_ = workspace; }
+
     // => Parameters <= //
 
     const std::map<std::string, double>& parameters() { return parameters_; }
@@ -37,6 +37,7 @@
 #include "functional.h"
 #include "LibXCfunctional.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 
@@ -580,6 +581,35 @@ void SuperFunctional::allocate() {
         vv_values_["GRID_WY"] = std::make_shared<Vector>("W_Y_GRID", max_points_);
         vv_values_["GRID_WZ"] = std::make_shared<Vector>("W_Z_GRID", max_points_);
     }
+
+    // Component functionals are evaluated one after another on this thread, so they share one scratch arena
+    size_t nwork = 0;
+    for (auto& func : x_functionals_) {
+        nwork = std::max(nwork, func->workspace_size(max_points_, deriv_));
+    }
+    for (auto& func : c_functionals_) {
+        nwork = std::max(nwork, func->workspace_size(max_points_, deriv_));
+    }
+    if (grac_x_functional_) {
+        nwork = std::max(nwork, grac_x_functional_->workspace_size(max_points_, 1));
+    }
+    if (grac_c_functional_) {
+        nwork = std::max(nwork, grac_c_functional_->workspace_size(max_points_, 1));
+    }
+
+    workspace_ = std::make_shared<std::vector<double>>(nwork);
+    for (auto& func : x_functionals_) {
+        func->set_workspace(workspace_);
+    }
+    for (auto& func : c_functionals_) {
+        func->set_workspace(workspace_);
+    }
+    if (grac_x_functional_) {
+        grac_x_functional_->set_workspace(workspace_);
+    }
+    if (grac_c_functional_) {
+        grac_c_functional_->set_workspace(workspace_);
+    }
 }
 std::map<std::string, SharedVector>& SuperFunctional::compute_functional(
     const std::map<std::string, SharedVector>& vals, int npoints) {
@@ -101,6 +101,8 @@ class SuperFunctional {
     std::map<std::string, SharedVector> values_;
     std::map<std::string, SharedVector> ac_values_;
     std::map<std::string, SharedVector> vv_values_;
+    // Scratch shared by all component functionals of this (per-thread) superfunctional
+    std::shared_ptr<std::vector<double>> workspace_;
 
     // Set up a null Superfunctional
     void common_init();
@@ -38,6 +38,11 @@
 namespace psi {
 
 void IWL::fetch() {
+    if (format_ != IWL_FORMAT_PLAIN) {
+        iwl_packed_fetch(psio_, itap_, &bufpos_, &lastbuf_, &inbuf_, labels_, values_, ints_per_buf_);
+        idx_ = 0;
+        return;
+    }
     psio_->read(itap_, IWL_KEY_BUF, (char *)&(lastbuf_), sizeof(int), bufpos_, &bufpos_);
     psio_->read(itap_, IWL_KEY_BUF, (char *)&(inbuf_), sizeof(int), bufpos_, &bufpos_);
     psio_->read(itap_, IWL_KEY_BUF, (char *)labels_, ints_per_buf_ * 4 * sizeof(Label), bufpos_, &bufpos_);
@@ -53,6 +58,12 @@ void IWL::fetch() {
 ** \ingroup IWL
 */
 void PSI_API iwl_buf_fetch(struct iwlbuf *Buf) {
+    if (Buf->format != IWL_FORMAT_PLAIN) {
+        iwl_packed_fetch(_default_psio_lib_.get(), Buf->itap, &Buf->bufpos, &Buf->lastbuf, &Buf->inbuf, Buf->labels,
+                         Buf->values, Buf->ints_per_buf);
+        Buf->idx = 0;
+        return;
+    }
     psio_read(Buf->itap, IWL_KEY_BUF, (char *)&(Buf->lastbuf), sizeof(int), Buf->bufpos, &Buf->bufpos);
     psio_read(Buf->itap, IWL_KEY_BUF, (char *)&(Buf->inbuf), sizeof(int), Buf->bufpos, &Buf->bufpos);
     psio_read(Buf->itap, IWL_KEY_BUF, (char *)Buf->labels, Buf->ints_per_buf * 4 * sizeof(Label), Buf->bufpos,
@@ -51,6 +51,7 @@ IWL::IWL() {
     lastbuf_ = 0;
     inbuf_ = 0;
     idx_ = 0;
+    format_ = IWL_FORMAT_PLAIN;
 }
 
 IWL::IWL(PSIO *psio, int it, double coff, int oldfile, int readflag) : keep_(true) {
@@ -79,7 +80,8 @@ void IWL::init(PSIO *psio, int it, double coff, int oldfile, int readflag) {
     /*! open the output file */
     /*! Note that we assume that if oldfile isn't set, we O_CREAT the file */
     psio_->open(itap_, oldfile ? PSIO_OPEN_OLD : PSIO_OPEN_NEW);
-    if (oldfile && (psio_->tocscan(itap_, IWL_KEY_BUF) == nullptr)) {
+    format_ = iwl_file_format(psio_, itap_, oldfile);
+    if (oldfile && (psio_->tocscan(itap_, format_ == IWL_FORMAT_PLAIN ? IWL_KEY_BUF : IWL_KEY_PACKED_BUF) == nullptr)) {
         outfile->Printf("iwl_buf_init: Can't open file %d\n", itap_);
         psio_->close(itap_, 0);
         return;
@@ -125,7 +127,9 @@ void PSI_API iwl_buf_init(struct iwlbuf *Buf, int itape, double cutoff, int oldf
     /*! open the output file */
     /*! Note that we assume that if oldfile isn't set, we O_CREAT the file */
     psio_open(Buf->itap, oldfile ? PSIO_OPEN_OLD : PSIO_OPEN_NEW);
-    if (oldfile && (psio_tocscan(Buf->itap, IWL_KEY_BUF) == nullptr)) {
+    Buf->format = iwl_file_format(_default_psio_lib_.get(), Buf->itap, oldfile);
+    if (oldfile &&
+        (psio_tocscan(Buf->itap, Buf->format == IWL_FORMAT_PLAIN ? IWL_KEY_BUF : IWL_KEY_PACKED_BUF) == nullptr)) {
         outfile->Printf("iwl_buf_init: Can't open file %d\n", Buf->itap);
         psio_close(Buf->itap, 0);
         return;
@@ -0,0 +1,347 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*!
+  \file
+  \ingroup IWL
+
+  Packed IWL buffers.  A packed buffer holds the same integrals as a plain
+  one but is stored as a small header followed by a variable-length payload:
+
+     labels   each of p, q, r, s as a zigzag varint difference from the
+              label of the previous integral in the buffer
+     values   raw doubles, or (IWL_FORMAT_QUANTIZED) zigzag varints of
+              value/cutoff rounded to the nearest integer
+
+  The payload is then run through a byte-oriented LZ77 coder when that
+  makes it smaller.  Rounding to multiples of the write cutoff changes each
+  integral by at most cutoff/2, i.e. by less than what the cutoff already
+  discards.  Buffers whose values would overflow the quantized range are
+  stored losslessly.
+*/
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "psi4/libpsio/psio.hpp"
+#include "psi4/libpsi4util/exception.h"
+#include "psi4/libpsi4util/process.h"
+#include "iwl.h"
+
+namespace psi {
+
+namespace {
+
+const int IWL_PACKED_QUANTIZED = 1;
+const int IWL_PACKED_LZ = 2;
+
+struct IWLPackedHeader {
+    int lastbuf;   /* is this the last IWL buffer? 1=yes,0=no */
+    int inbuf;     /* how many ints in this buffer? */
+    int flags;     /* IWL_PACKED_QUANTIZED | IWL_PACKED_LZ */
+    int nbytes;    /* bytes of payload following the header */
+    int rawbytes;  /* bytes of payload before LZ compression */
+    int pad;
+    double quantum; /* value step for quantized buffers */
+};
+
+// Scratch space for encoding and decoding; one set per thread
+thread_local std::vector<unsigned char> raw_scratch;
+thread_local std::vector<unsigned char> lz_scratch;
+
+inline uint64_t zigzag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+inline int64_t unzigzag(uint64_t v) { return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+
+inline void put_varint(std::vector<unsigned char> &out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<unsigned char>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(v));
+}
+
+inline uint64_t get_varint(const unsigned char *&in, const unsigned char *end) {
+    uint64_t v = 0;
+    int shift = 0;
+    while (in < end) {
+        unsigned char b = *in++;
+        v |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if (!(b & 0x80)) return v;
+        shift += 7;
+    }
+    throw PSIEXCEPTION("IWL: truncated packed buffer.");
+}
+
+inline void put_length(std::vector<unsigned char> &out, size_t len) {
+    while (len >= 255) {
+        out.push_back(255);
+        len -= 255;
+    }
+    out.push_back(static_cast<unsigned char>(len));
+}
+
+inline size_t get_length(const unsigned char *&in, const unsigned char *end) {
+    size_t len = 0;
+    unsigned char b;
+    do {
+        if (in >= end) throw PSIEXCEPTION("IWL: truncated packed buffer.");
+        b = *in++;
+        len += b;
+    } while (b == 255);
+    return len;
+}
+
+inline uint32_t read32(const unsigned char *p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/*
+ * LZ77 with a single-probe hash of 4-byte sequences and a 64 kB window.
+ * Each sequence is a token (literal count << 4 | match length - 4, each
+ * nibble extended by 255-terminated bytes when it saturates), the literals,
+ * then a 2-byte offset.  The final sequence carries literals only.
+ */
+const size_t LZ_MIN_MATCH = 4;
+const int LZ_HASH_BITS = 13;
+
+void lz_compress(const std::vector<unsigned char> &in, std::vector<unsigned char> &out) {
+    out.clear();
+    size_t n = in.size();
+    std::vector<int> table(1 << LZ_HASH_BITS, -1);
+    const unsigned char *src = in.data();
+
+    auto emit = [&](size_t anchor, size_t nlit, size_t offset, size_t mlen) {
+        size_t mcode = mlen ? mlen - LZ_MIN_MATCH : 0;
+        out.push_back(static_cast<unsigned char>((std::min<size_t>(nlit, 15) << 4) | std::min<size_t>(mcode, 15)));
+        if (nlit >= 15) put_length(out, nlit - 15);
+        out.insert(out.end(), src + anchor, src + anchor + nlit);
+        if (!mlen) return;
+        out.push_back(static_cast<unsigned char>(offset & 0xff));
+        out.push_back(static_cast<unsigned char>(offset >> 8));
+        if (mcode >= 15) put_length(out, mcode - 15);
+    };
+
+    size_t ip = 0;
+    size_t anchor = 0;
+    while (ip + LZ_MIN_MATCH <= n) {
+        uint32_t seq = read32(src + ip);
+        uint32_t h = (seq * 2654435761U) >> (32 - LZ_HASH_BITS);
+        int ref = table[h];
+        table[h] = static_cast<int>(ip);
+        if (ref >= 0 && ip - ref <= 0xffff && read32(src + ref) == seq) {
+            size_t len = LZ_MIN_MATCH;
+            while (ip + len < n && src[ref + len] == src[ip + len]) ++len;
+            emit(anchor, ip - anchor, ip - ref, len);
+            ip += len;
+            anchor = ip;
+        } else {
+            ++ip;
+        }
+    }
+    if (anchor < n) emit(anchor, n - anchor, 0, 0);
+}
+
+void lz_decompress(const unsigned char *in, size_t nin, std::vector<unsigned char> &out, size_t nout) {
+    out.resize(nout);
+    const unsigned char *end = in + nin;
+    size_t op = 0;
+    while (in < end) {
+        unsigned char token = *in++;
+        size_t nlit = token >> 4;
+        if (nlit == 15) nlit += get_length(in, end);
+        if (nlit > static_cast<size_t>(end - in) || op + nlit > nout)
+            throw PSIEXCEPTION("IWL: corrupt packed buffer.");
+        std::memcpy(out.data() + op, in, nlit);
+        in += nlit;
+        op += nlit;
+        if (in == end) break;
+
+        if (end - in < 2) throw PSIEXCEPTION("IWL: truncated packed buffer.");
+        size_t offset = in[0] | (static_cast<size_t>(in[1]) << 8);
+        in += 2;
+        size_t mlen = (token & 0x0f);
+        if (mlen == 15) mlen += get_length(in, end);
+        mlen += LZ_MIN_MATCH;
+        if (offset == 0 || offset > op || op + mlen > nout) throw PSIEXCEPTION("IWL: corrupt packed buffer.");
+        // Matches may overlap their own output, so copy bytewise
+        unsigned char *dst = out.data() + op;
+        const unsigned char *ref = dst - offset;
+        for (size_t i = 0; i < mlen; ++i) dst[i] = ref[i];
+        op += mlen;
+    }
+    if (op != nout) throw PSIEXCEPTION("IWL: corrupt packed buffer.");
+}
+
+}  // namespace
+
+/*!
+** iwl_default_format()
+**
+** The format new IWL files are written in, from the global
+** INTEGRAL_FILE_FORMAT keyword.
+** \ingroup IWL
+*/
+int iwl_default_format() {
+    if (!Process::environment.options.exists("INTEGRAL_FILE_FORMAT")) return IWL_FORMAT_PLAIN;
+    std::string format = Process::environment.options.get_str("INTEGRAL_FILE_FORMAT");
+    if (format == "PACKED") return IWL_FORMAT_PACKED;
+    if (format == "QUANTIZED") return IWL_FORMAT_QUANTIZED;
+    return IWL_FORMAT_PLAIN;
+}
+
+/*!
+** iwl_file_format()
+**
+** Decides the format of an IWL file.  Existing files keep the format they
+** were written in, new ones use iwl_default_format().
+** \ingroup IWL
+*/
+int iwl_file_format(PSIO *psio, int itap, int oldfile) {
+    int format = iwl_default_format();
+    if (!oldfile) return format;
+    if (psio->tocscan(itap, IWL_KEY_PACKED_BUF) != nullptr)
+        return format == IWL_FORMAT_PLAIN ? IWL_FORMAT_PACKED : format;
+    if (psio->tocscan(itap, IWL_KEY_BUF) != nullptr) return IWL_FORMAT_PLAIN;
+    return format;
+}
+
+/*!
+** iwl_packed_put()
+**
+** Encode the first inbuf integrals of labels/values and write them as one
+** packed buffer at bufpos.
+** \ingroup IWL
+*/
+void iwl_packed_put(PSIO *psio, int itap, psio_address *bufpos, int lastbuf, int inbuf, const Label *labels,
+                    const Value *values, int format, double cutoff) {
+    IWLPackedHeader header;
+    header.lastbuf = lastbuf;
+    header.inbuf = inbuf;
+    header.flags = 0;
+    header.pad = 0;
+    header.quantum = 0.0;
+
+    // Quantize only when every value fits comfortably in 62 bits of steps
+    if (format == IWL_FORMAT_QUANTIZED && cutoff > 0.0) {
+        double vmax = 0.0;
+        for (int i = 0; i < inbuf; ++i) vmax = std::max(vmax, std::fabs(values[i]));
+        if (vmax / cutoff < 4.0e18) {
+            header.flags |= IWL_PACKED_QUANTIZED;
+            header.quantum = cutoff;
+        }
+    }
+
+    std::vector<unsigned char> &raw = raw_scratch;
+    raw.clear();
+    raw.reserve(static_cast<size_t>(inbuf) * (4 + sizeof(Value)));
+
+    int prev[4] = {0, 0, 0, 0};
+    for (int i = 0; i < inbuf; ++i) {
+        for (int k = 0; k < 4; ++k) {
+            int label = labels[4 * i + k];
+            put_varint(raw, zigzag(label - prev[k]));
+            prev[k] = label;
+        }
+    }
+    if (header.flags & IWL_PACKED_QUANTIZED) {
+        double inv = 1.0 / header.quantum;
+        for (int i = 0; i < inbuf; ++i) put_varint(raw, zigzag(std::llround(values[i] * inv)));
+    } else {
+        const unsigned char *v = reinterpret_cast<const unsigned char *>(values);
+        raw.insert(raw.end(), v, v + inbuf * sizeof(Value));
+    }
+
+    std::vector<unsigned char> &lz = lz_scratch;
+    lz_compress(raw, lz);
+
+    std::vector<unsigned char> *payload = &raw;
+    if (lz.size() < raw.size()) {
+        header.flags |= IWL_PACKED_LZ;
+        payload = &lz;
+    }
+    header.rawbytes = static_cast<int>(raw.size());
+    header.nbytes = static_cast<int>(payload->size());
+
+    psio->write(itap, IWL_KEY_PACKED_BUF, (char *)&header, sizeof(IWLPackedHeader), *bufpos, bufpos);
+    if (header.nbytes)
+        psio->write(itap, IWL_KEY_PACKED_BUF, (char *)payload->data(), header.nbytes, *bufpos, bufpos);
+}
+
+/*!
+** iwl_packed_fetch()
+**
+** Read one packed buffer at bufpos and expand it into labels/values.
+** Entries past inbuf are zeroed, as in a plain IWL buffer.
+** \ingroup IWL
+*/
+void iwl_packed_fetch(PSIO *psio, int itap, psio_address *bufpos, int *lastbuf, int *inbuf, Label *labels,
+                      Value *values, int ints_per_buf) {
+    IWLPackedHeader header;
+    psio->read(itap, IWL_KEY_PACKED_BUF, (char *)&header, sizeof(IWLPackedHeader), *bufpos, bufpos);
+    if (header.inbuf < 0 || header.inbuf > ints_per_buf)
+        throw PSIEXCEPTION("IWL: packed buffer holds more integrals than the buffer size.");
+
+    std::vector<unsigned char> &lz = lz_scratch;
+    lz.resize(header.nbytes);
+    if (header.nbytes)
+        psio->read(itap, IWL_KEY_PACKED_BUF, (char *)lz.data(), header.nbytes, *bufpos, bufpos);
+
+    std::vector<unsigned char> *payload = &lz;
+    if (header.flags & IWL_PACKED_LZ) {
+        lz_decompress(lz.data(), lz.size(), raw_scratch, header.rawbytes);
+        payload = &raw_scratch;
+    }
+
+    const unsigned char *in = payload->data();
+    const unsigned char *end = in + payload->size();
+    int n = header.inbuf;
+
+    int prev[4] = {0, 0, 0, 0};
+    for (int i = 0; i < n; ++i) {
+        for (int k = 0; k < 4; ++k) {
+            prev[k] += static_cast<int>(unzigzag(get_varint(in, end)));
+            labels[4 * i + k] = static_cast<Label>(prev[k]);
+        }
+    }
+    if (header.flags & IWL_PACKED_QUANTIZED) {
+        for (int i = 0; i < n; ++i) values[i] = unzigzag(get_varint(in, end)) * header.quantum;
+    } else {
+        if (static_cast<size_t>(end - in) < n * sizeof(Value)) throw PSIEXCEPTION("IWL: truncated packed buffer.");
+        std::memcpy(values, in, n * sizeof(Value));
+    }
+
+    std::fill(labels + 4 * n, labels + 4 * ints_per_buf, 0);
+    std::fill(values + n, values + ints_per_buf, 0.0);
+
+    *lastbuf = header.lastbuf;
+    *inbuf = header.inbuf;
+}
+}
@@ -38,6 +38,10 @@
 namespace psi {
 
 void IWL::put() {
+    if (format_ != IWL_FORMAT_PLAIN) {
+        iwl_packed_put(psio_, itap_, &bufpos_, lastbuf_, inbuf_, labels_, values_, format_, cutoff_);
+        return;
+    }
     psio_->write(itap_, IWL_KEY_BUF, (char *)&(lastbuf_), sizeof(int), bufpos_, &(bufpos_));
     psio_->write(itap_, IWL_KEY_BUF, (char *)&(inbuf_), sizeof(int), bufpos_, &(bufpos_));
     psio_->write(itap_, IWL_KEY_BUF, (char *)labels_, ints_per_buf_ * 4 * sizeof(Label), bufpos_, &(bufpos_));
@@ -52,6 +56,11 @@ void IWL::put() {
 ** \ingroup IWL
 */
 void iwl_buf_put(struct iwlbuf *Buf) {
+    if (Buf->format != IWL_FORMAT_PLAIN) {
+        iwl_packed_put(_default_psio_lib_.get(), Buf->itap, &Buf->bufpos, Buf->lastbuf, Buf->inbuf, Buf->labels,
+                       Buf->values, Buf->format, Buf->cutoff);
+        return;
+    }
     psio_write(Buf->itap, IWL_KEY_BUF, (char *)&(Buf->lastbuf), sizeof(int), Buf->bufpos, &(Buf->bufpos));
     psio_write(Buf->itap, IWL_KEY_BUF, (char *)&(Buf->inbuf), sizeof(int), Buf->bufpos, &(Buf->bufpos));
     psio_write(Buf->itap, IWL_KEY_BUF, (char *)Buf->labels, Buf->ints_per_buf * 4 * sizeof(Label), Buf->bufpos,
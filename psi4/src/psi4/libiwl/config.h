@@ -35,9 +35,15 @@ typedef short int Label;
 typedef double Value;
 
 #define IWL_KEY_BUF "IWL Buffers"
+#define IWL_KEY_PACKED_BUF "IWL Packed Buffers"
 #define IWL_KEY_ONEL "IWL One-electron matrix elements"
 
 #define IWL_INTS_PER_BUF 2980
+
+/* On-disk buffer formats, see buf_packed.cc */
+#define IWL_FORMAT_PLAIN 0
+#define IWL_FORMAT_PACKED 1
+#define IWL_FORMAT_QUANTIZED 2
 }
 
 #endif
@@ -44,6 +44,8 @@
 #include "psi4/psi4-dec.h"
 namespace psi {
 
+class PSIO;
+
 struct iwlbuf {
     int itap;            /* tape number for input file */
     psio_address bufpos; /* current page/offset */
@@ -55,6 +57,7 @@ struct iwlbuf {
     int idx;             /* index of integral in current buffer */
     Label *labels;       /* pointer to where integral values begin */
     Value *values;       /* integral values */
+    int format;          /* IWL_FORMAT_PLAIN, _PACKED or _QUANTIZED */
 };
 
 void PSI_API iwl_buf_fetch(struct iwlbuf *Buf);
@@ -67,6 +70,13 @@ void iwl_buf_flush(struct iwlbuf *Buf, int lastbuf);
 void PSI_API iwl_buf_close(struct iwlbuf *Buf, int keep);
 void iwl_buf_wrt_val(struct iwlbuf *Buf, int p, int q, int r, int s, double value, int printflag, std::string out,
                      int dirac);
+
+int iwl_default_format();
+int iwl_file_format(PSIO *psio, int itap, int oldfile);
+void iwl_packed_put(PSIO *psio, int itap, psio_address *bufpos, int lastbuf, int inbuf, const Label *labels,
+                    const Value *values, int format, double cutoff);
+void iwl_packed_fetch(PSIO *psio, int itap, psio_address *bufpos, int *lastbuf, int *inbuf, Label *labels,
+                      Value *values, int ints_per_buf);
 }
 
 #endif /* end _psi_src_lib_libiwl_iwl_h */
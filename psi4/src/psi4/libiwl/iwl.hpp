@@ -46,6 +46,7 @@ class PSI_API IWL {
     int idx_;             /* index of integral in current buffer */
     Label *labels_;       /* pointer to where integral values begin */
     Value *values_;       /* integral values */
+    int format_;          /* IWL_FORMAT_PLAIN, _PACKED or _QUANTIZED */
     /*! Instance of libpsio to use */
     PSIO *psio_;
     /*! Flag indicating whether to keep the IWL file or not */
@@ -68,6 +69,7 @@ class PSI_API IWL {
     Label *labels() { return labels_; }
     Value *values() { return values_; }
     bool &keep() { return keep_; }
+    int &format() { return format_; }
 
     void init(PSIO *psio, int itap, double cutoff, int oldfile, int readflag);
 
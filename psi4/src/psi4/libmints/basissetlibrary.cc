@@ -0,0 +1,367 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#include "psi4/libmints/basissetlibrary.h"
+#include "psi4/libpsi4util/exception.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+namespace psi {
+
+namespace {
+
+// File layout, all integers native-endian:
+//   Header
+//   SourceRecord[nsource]   sorted by path
+//   EntryRecord[nentry]     grouped by source, sorted by symbol within a source
+//   string data
+//   shell records: int32 puream, line, ecp_line, ncore, nshell, necp, then per shell
+//                  int32 am, nprim, double exponents[nprim], double coefficients[nprim]
+//                  (and int32 rpowers[nprim] for ECP shells)
+
+const char library_magic[8] = {'P', 'S', 'I', '4', 'B', 'L', 'I', 'B'};
+const uint32_t library_version = 1;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t nsource;
+    uint64_t nentry;
+};
+
+struct SourceRecord {
+    uint64_t path_offset;
+    uint64_t path_length;
+    int64_t size;
+    int64_t mtime;
+    uint64_t first_entry;
+    uint64_t nentry;
+};
+
+struct EntryRecord {
+    uint64_t symbol_offset;
+    uint64_t symbol_length;
+    uint64_t record_offset;
+};
+
+// Libraries opened by shared_library(), by filename
+std::mutex library_lock;
+std::map<std::string, std::shared_ptr<BasisSetLibrary>> open_libraries;
+
+bool stat_file(const std::string& path, int64_t& size, int64_t& mtime) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return false;
+    size = static_cast<int64_t>(st.st_size);
+    mtime = static_cast<int64_t>(st.st_mtime);
+    return true;
+}
+
+template <typename T>
+void append(std::vector<char>& buffer, const T* data, size_t n = 1) {
+    const char* bytes = reinterpret_cast<const char*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + n * sizeof(T));
+}
+
+void append_shell(std::vector<char>& buffer, const BasisSetLibrary::Shell& shell, bool ecp) {
+    int32_t am = shell.am;
+    int32_t nprim = shell.exponents.size();
+    if (shell.coefficients.size() != shell.exponents.size() || (ecp && shell.rpowers.size() != shell.exponents.size()))
+        throw PSIEXCEPTION("BasisSetLibrary: shell with inconsistent primitive counts.");
+    append(buffer, &am);
+    append(buffer, &nprim);
+    append(buffer, shell.exponents.data(), nprim);
+    append(buffer, shell.coefficients.data(), nprim);
+    if (ecp) {
+        std::vector<int32_t> rpowers(shell.rpowers.begin(), shell.rpowers.end());
+        append(buffer, rpowers.data(), nprim);
+    }
+}
+
+}  // namespace
+
+BasisSetLibrary::BasisSetLibrary(const std::string& filename)
+    : filename_(filename), data_(nullptr), size_(0), nsource_(0), nentry_(0), source_offset_(0), entry_offset_(0) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) throw PSIEXCEPTION("BasisSetLibrary: unable to open " + filename);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+        close(fd);
+        throw PSIEXCEPTION("BasisSetLibrary: " + filename + " is not a basis set library.");
+    }
+    size_ = st.st_size;
+
+    void* map = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) throw PSIEXCEPTION("BasisSetLibrary: unable to map " + filename);
+    data_ = static_cast<const char*>(map);
+
+    Header header;
+    std::memcpy(&header, data_, sizeof(Header));
+    if (std::memcmp(header.magic, library_magic, sizeof(library_magic)) != 0 || header.version != library_version ||
+        header.byte_order != 0x01020304u) {
+        munmap(const_cast<char*>(data_), size_);
+        throw PSIEXCEPTION("BasisSetLibrary: " + filename + " is not a compatible basis set library.");
+    }
+
+    nsource_ = header.nsource;
+    nentry_ = header.nentry;
+    source_offset_ = sizeof(Header);
+    entry_offset_ = source_offset_ + nsource_ * sizeof(SourceRecord);
+    if (entry_offset_ + nentry_ * sizeof(EntryRecord) > size_) {
+        munmap(const_cast<char*>(data_), size_);
+        throw PSIEXCEPTION("BasisSetLibrary: " + filename + " is truncated.");
+    }
+}
+
+BasisSetLibrary::~BasisSetLibrary() {
+    if (data_ != nullptr) munmap(const_cast<char*>(data_), size_);
+}
+
+std::shared_ptr<BasisSetLibrary> BasisSetLibrary::shared_library(const std::string& filename) {
+    std::lock_guard<std::mutex> guard(library_lock);
+    auto it = open_libraries.find(filename);
+    if (it != open_libraries.end()) return it->second;
+
+    std::shared_ptr<BasisSetLibrary> library;
+    if (access(filename.c_str(), R_OK) == 0) {
+        try {
+            library = std::make_shared<BasisSetLibrary>(filename);
+        } catch (const PsiException&) {
+            library = nullptr;
+        }
+    }
+    open_libraries[filename] = library;
+    return library;
+}
+
+void BasisSetLibrary::read(size_t offset, void* dest, size_t nbytes) const {
+    if (offset + nbytes > size_) throw PSIEXCEPTION("BasisSetLibrary: read past the end of " + filename_);
+    std::memcpy(dest, data_ + offset, nbytes);
+}
+
+std::string BasisSetLibrary::read_string(size_t offset, size_t length) const {
+    if (offset + length > size_) throw PSIEXCEPTION("BasisSetLibrary: read past the end of " + filename_);
+    return std::string(data_ + offset, length);
+}
+
+long int BasisSetLibrary::find_source(const std::string& path) const {
+    long int lo = 0;
+    long int hi = static_cast<long int>(nsource_) - 1;
+    SourceRecord source;
+    while (lo <= hi) {
+        long int mid = (lo + hi) / 2;
+        read(source_offset_ + mid * sizeof(SourceRecord), &source, sizeof(SourceRecord));
+        int cmp = path.compare(read_string(source.path_offset, source.path_length));
+        if (cmp == 0) return mid;
+        if (cmp < 0)
+            hi = mid - 1;
+        else
+            lo = mid + 1;
+    }
+    return -1;
+}
+
+size_t BasisSetLibrary::find_entry(long int index, const std::string& symbol) const {
+    SourceRecord source;
+    read(source_offset_ + index * sizeof(SourceRecord), &source, sizeof(SourceRecord));
+
+    long int lo = source.first_entry;
+    long int hi = static_cast<long int>(source.first_entry + source.nentry) - 1;
+    EntryRecord entry;
+    while (lo <= hi) {
+        long int mid = (lo + hi) / 2;
+        read(entry_offset_ + mid * sizeof(EntryRecord), &entry, sizeof(EntryRecord));
+        int cmp = symbol.compare(read_string(entry.symbol_offset, entry.symbol_length));
+        if (cmp == 0) return entry.record_offset;
+        if (cmp < 0)
+            hi = mid - 1;
+        else
+            lo = mid + 1;
+    }
+    return 0;
+}
+
+bool BasisSetLibrary::current(const std::string& path) const {
+    long int index = find_source(path);
+    if (index < 0) return false;
+
+    SourceRecord source;
+    read(source_offset_ + index * sizeof(SourceRecord), &source, sizeof(SourceRecord));
+    int64_t size, mtime;
+    if (!stat_file(path, size, mtime)) return false;
+    return size == source.size && mtime == source.mtime;
+}
+
+bool BasisSetLibrary::lookup(const std::string& path, const std::string& symbol, Entry& entry) const {
+    if (!current(path)) return false;
+    size_t offset = find_entry(find_source(path), symbol);
+    if (offset == 0) return false;
+
+    int32_t head[6];
+    read(offset, head, sizeof(head));
+    offset += sizeof(head);
+
+    entry.source = path;
+    entry.symbol = symbol;
+    entry.puream = head[0];
+    entry.line = head[1];
+    entry.ecp_line = head[2];
+    entry.ncore = head[3];
+
+    auto read_shells = [&](int nshell, bool ecp, std::vector<Shell>& shells) {
+        shells.resize(nshell);
+        for (Shell& shell : shells) {
+            int32_t am_nprim[2];
+            read(offset, am_nprim, sizeof(am_nprim));
+            offset += sizeof(am_nprim);
+            shell.am = am_nprim[0];
+            size_t nprim = am_nprim[1];
+            shell.exponents.resize(nprim);
+            shell.coefficients.resize(nprim);
+            read(offset, shell.exponents.data(), nprim * sizeof(double));
+            offset += nprim * sizeof(double);
+            read(offset, shell.coefficients.data(), nprim * sizeof(double));
+            offset += nprim * sizeof(double);
+            shell.rpowers.clear();
+            if (ecp) {
+                std::vector<int32_t> rpowers(nprim);
+                read(offset, rpowers.data(), nprim * sizeof(int32_t));
+                offset += nprim * sizeof(int32_t);
+                shell.rpowers.assign(rpowers.begin(), rpowers.end());
+            }
+        }
+    };
+    read_shells(head[4], false, entry.shells);
+    read_shells(head[5], true, entry.ecp_shells);
+    return true;
+}
+
+std::vector<ShellInfo> BasisSetLibrary::shells(const std::string& path, const std::string& symbol,
+                                               GaussianType puream) const {
+    Entry entry;
+    if (!lookup(path, symbol, entry))
+        throw PSIEXCEPTION("BasisSetLibrary: no current entry " + symbol + " for " + path + " in " + filename_);
+
+    std::vector<ShellInfo> shells;
+    shells.reserve(entry.shells.size());
+    for (const Shell& shell : entry.shells)
+        shells.push_back(ShellInfo(shell.am, shell.coefficients, shell.exponents, puream, Unnormalized));
+    return shells;
+}
+
+void BasisSetLibrary::compile(const std::string& filename, const std::vector<Entry>& entries) {
+    // Group entries by source and order both levels for the binary searches
+    std::map<std::string, std::map<std::string, const Entry*>> sources;
+    for (const Entry& entry : entries) sources[entry.source][entry.symbol] = &entry;
+
+    size_t nentry = 0;
+    for (const auto& source : sources) nentry += source.second.size();
+
+    std::vector<SourceRecord> source_records;
+    std::vector<EntryRecord> entry_records;
+    std::vector<char> strings;
+    std::vector<char> records;
+    size_t data_offset = sizeof(Header) + sources.size() * sizeof(SourceRecord) + nentry * sizeof(EntryRecord);
+
+    for (const auto& source : sources) {
+        SourceRecord srec;
+        if (!stat_file(source.first, srec.size, srec.mtime))
+            throw PSIEXCEPTION("BasisSetLibrary: unable to stat " + source.first);
+        srec.path_offset = strings.size();
+        srec.path_length = source.first.size();
+        srec.first_entry = entry_records.size();
+        srec.nentry = source.second.size();
+        strings.insert(strings.end(), source.first.begin(), source.first.end());
+        source_records.push_back(srec);
+
+        for (const auto& symbol : source.second) {
+            const Entry& entry = *symbol.second;
+            EntryRecord erec;
+            erec.symbol_offset = strings.size();
+            erec.symbol_length = symbol.first.size();
+            erec.record_offset = records.size();
+            strings.insert(strings.end(), symbol.first.begin(), symbol.first.end());
+            entry_records.push_back(erec);
+
+            int32_t head[6] = {entry.puream, entry.line, entry.ecp_line, entry.ncore,
+                               static_cast<int32_t>(entry.shells.size()), static_cast<int32_t>(entry.ecp_shells.size())};
+            append(records, head, 6);
+            for (const Shell& shell : entry.shells) append_shell(records, shell, false);
+            for (const Shell& shell : entry.ecp_shells) append_shell(records, shell, true);
+        }
+    }
+
+    // Offsets were collected relative to their own blocks; make them absolute
+    for (SourceRecord& srec : source_records) srec.path_offset += data_offset;
+    for (EntryRecord& erec : entry_records) {
+        erec.symbol_offset += data_offset;
+        erec.record_offset += data_offset + strings.size();
+    }
+
+    Header header;
+    std::memcpy(header.magic, library_magic, sizeof(library_magic));
+    header.version = library_version;
+    header.byte_order = 0x01020304u;
+    header.nsource = source_records.size();
+    header.nentry = entry_records.size();
+
+    // Write beside the target and rename, so concurrent jobs never map a partial file
+    std::string tmpname = filename + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream out(tmpname, std::ios::binary | std::ios::trunc);
+        if (!out) throw PSIEXCEPTION("BasisSetLibrary: unable to write " + tmpname);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        out.write(reinterpret_cast<const char*>(source_records.data()), source_records.size() * sizeof(SourceRecord));
+        out.write(reinterpret_cast<const char*>(entry_records.data()), entry_records.size() * sizeof(EntryRecord));
+        out.write(strings.data(), strings.size());
+        out.write(records.data(), records.size());
+        if (!out) throw PSIEXCEPTION("BasisSetLibrary: error writing " + tmpname);
+    }
+    if (std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+        std::remove(tmpname.c_str());
+        throw PSIEXCEPTION("BasisSetLibrary: unable to move library into place at " + filename);
+    }
+
+    // Later shared_library() calls see the new file; existing mappings keep the old one alive
+    std::lock_guard<std::mutex> guard(library_lock);
+    open_libraries.erase(filename);
+}
+
+}  // namespace psi
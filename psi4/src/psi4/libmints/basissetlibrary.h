@@ -0,0 +1,135 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#ifndef _psi_src_lib_libmints_basissetlibrary_h_
+#define _psi_src_lib_libmints_basissetlibrary_h_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "psi4/pragma.h"
+#include "psi4/libmints/gshell.h"
+
+namespace psi {
+
+/*! \ingroup MINTS
+ *  \class BasisSetLibrary
+ *  \brief Read-only, memory-mapped view of a precompiled basis set library.
+ *
+ * A library is a single binary file compiled once from Gaussian94 .gbs files.
+ * It holds a sorted table of source files (absolute path, size and
+ * modification time at compile time), a sorted table of the entries of each
+ * file, and the shell records of every entry.  Opening a library maps the
+ * file and reads nothing else; a lookup is two binary searches followed by
+ * decoding the one record asked for.
+ *
+ * Entries are only handed out for source files that are unchanged on disk,
+ * so a stale library silently falls back to parsing the text files.
+ */
+class PSI_API BasisSetLibrary {
+   public:
+    /// A shell as it appears in a .gbs file (contraction scale already applied)
+    struct Shell {
+        int am;
+        std::vector<double> exponents;
+        std::vector<double> coefficients;
+        /// Radial powers; ECP shells only
+        std::vector<int> rpowers;
+    };
+
+    /// One atom entry of a .gbs file
+    struct Entry {
+        /// Absolute path of the .gbs file
+        std::string source;
+        /// Entry label as matched by the parser (uppercase)
+        std::string symbol;
+        /// Spherical (1) or Cartesian (0) functions, as declared by the file
+        int puream = 1;
+        /// Line of the entry in the file, for the loading summary
+        int line = 0;
+        /// Line of the ECP entry, or 0 if there is none
+        int ecp_line = 0;
+        /// Number of core electrons replaced by the ECP
+        int ncore = 0;
+        std::vector<Shell> shells;
+        std::vector<Shell> ecp_shells;
+    };
+
+   protected:
+    std::string filename_;
+    /// Start of the mapping and its length in bytes
+    const char* data_;
+    size_t size_;
+
+    size_t nsource_;
+    size_t nentry_;
+    size_t source_offset_;
+    size_t entry_offset_;
+
+    /// Index of the source record for path, or -1
+    long int find_source(const std::string& path) const;
+    /// Offset of the shell record for (source, symbol), or 0 if absent
+    size_t find_entry(long int source, const std::string& symbol) const;
+    /// Bounds-checked copy out of the mapping
+    void read(size_t offset, void* dest, size_t nbytes) const;
+    std::string read_string(size_t offset, size_t length) const;
+
+   public:
+    /// Maps filename; throws if it is not a basis set library
+    explicit BasisSetLibrary(const std::string& filename);
+    ~BasisSetLibrary();
+
+    BasisSetLibrary(const BasisSetLibrary&) = delete;
+    BasisSetLibrary& operator=(const BasisSetLibrary&) = delete;
+
+    /// Opens filename once per process; nullptr if absent or unreadable
+    static std::shared_ptr<BasisSetLibrary> shared_library(const std::string& filename);
+
+    /// Writes a library holding entries, replacing filename atomically
+    static void compile(const std::string& filename, const std::vector<Entry>& entries);
+
+    const std::string& filename() const { return filename_; }
+    size_t nsource() const { return nsource_; }
+    size_t nentry() const { return nentry_; }
+
+    /// Is path in the library and unchanged since it was compiled?
+    bool current(const std::string& path) const;
+
+    /// Decodes the entry for symbol from source into entry; false if absent or stale
+    bool lookup(const std::string& source, const std::string& symbol, Entry& entry) const;
+
+    /// The basis shells of an entry, ready for the BasisSet constructor
+    std::vector<ShellInfo> shells(const std::string& source, const std::string& symbol, GaussianType puream) const;
+};
+
+}  // namespace psi
+
+#endif
@@ -26,10 +26,16 @@
  * @END LICENSE
  */
 
+#include "psi4/libmints/benchmark.h"
 #include "psi4/libmints/basisset.h"
 #include "psi4/libmints/molecule.h"
 #include "psi4/libmints/integral.h"
 #include "psi4/libmints/3coverlap.h"
+#include "psi4/libmints/matrix.h"
+#include "psi4/libfock/jk.h"
+#include "psi4/libfock/v.h"
+#include "psi4/libfock/cubature.h"
+#include "psi4/libfunctional/superfunctional.h"
 
 #include "psi4/libqt/qt.h"
 #include "psi4/libciomr/libciomr.h"
@@ -38,12 +44,18 @@
 #include "psi4/psi4-dec.h"
 #include "psi4/libpsi4util/libpsi4util.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
+#include "psi4/libpsi4util/process.h"
 
 #include <map>
 #include <string>
 #include <cmath>
 #include <cstdlib>
 #include <vector>
+#include <algorithm>
+#include <fstream>
+
+#include <sys/resource.h>
+#include <unistd.h>
 
 #ifdef USING_LAPACK_MKL
 #include <mkl.h>
@@ -2558,4 +2570,223 @@ void benchmark_integrals(int max_am, double min_time) {
     }
 }
 
+namespace {
+
+/// Process memory high-water mark [MiB], VmHWM where /proc is available
+double peak_rss_mb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) return std::atof(line.c_str() + 6) / 1024.0;
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+}
+
+/// Current resident set size [MiB]; falls back to the high-water mark without /proc
+double current_rss_mb() {
+    std::ifstream statm("/proc/self/statm");
+    size_t pages, resident;
+    if (statm >> pages >> resident) return resident * (double)sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+    return peak_rss_mb();
+}
+
+/// Lowers the high-water mark to the current RSS (Linux), so that the next
+/// peak_rss_mb() belongs to one builder rather than to the whole process
+void reset_peak_rss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs) clear_refs << "5";
+}
+
+/// Peak memory of one builder above the RSS before it was built [MiB]. Without
+/// a resettable high-water mark this is the rise of the process-wide peak.
+class BuilderMemory {
+    double base_;
+
+   public:
+    BuilderMemory() {
+        reset_peak_rss();
+        base_ = current_rss_mb();
+    }
+    double peak() const { return std::max(0.0, peak_rss_mb() - base_); }
+};
+
+/// 1, 2, 3, 4, 8, 16, ... up to and including max_threads, as in benchmark_blas3
+std::vector<int> thread_counts(int max_threads) {
+    std::vector<int> counts;
+    for (int thread = 1; thread <= max_threads; thread++) {
+        if (thread > 4 && thread % 8 != 0 && thread != max_threads) continue;
+        counts.push_back(thread);
+    }
+    return counts;
+}
+
+/// Fixed pseudo-random occupied block, nocc from the molecule's electron count
+SharedMatrix benchmark_occupied(std::shared_ptr<BasisSet> primary) {
+    std::shared_ptr<Molecule> mol = primary->molecule();
+    int nel = -mol->molecular_charge();
+    for (int A = 0; A < mol->natom(); A++) nel += (int)mol->Z(A);
+    int nbf = primary->nbf();
+    int nocc = std::min(std::max(nel / 2, 1), nbf);
+
+    auto C = std::make_shared<Matrix>("C", nbf, nocc);
+    double** Cp = C->pointer();
+    std::srand(1);
+    for (int m = 0; m < nbf; m++) {
+        for (int i = 0; i < nocc; i++) {
+            Cp[m][i] = std::rand() / (double)RAND_MAX - 0.5;
+        }
+    }
+    C->scale(1.0 / std::sqrt((double)nbf));
+    return C;
+}
+
+void print_builder_timings(const std::vector<BuilderTiming>& timings) {
+    outfile->Printf("  %-12s %7s %12s %12s %14s %-14s %10s %10s\n", "Builder", "Threads", "Init [s]", "Build [s]",
+                    "Throughput", "Units", "Peak [MiB]", "Eff.");
+    for (const auto& row : timings) {
+        outfile->Printf("  %-12s %7d %12.5f %12.5f %14.6E %-14s %10.1f %10.3f\n", row.builder.c_str(), row.nthread,
+                        row.init_time, row.time, row.throughput, row.units.c_str(), row.max_rss, row.efficiency);
+    }
+    outfile->Printf("\n");
+}
+
+}  // namespace
+
+std::vector<BuilderTiming> benchmark_jk(std::shared_ptr<BasisSet> primary, std::shared_ptr<BasisSet> auxiliary,
+                                        const std::vector<std::string>& jk_types, int max_threads, int nbuild) {
+    outfile->Printf("\n");
+    outfile->Printf("                              -------------------------------------- \n");
+    outfile->Printf("                              =========> JK BUILD BENCHMARKS <====== \n");
+    outfile->Printf("                              -------------------------------------- \n");
+    outfile->Printf("\n");
+
+    int nbf = primary->nbf();
+    double neri = std::pow((double)nbf, 4) / 8.0;
+    size_t doubles = (size_t)(0.8 * Process::environment.get_memory() / sizeof(double));
+
+    SharedMatrix C = benchmark_occupied(primary);
+
+    outfile->Printf("  Parameters:\n");
+    outfile->Printf("   -Basis functions: %d, occupied: %d.\n", nbf, C->colspi()[0]);
+    outfile->Printf("   -Builds per thread count: %d.\n", nbuild);
+    outfile->Printf("   -JK memory: %zu doubles.\n", doubles);
+    outfile->Printf("\n");
+
+    int old_threads = Process::environment.get_n_threads();
+
+    std::vector<BuilderTiming> timings;
+    for (const std::string& jk_type : jk_types) {
+        double t1 = 0.0;
+        for (int nthread : thread_counts(max_threads)) {
+            Process::environment.set_n_threads(nthread);
+
+            BuilderMemory memory;
+            Timer init_timer;
+            std::shared_ptr<JK> jk = JK::build_JK(primary, auxiliary, Process::environment.options, jk_type);
+            jk->set_memory(doubles);
+            jk->set_print(0);
+            jk->C_left().push_back(C);
+            jk->initialize();
+            double init_time = init_timer.get();
+
+            Timer build_timer;
+            for (int build = 0; build < nbuild; build++) {
+                jk->compute();
+            }
+            double t = build_timer.get() / nbuild;
+            double max_rss = memory.peak();
+            jk.reset();
+
+            if (nthread == 1) t1 = t;
+
+            BuilderTiming row;
+            row.builder = jk_type;
+            row.nthread = nthread;
+            row.nbuild = nbuild;
+            row.init_time = init_time;
+            row.time = t;
+            row.throughput = neri / t;
+            row.units = "ERI/s";
+            row.max_rss = max_rss;
+            row.efficiency = t1 / (nthread * t);
+            timings.push_back(row);
+        }
+    }
+
+    Process::environment.set_n_threads(old_threads);
+
+    print_builder_timings(timings);
+    return timings;
+}
+
+std::vector<BuilderTiming> benchmark_v(std::shared_ptr<BasisSet> primary, std::shared_ptr<SuperFunctional> functional,
+                                       int max_threads, int nbuild) {
+    outfile->Printf("\n");
+    outfile->Printf("                              -------------------------------------- \n");
+    outfile->Printf("                              =========> RV BUILD BENCHMARKS <====== \n");
+    outfile->Printf("                              -------------------------------------- \n");
+    outfile->Printf("\n");
+
+    int nbf = primary->nbf();
+    SharedMatrix C = benchmark_occupied(primary);
+    SharedMatrix D = linalg::doublet(C, C, false, true);
+
+    outfile->Printf("  Parameters:\n");
+    outfile->Printf("   -Basis functions: %d, occupied: %d.\n", nbf, C->colspi()[0]);
+    outfile->Printf("   -Functional: %s.\n", functional->name().c_str());
+    outfile->Printf("   -Builds per thread count: %d.\n", nbuild);
+    outfile->Printf("\n");
+
+    int old_threads = Process::environment.get_n_threads();
+
+    std::vector<BuilderTiming> timings;
+    double t1 = 0.0;
+    for (int nthread : thread_counts(max_threads)) {
+        Process::environment.set_n_threads(nthread);
+
+        BuilderMemory memory;
+        Timer init_timer;
+        std::shared_ptr<VBase> V = VBase::build_V(primary, functional, Process::environment.options, "RV");
+        V->initialize();
+        V->set_D({D});
+        double init_time = init_timer.get();
+
+        std::vector<SharedMatrix> ret = {std::make_shared<Matrix>("V", nbf, nbf)};
+        Timer build_timer;
+        for (int build = 0; build < nbuild; build++) {
+            V->compute_V(ret);
+        }
+        double t = build_timer.get() / nbuild;
+        double npoints = V->grid()->npoints();
+        double max_rss = memory.peak();
+        V->finalize();
+        V.reset();
+
+        if (nthread == 1) t1 = t;
+
+        BuilderTiming row;
+        row.builder = "RV";
+        row.nthread = nthread;
+        row.nbuild = nbuild;
+        row.init_time = init_time;
+        row.time = t;
+        row.throughput = npoints / t;
+        row.units = "points/s";
+        row.max_rss = max_rss;
+        row.efficiency = t1 / (nthread * t);
+        timings.push_back(row);
+    }
+
+    Process::environment.set_n_threads(old_threads);
+
+    print_builder_timings(timings);
+    return timings;
+}
+
 }  // namespace psi
@@ -29,8 +29,40 @@
 #ifndef _psi_src_lib_libmints_bench_h
 #define _psi_src_lib_libmints_bench_h
 
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace psi {
 
+class BasisSet;
+class SuperFunctional;
+
+/**
+ * One measurement of benchmark_jk or benchmark_v: a builder run at a
+ * given thread count
+ **/
+struct BuilderTiming {
+    /// JK algorithm (PK, DIRECT, ...) or "RV"
+    std::string builder;
+    /// Number of threads
+    int nthread;
+    /// Number of timed builds
+    int nbuild;
+    /// Wall time to construct and initialize the builder [s]
+    double init_time;
+    /// Wall time per build [s]
+    double time;
+    /// Work per second, see units
+    double throughput;
+    /// Unit of throughput
+    std::string units;
+    /// Peak memory of this builder above the resident size before it was built [MiB]
+    double max_rss;
+    /// Parallel efficiency t(1) / (nthread t(nthread))
+    double efficiency;
+};
+
 /**
  * Perform a benchmark traverse of BLAS 1 routines on
  * the current hardware
@@ -81,6 +113,32 @@ void benchmark_integrals(int max_am, double min_time);
  * \param min_time minimum amount of time to run each routine [s]
  **/
 void benchmark_math(double min_time);
+/**
+ * Thread-scaling benchmark of the JK builders.
+ * Each algorithm is built from scratch at 1, 2, 3, 4, 8, 16, ... and
+ * max_threads threads, then nbuild J/K builds are timed for a fixed
+ * pseudo-random occupied block (nocc from the molecule's electron count).
+ * Throughput is the nominal number of unique ERIs, nbf^4 / 8, per second.
+ * \param primary primary basis set
+ * \param auxiliary fitting basis for the DF algorithms (may be the primary for others)
+ * \param jk_types JK algorithms as for SCF_TYPE (PK, OUT_OF_CORE, DIRECT, DISK_DF, MEM_DF, CD)
+ * \param max_threads largest thread count to run
+ * \param nbuild number of timed builds per thread count
+ * \returns one row per (algorithm, thread count), the table is also printed
+ **/
+std::vector<BuilderTiming> benchmark_jk(std::shared_ptr<BasisSet> primary, std::shared_ptr<BasisSet> auxiliary,
+                                        const std::vector<std::string>& jk_types, int max_threads, int nbuild);
+/**
+ * Thread-scaling benchmark of RV::compute_V, run like benchmark_jk.
+ * Throughput is grid points per second.
+ * \param primary primary basis set
+ * \param functional allocated superfunctional (e.g. from build_superfunctional)
+ * \param max_threads largest thread count to run
+ * \param nbuild number of timed builds per thread count
+ * \returns one row per thread count, the table is also printed
+ **/
+std::vector<BuilderTiming> benchmark_v(std::shared_ptr<BasisSet> primary, std::shared_ptr<SuperFunctional> functional,
+                                       int max_threads, int nbuild);
 
 }  // namespace psi
 
@@ -0,0 +1,420 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#include "psi4/libmints/checkpoint.h"
+#include "psi4/libmints/matrix.h"
+#include "psi4/libmints/vector.h"
+#include "psi4/libpsi4util/exception.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace psi {
+
+namespace {
+
+// File layout, all integers native-endian:
+//   Header
+//   DirectoryRecord[nrecord]
+//   metadata: names, strings, and per-record shapes
+//     matrix:    int64 rowspi[nirrep], colspi[nirrep], block offset[nirrep]
+//     vector:    int64 dimpi[nirrep], block offset[nirrep]
+//     dimension: int64 values[nirrep]
+//   data: one block per irrep, each at a 64-byte aligned offset from data_offset
+// Int and double records keep their value in the directory offset field.
+
+const char checkpoint_magic[8] = {'P', 'S', 'I', '4', 'C', 'H', 'K', 'P'};
+const uint32_t checkpoint_version = 1;
+const uint32_t checkpoint_byte_order = 0x01020304u;
+const size_t checkpoint_alignment = 64;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t nrecord;
+    uint64_t data_offset;
+    uint64_t file_size;
+};
+
+struct DirectoryRecord {
+    uint64_t name_offset;
+    uint64_t name_length;
+    uint32_t kind;
+    int32_t symmetry;
+    uint32_t nirrep;
+    uint32_t reserved;
+    uint64_t offset;
+    uint64_t length;
+};
+
+size_t align(size_t offset) { return (offset + checkpoint_alignment - 1) / checkpoint_alignment * checkpoint_alignment; }
+
+void append_bytes(std::vector<char>& buffer, const void* data, size_t nbytes) {
+    const char* bytes = static_cast<const char*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + nbytes);
+}
+
+}  // namespace
+
+CheckpointWriter::CheckpointWriter(const std::string& filename) : filename_(filename) {}
+
+CheckpointWriter::Record& CheckpointWriter::new_record(const std::string& name, RecordKind kind) {
+    records_.emplace_back();
+    Record& record = records_.back();
+    record.name = name;
+    record.kind = kind;
+    record.int_value = 0;
+    record.double_value = 0.0;
+    return record;
+}
+
+void CheckpointWriter::add_matrix(const std::string& name, const SharedMatrix& matrix) {
+    if (matrix) new_record(name, MatrixRecord).matrix = matrix;
+}
+
+void CheckpointWriter::add_vector(const std::string& name, const SharedVector& vector) {
+    if (vector) new_record(name, VectorRecord).vector = vector;
+}
+
+void CheckpointWriter::add_dimension(const std::string& name, const Dimension& dimension) {
+    new_record(name, DimensionRecord).dimension = dimension;
+}
+
+void CheckpointWriter::add_int(const std::string& name, long int value) { new_record(name, IntRecord).int_value = value; }
+
+void CheckpointWriter::add_double(const std::string& name, double value) {
+    new_record(name, DoubleRecord).double_value = value;
+}
+
+void CheckpointWriter::add_string(const std::string& name, const std::string& value) {
+    new_record(name, StringRecord).string_value = value;
+}
+
+void CheckpointWriter::write() const {
+    size_t meta_offset = sizeof(Header) + records_.size() * sizeof(DirectoryRecord);
+
+    std::vector<DirectoryRecord> directory;
+    std::vector<char> meta;
+    // (pointer, bytes, relative offset) of every data block, in file order
+    struct Block {
+        const double* data;
+        size_t nbytes;
+        size_t offset;
+    };
+    std::vector<Block> blocks;
+    size_t data_size = 0;
+
+    auto add_block = [&](const double* data, size_t n) {
+        data_size = align(data_size);
+        blocks.push_back({data, n * sizeof(double), data_size});
+        int64_t offset = data_size;
+        data_size += n * sizeof(double);
+        return offset;
+    };
+
+    for (const Record& record : records_) {
+        DirectoryRecord dir;
+        std::memset(&dir, 0, sizeof(DirectoryRecord));
+        dir.name_offset = meta_offset + meta.size();
+        dir.name_length = record.name.size();
+        dir.kind = record.kind;
+        append_bytes(meta, record.name.data(), record.name.size());
+
+        if (record.kind == MatrixRecord) {
+            const Matrix& M = *record.matrix;
+            int nirrep = M.nirrep();
+            std::vector<int64_t> shape(3 * nirrep);
+            for (int h = 0; h < nirrep; ++h) {
+                size_t rows = M.rowspi()[h];
+                size_t cols = M.colspi()[h ^ M.symmetry()];
+                shape[h] = M.rowspi()[h];
+                shape[nirrep + h] = M.colspi()[h];
+                shape[2 * nirrep + h] = add_block(rows * cols > 0 ? M.pointer(h)[0] : nullptr, rows * cols);
+            }
+            dir.symmetry = M.symmetry();
+            dir.nirrep = nirrep;
+            dir.offset = meta_offset + meta.size();
+            dir.length = shape.size() * sizeof(int64_t);
+            append_bytes(meta, shape.data(), dir.length);
+        } else if (record.kind == VectorRecord) {
+            const Vector& v = *record.vector;
+            int nirrep = v.nirrep();
+            std::vector<int64_t> shape(2 * nirrep);
+            for (int h = 0; h < nirrep; ++h) {
+                size_t n = v.dimpi()[h];
+                shape[h] = n;
+                shape[nirrep + h] = add_block(n ? v.pointer(h) : nullptr, n);
+            }
+            dir.nirrep = nirrep;
+            dir.offset = meta_offset + meta.size();
+            dir.length = shape.size() * sizeof(int64_t);
+            append_bytes(meta, shape.data(), dir.length);
+        } else if (record.kind == DimensionRecord) {
+            std::vector<int64_t> values(record.dimension.blocks().begin(), record.dimension.blocks().end());
+            dir.nirrep = values.size();
+            dir.offset = meta_offset + meta.size();
+            dir.length = values.size() * sizeof(int64_t);
+            append_bytes(meta, values.data(), dir.length);
+        } else if (record.kind == IntRecord) {
+            int64_t value = record.int_value;
+            std::memcpy(&dir.offset, &value, sizeof(int64_t));
+        } else if (record.kind == DoubleRecord) {
+            std::memcpy(&dir.offset, &record.double_value, sizeof(double));
+        } else if (record.kind == StringRecord) {
+            dir.offset = meta_offset + meta.size();
+            dir.length = record.string_value.size();
+            append_bytes(meta, record.string_value.data(), record.string_value.size());
+        }
+        directory.push_back(dir);
+    }
+
+    Header header;
+    std::memcpy(header.magic, checkpoint_magic, sizeof(checkpoint_magic));
+    header.version = checkpoint_version;
+    header.byte_order = checkpoint_byte_order;
+    header.nrecord = directory.size();
+    header.data_offset = align(meta_offset + meta.size());
+    header.file_size = header.data_offset + data_size;
+
+    // Write beside the target and rename, so a reader never maps a partial file
+    std::string tmpname = filename_ + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream out(tmpname, std::ios::binary | std::ios::trunc);
+        if (!out) throw PSIEXCEPTION("CheckpointWriter: unable to write " + tmpname);
+
+        const char zeros[checkpoint_alignment] = {0};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        out.write(reinterpret_cast<const char*>(directory.data()), directory.size() * sizeof(DirectoryRecord));
+        out.write(meta.data(), meta.size());
+        size_t position = meta_offset + meta.size();
+        for (const Block& block : blocks) {
+            size_t target = header.data_offset + block.offset;
+            out.write(zeros, target - position);
+            if (block.nbytes) out.write(reinterpret_cast<const char*>(block.data), block.nbytes);
+            position = target + block.nbytes;
+        }
+        out.write(zeros, header.file_size - position);
+        if (!out) throw PSIEXCEPTION("CheckpointWriter: error writing " + tmpname);
+    }
+    if (std::rename(tmpname.c_str(), filename_.c_str()) != 0) {
+        std::remove(tmpname.c_str());
+        throw PSIEXCEPTION("CheckpointWriter: unable to move checkpoint into place at " + filename_);
+    }
+}
+
+CheckpointFile::CheckpointFile(const std::string& filename)
+    : filename_(filename), data_(nullptr), size_(0), data_offset_(0) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) throw PSIEXCEPTION("CheckpointFile: unable to open " + filename);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+        close(fd);
+        throw PSIEXCEPTION("CheckpointFile: " + filename + " is not a checkpoint file.");
+    }
+    size_ = st.st_size;
+
+    void* map = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) throw PSIEXCEPTION("CheckpointFile: unable to map " + filename);
+    data_ = static_cast<const char*>(map);
+
+    Header header;
+    std::memcpy(&header, data_, sizeof(Header));
+    if (std::memcmp(header.magic, checkpoint_magic, sizeof(checkpoint_magic)) != 0 ||
+        header.version != checkpoint_version || header.byte_order != checkpoint_byte_order ||
+        header.file_size != size_ || sizeof(Header) + header.nrecord * sizeof(DirectoryRecord) > size_) {
+        munmap(const_cast<char*>(data_), size_);
+        throw PSIEXCEPTION("CheckpointFile: " + filename + " is not a compatible checkpoint file.");
+    }
+    data_offset_ = header.data_offset;
+
+    for (size_t i = 0; i < header.nrecord; ++i) {
+        DirectoryRecord dir;
+        size_t offset = sizeof(Header) + i * sizeof(DirectoryRecord);
+        std::memcpy(&dir, data_ + offset, sizeof(DirectoryRecord));
+        if (dir.name_offset + dir.name_length > size_) {
+            munmap(const_cast<char*>(data_), size_);
+            throw PSIEXCEPTION("CheckpointFile: " + filename + " is truncated.");
+        }
+        index_[std::string(data_ + dir.name_offset, dir.name_length)] = offset;
+    }
+}
+
+CheckpointFile::~CheckpointFile() {
+    if (data_ != nullptr) munmap(const_cast<char*>(data_), size_);
+}
+
+bool CheckpointFile::is_checkpoint(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    char magic[sizeof(checkpoint_magic)];
+    if (!in.read(magic, sizeof(magic))) return false;
+    return std::memcmp(magic, checkpoint_magic, sizeof(checkpoint_magic)) == 0;
+}
+
+std::vector<std::string> CheckpointFile::names() const {
+    std::vector<std::string> names;
+    for (const auto& item : index_) names.push_back(item.first);
+    return names;
+}
+
+void CheckpointFile::read(size_t offset, void* dest, size_t nbytes) const {
+    if (offset + nbytes > size_) throw PSIEXCEPTION("CheckpointFile: read past the end of " + filename_);
+    std::memcpy(dest, data_ + offset, nbytes);
+}
+
+bool CheckpointFile::find(const std::string& name, uint32_t kind, Entry& entry) const {
+    auto it = index_.find(name);
+    if (it == index_.end()) return false;
+
+    DirectoryRecord dir;
+    read(it->second, &dir, sizeof(DirectoryRecord));
+    if (dir.kind != kind) throw PSIEXCEPTION("CheckpointFile: record " + name + " has a different type.");
+    entry.kind = dir.kind;
+    entry.symmetry = dir.symmetry;
+    entry.nirrep = dir.nirrep;
+    entry.offset = dir.offset;
+    entry.length = dir.length;
+    return true;
+}
+
+std::vector<int64_t> CheckpointFile::read_shape(const Entry& entry, size_t n) const {
+    std::vector<int64_t> shape(n);
+    if (entry.length != n * sizeof(int64_t)) throw PSIEXCEPTION("CheckpointFile: corrupt record in " + filename_);
+    read(entry.offset, shape.data(), entry.length);
+    return shape;
+}
+
+SharedMatrix CheckpointFile::matrix(const std::string& name) const {
+    Entry entry;
+    if (!find(name, CheckpointWriter::MatrixRecord, entry)) return nullptr;
+
+    int nirrep = entry.nirrep;
+    std::vector<int64_t> shape = read_shape(entry, 3 * nirrep);
+    Dimension rowspi(nirrep), colspi(nirrep);
+    for (int h = 0; h < nirrep; ++h) {
+        rowspi[h] = shape[h];
+        colspi[h] = shape[nirrep + h];
+    }
+
+    auto M = std::make_shared<Matrix>(name, rowspi, colspi, entry.symmetry);
+    for (int h = 0; h < nirrep; ++h) {
+        size_t n = static_cast<size_t>(rowspi[h]) * colspi[h ^ entry.symmetry];
+        if (n) read(data_offset_ + shape[2 * nirrep + h], M->pointer(h)[0], n * sizeof(double));
+    }
+    return M;
+}
+
+SharedVector CheckpointFile::vector(const std::string& name) const {
+    Entry entry;
+    if (!find(name, CheckpointWriter::VectorRecord, entry)) return nullptr;
+
+    int nirrep = entry.nirrep;
+    std::vector<int64_t> shape = read_shape(entry, 2 * nirrep);
+    Dimension dimpi(nirrep);
+    for (int h = 0; h < nirrep; ++h) dimpi[h] = shape[h];
+
+    auto v = std::make_shared<Vector>(name, dimpi);
+    for (int h = 0; h < nirrep; ++h) {
+        if (dimpi[h]) read(data_offset_ + shape[nirrep + h], v->pointer(h), dimpi[h] * sizeof(double));
+    }
+    return v;
+}
+
+Dimension CheckpointFile::dimension(const std::string& name) const {
+    Entry entry;
+    if (!find(name, CheckpointWriter::DimensionRecord, entry)) return Dimension();
+
+    std::vector<int64_t> values = read_shape(entry, entry.nirrep);
+    return Dimension(std::vector<int>(values.begin(), values.end()));
+}
+
+long int CheckpointFile::int_value(const std::string& name) const {
+    Entry entry;
+    if (!find(name, CheckpointWriter::IntRecord, entry))
+        throw PSIEXCEPTION("CheckpointFile: no integer " + name + " in " + filename_);
+    int64_t value;
+    std::memcpy(&value, &entry.offset, sizeof(int64_t));
+    return value;
+}
+
+double CheckpointFile::double_value(const std::string& name) const {
+    Entry entry;
+    if (!find(name, CheckpointWriter::DoubleRecord, entry))
+        throw PSIEXCEPTION("CheckpointFile: no float " + name + " in " + filename_);
+    double value;
+    std::memcpy(&value, &entry.offset, sizeof(double));
+    return value;
+}
+
+std::string CheckpointFile::string_value(const std::string& name) const {
+    Entry entry;
+    if (!find(name, CheckpointWriter::StringRecord, entry))
+        throw PSIEXCEPTION("CheckpointFile: no string " + name + " in " + filename_);
+    if (entry.offset + entry.length > size_) throw PSIEXCEPTION("CheckpointFile: corrupt record in " + filename_);
+    return std::string(data_ + entry.offset, entry.length);
+}
+
+const double* CheckpointFile::block(const std::string& name, int h, size_t& rows, size_t& cols) const {
+    auto it = index_.find(name);
+    if (it == index_.end()) throw PSIEXCEPTION("CheckpointFile: no record " + name + " in " + filename_);
+
+    DirectoryRecord dir;
+    read(it->second, &dir, sizeof(DirectoryRecord));
+    int nirrep = dir.nirrep;
+    if (h < 0 || h >= nirrep) throw PSIEXCEPTION("CheckpointFile: irrep out of range for " + name);
+
+    Entry entry{dir.kind, dir.symmetry, dir.nirrep, dir.offset, dir.length};
+    int64_t offset;
+    if (dir.kind == CheckpointWriter::MatrixRecord) {
+        std::vector<int64_t> shape = read_shape(entry, 3 * nirrep);
+        rows = shape[h];
+        cols = shape[nirrep + (h ^ dir.symmetry)];
+        offset = shape[2 * nirrep + h];
+    } else if (dir.kind == CheckpointWriter::VectorRecord) {
+        std::vector<int64_t> shape = read_shape(entry, 2 * nirrep);
+        rows = shape[h];
+        cols = 1;
+        offset = shape[nirrep + h];
+    } else {
+        throw PSIEXCEPTION("CheckpointFile: record " + name + " is not a matrix or vector.");
+    }
+
+    if (data_offset_ + offset + rows * cols * sizeof(double) > size_)
+        throw PSIEXCEPTION("CheckpointFile: corrupt record in " + filename_);
+    return reinterpret_cast<const double*>(data_ + data_offset_ + offset);
+}
+
+}  // namespace psi
@@ -0,0 +1,155 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#ifndef _psi_src_lib_libmints_checkpoint_h_
+#define _psi_src_lib_libmints_checkpoint_h_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "psi4/pragma.h"
+#include "psi4/libmints/typedefs.h"
+#include "psi4/libmints/dimension.h"
+
+namespace psi {
+
+/*! \ingroup MINTS
+ *  \class CheckpointWriter
+ *  \brief Writes named matrices, vectors, dimensions and scalars to a binary checkpoint file.
+ *
+ * The file starts with a header and a directory of fixed-size records, followed by
+ * the names, shapes and strings, followed by the numerical data.  Every irrep
+ * block of a matrix or vector is stored contiguously at a 64-byte aligned
+ * offset, so a reader can map the file and hand out blocks in place.
+ *
+ * Matrices and vectors are only referenced until write(), which streams them
+ * straight to disk without an intermediate copy.
+ */
+class PSI_API CheckpointWriter {
+   public:
+    enum RecordKind { MatrixRecord = 1, VectorRecord, DimensionRecord, IntRecord, DoubleRecord, StringRecord };
+
+   protected:
+    struct Record {
+        std::string name;
+        RecordKind kind;
+        SharedMatrix matrix;
+        SharedVector vector;
+        Dimension dimension;
+        long int int_value;
+        double double_value;
+        std::string string_value;
+    };
+
+    std::string filename_;
+    std::vector<Record> records_;
+
+    Record& new_record(const std::string& name, RecordKind kind);
+
+   public:
+    explicit CheckpointWriter(const std::string& filename);
+
+    /// Null matrices and vectors are skipped; a reader sees them as absent
+    void add_matrix(const std::string& name, const SharedMatrix& matrix);
+    void add_vector(const std::string& name, const SharedVector& vector);
+    void add_dimension(const std::string& name, const Dimension& dimension);
+    void add_int(const std::string& name, long int value);
+    void add_double(const std::string& name, double value);
+    void add_string(const std::string& name, const std::string& value);
+
+    /// Writes the file, replacing filename atomically
+    void write() const;
+};
+
+/*! \ingroup MINTS
+ *  \class CheckpointFile
+ *  \brief Read-only, memory-mapped view of a file written by CheckpointWriter.
+ *
+ * Opening a checkpoint reads only its directory.  Each record is decoded on
+ * request, so loading e.g. only the orbitals touches only their pages.
+ */
+class PSI_API CheckpointFile {
+   protected:
+    std::string filename_;
+    const char* data_;
+    size_t size_;
+    size_t data_offset_;
+
+    /// Directory index by record name
+    std::map<std::string, size_t> index_;
+
+    struct Entry {
+        uint32_t kind;
+        int32_t symmetry;
+        uint32_t nirrep;
+        uint64_t offset;
+        uint64_t length;
+    };
+    bool find(const std::string& name, uint32_t kind, Entry& entry) const;
+    void read(size_t offset, void* dest, size_t nbytes) const;
+    std::vector<int64_t> read_shape(const Entry& entry, size_t n) const;
+
+   public:
+    /// Maps filename; throws if it is not a checkpoint file
+    explicit CheckpointFile(const std::string& filename);
+    ~CheckpointFile();
+
+    CheckpointFile(const CheckpointFile&) = delete;
+    CheckpointFile& operator=(const CheckpointFile&) = delete;
+
+    /// Does filename start with the checkpoint signature?
+    static bool is_checkpoint(const std::string& filename);
+
+    const std::string& filename() const { return filename_; }
+    std::vector<std::string> names() const;
+    bool contains(const std::string& name) const { return index_.count(name) > 0; }
+
+    /// Copies of the stored objects; nullptr / empty if the record is absent
+    SharedMatrix matrix(const std::string& name) const;
+    SharedVector vector(const std::string& name) const;
+    Dimension dimension(const std::string& name) const;
+
+    long int int_value(const std::string& name) const;
+    double double_value(const std::string& name) const;
+    std::string string_value(const std::string& name) const;
+
+    /**
+     * In-place view of block h of a matrix or vector record.
+     * @param rows, cols are set to the block shape (cols = 1 for vectors)
+     * @return pointer into the read-only mapping, valid while this object lives
+     */
+    const double* block(const std::string& name, int h, size_t& rows, size_t& cols) const;
+};
+
+}  // namespace psi
+
+#endif
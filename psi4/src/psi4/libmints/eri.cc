@@ -30,6 +30,8 @@
 #include "psi4/libmints/basisset.h"
 #include "psi4/libmints/integral.h"
 #include "psi4/libmints/fjt.h"
+#include "psi4/libpsi4util/exception.h"
+#include "psi4/libpsi4util/process.h"
 ;
 using namespace psi;
 
@@ -40,8 +42,14 @@ using namespace psi;
 ERI::ERI(const IntegralFactory *integral, int deriv, bool use_shell_pairs)
     : TwoElectronInt(integral, deriv, use_shell_pairs) {
     // The +1 is needed for derivatives to work.
-    fjt_ = new Taylor_Fjt(
-        basis1()->max_am() + basis2()->max_am() + basis3()->max_am() + basis4()->max_am() + deriv_ + 1, 1e-15);
+    int max_j = basis1()->max_am() + basis2()->max_am() + basis3()->max_am() + basis4()->max_am() + deriv_ + 1;
+    if (Process::environment.options.get_str("ERI_BOYS_FUNCTION") == "TABULATED") {
+        if (max_j > Tabulated_Fjt::max_j)
+            throw PSIEXCEPTION("ERI: angular momentum too high for ERI_BOYS_FUNCTION TABULATED, use TAYLOR.");
+        fjt_ = new Tabulated_Fjt();
+    } else {
+        fjt_ = new Taylor_Fjt(max_j, 1e-15);
+    }
 }
 
 ERI::~ERI() { delete fjt_; }
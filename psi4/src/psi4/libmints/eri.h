@@ -33,6 +33,9 @@
 #include <libderiv/libderiv.h>
 #include "psi4/libmints/twobody.h"
 
+#include <memory>
+#include <vector>
+
 namespace psi {
 
 class BasisSet;
@@ -67,6 +70,44 @@ typedef struct ShellPair_typ {
     double** overlap;
 } ShellPair;
 
+/*! \ingroup MINTS
+ *  \class ERIShellPairData
+ *  \brief Immutable ShellPair data for all shell pairs of two basis sets.
+ *
+ *  The data only depends on the basis sets, so a single copy, obtained from
+ *  shared(), is used by every integral object and thread working on them.
+ */
+class ERIShellPairData {
+    //! Number of shells in each basis set
+    int nshell1_, nshell2_;
+    //! Memory for the primitive data of all pairs
+    std::vector<double> stack_;
+    //! Memory for the row pointers of gamma, overlap, P, PA and PB
+    std::vector<double*> rows_;
+    std::vector<double**> tables_;
+    //! Pair data, nshell1 x nshell2
+    std::vector<ShellPair> pairs_;
+    //! Shell centers the data was computed for, basis set 1 then 2
+    std::vector<double> centers_;
+
+    static std::vector<double> shell_centers(const std::shared_ptr<BasisSet>&, const std::shared_ptr<BasisSet>&);
+
+   public:
+    ERIShellPairData(const std::shared_ptr<BasisSet>& bs1, const std::shared_ptr<BasisSet>& bs2);
+
+    //! Returns the data for bs1 and bs2, computing it only if no integral object holds it already
+    static std::shared_ptr<const ERIShellPairData> shared(const std::shared_ptr<BasisSet>& bs1,
+                                                          const std::shared_ptr<BasisSet>& bs2);
+
+    //! Whether the data is still valid for bs1 and bs2, i.e., no atom has moved
+    bool matches(const std::shared_ptr<BasisSet>& bs1, const std::shared_ptr<BasisSet>& bs2) const;
+
+    const ShellPair* pair(int i, int j) const { return &pairs_[(size_t)i * nshell2_ + j]; }
+
+    //! Memory used by the primitive data, in doubles
+    size_t memory() const { return stack_.size(); }
+};
+
 /*! \ingroup MINTS
  *  \class ERI
  *  \brief Capable of computing two-electron repulsion integrals.
@@ -97,21 +138,11 @@ class TwoElectronInt : public TwoBodyAOInt {
     void init_shell_pairs12();
     void init_shell_pairs34();
 
-    //! Free shell pair information
-    void free_shell_pairs12();
-    void free_shell_pairs34();
-
     //! Should we use shell pair information?
     bool use_shell_pairs_;
 
-    //! Stack memory pointer, used in init_shell_pairs, freed in destructor
-    double *stack12_, *stack34_;
-
-    //! Shell pair information
-    ShellPair **pairs12_, **pairs34_;
-
-    //! Evaluates how much memory (in doubles) is needed to store shell pair data
-    size_t memory_to_store_shell_pairs(const std::shared_ptr<BasisSet>&, const std::shared_ptr<BasisSet>&);
+    //! Shell pair information, shared with the other integral objects on the same basis sets
+    std::shared_ptr<const ERIShellPairData> pairs12_, pairs34_;
 
     //! Original shell index requested
     int osh1_, osh2_, osh3_, osh4_;
@@ -125,6 +156,11 @@ class TwoElectronInt : public TwoBodyAOInt {
 
     ~TwoElectronInt() override;
 
+    //! Whether this object and other use the same shell pair data instances
+    bool shares_shell_pairs(const TwoElectronInt& other) const {
+        return pairs12_ && pairs12_ == other.pairs12_ && pairs34_ == other.pairs34_;
+    }
+
     /// Compute ERIs between 4 shells. Result is stored in buffer.
     size_t compute_shell(const AOShellCombinationsIterator&) override;
 
@@ -37,6 +37,7 @@
 #include "psi4/libmints/wavefunction.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
 
+#include <mutex>
 #include <stdexcept>
 #include <string>
 
@@ -1782,6 +1783,189 @@ static size_t fill_primitive_data(prim_data *PrimQuartet, Fjt *fjt, const ShellP
 
 }  // end namespace
 
+namespace {
+
+struct ShellPairCacheEntry {
+    std::weak_ptr<BasisSet> bs1, bs2;
+    std::weak_ptr<const ERIShellPairData> data;
+};
+
+// Shell pair data currently held by some integral object, shared by all that ask for the same basis sets
+std::mutex shell_pair_cache_mutex;
+std::vector<ShellPairCacheEntry> shell_pair_cache;
+
+}  // namespace
+
+ERIShellPairData::ERIShellPairData(const std::shared_ptr<BasisSet> &bs1, const std::shared_ptr<BasisSet> &bs2)
+    : nshell1_(bs1->nshell()), nshell2_(bs2->nshell()), centers_(shell_centers(bs1, bs2)) {
+    // Size all storage up front, the ShellPair structures point into it
+    size_t ndouble = 0, nrow = 0, ntable = 0;
+    for (int si = 0; si < nshell1_; ++si) {
+        size_t np_i = bs1->shell(si).nprimitive();
+        for (int sj = 0; sj < nshell2_; ++sj) {
+            size_t np_j = bs2->shell(sj).nprimitive();
+            ndouble += 2 * (np_i + np_j) + 11 * np_i * np_j;
+            nrow += 2 * np_i + 3 * np_i * np_j;
+            ntable += 3 * np_i;
+        }
+    }
+    stack_.resize(ndouble);
+    rows_.resize(nrow);
+    tables_.resize(ntable);
+    pairs_.resize((size_t)nshell1_ * nshell2_);
+
+    double *curr_stack_ptr = stack_.data();
+    double **curr_row_ptr = rows_.data();
+    double ***curr_table_ptr = tables_.data();
+
+    // Loop over all shell pairs (si, sj) and create primitive pairs pairs
+    for (int si = 0; si < nshell1_; ++si) {
+        const GaussianShell &shell1 = bs1->shell(si);
+        Vector3 A = shell1.center();
+        int np_i = shell1.nprimitive();
+
+        for (int sj = 0; sj < nshell2_; ++sj) {
+            const GaussianShell &shell2 = bs2->shell(sj);
+            Vector3 B = shell2.center();
+            int np_j = shell2.nprimitive();
+
+            Vector3 AB = A - B;
+            double ab2 = AB.dot(AB);
+
+            ShellPair *sp = &pairs_[(size_t)si * nshell2_ + sj];
+            sp->i = si;
+            sp->j = sj;
+            sp->AB[0] = AB[0];
+            sp->AB[1] = AB[1];
+            sp->AB[2] = AB[2];
+
+            // Reserve memory with the same layout as each pair always had: gamma and overlap rows
+            // are contiguous, which fill_primitive_data relies on
+            sp->ai = curr_stack_ptr;
+            curr_stack_ptr += np_i;
+            sp->aj = curr_stack_ptr;
+            curr_stack_ptr += np_j;
+
+            sp->gamma = curr_row_ptr;
+            curr_row_ptr += np_i;
+            for (int i = 0; i < np_i; ++i) {
+                sp->gamma[i] = curr_stack_ptr;
+                curr_stack_ptr += np_j;
+            }
+
+            sp->ci = curr_stack_ptr;
+            curr_stack_ptr += np_i;
+            sp->cj = curr_stack_ptr;
+            curr_stack_ptr += np_j;
+
+            sp->overlap = curr_row_ptr;
+            curr_row_ptr += np_i;
+            for (int i = 0; i < np_i; ++i) {
+                sp->overlap[i] = curr_stack_ptr;
+                curr_stack_ptr += np_j;
+            }
+
+            sp->P = curr_table_ptr;
+            curr_table_ptr += np_i;
+            sp->PA = curr_table_ptr;
+            curr_table_ptr += np_i;
+            sp->PB = curr_table_ptr;
+            curr_table_ptr += np_i;
+            for (int i = 0; i < np_i; ++i) {
+                sp->P[i] = curr_row_ptr;
+                curr_row_ptr += np_j;
+                sp->PA[i] = curr_row_ptr;
+                curr_row_ptr += np_j;
+                sp->PB[i] = curr_row_ptr;
+                curr_row_ptr += np_j;
+
+                for (int j = 0; j < np_j; ++j) {
+                    sp->P[i][j] = curr_stack_ptr;
+                    curr_stack_ptr += 3;
+                    sp->PA[i][j] = curr_stack_ptr;
+                    curr_stack_ptr += 3;
+                    sp->PB[i][j] = curr_stack_ptr;
+                    curr_stack_ptr += 3;
+                }
+            }
+
+            // Pre-compute all data that we can:
+            for (int i = 0; i < np_i; ++i) {
+                double a1 = shell1.exp(i);
+                double c1 = shell1.coef(i);
+
+                sp->ai[i] = a1;
+                sp->ci[i] = c1;
+
+                for (int j = 0; j < np_j; ++j) {
+                    double a2 = shell2.exp(j);
+                    double c2 = shell2.coef(j);
+
+                    double gam = a1 + a2;
+
+                    // Compute Gaussian product and component distances
+                    Vector3 P = (A * a1 + B * a2) / gam;
+                    Vector3 PA = P - A;
+                    Vector3 PB = P - B;
+
+                    sp->aj[j] = a2;
+                    sp->cj[j] = c2;
+                    sp->gamma[i][j] = gam;
+                    sp->P[i][j][0] = P[0];
+                    sp->P[i][j][1] = P[1];
+                    sp->P[i][j][2] = P[2];
+                    sp->PA[i][j][0] = PA[0];
+                    sp->PA[i][j][1] = PA[1];
+                    sp->PA[i][j][2] = PA[2];
+                    sp->PB[i][j][0] = PB[0];
+                    sp->PB[i][j][1] = PB[1];
+                    sp->PB[i][j][2] = PB[2];
+                    sp->overlap[i][j] = pow(M_PI / gam, 3.0 / 2.0) * exp(-a1 * a2 * ab2 / gam) * c1 * c2;
+                }
+            }
+        }
+    }
+}
+
+std::vector<double> ERIShellPairData::shell_centers(const std::shared_ptr<BasisSet> &bs1,
+                                                    const std::shared_ptr<BasisSet> &bs2) {
+    std::vector<double> centers;
+    centers.reserve(3 * (bs1->nshell() + bs2->nshell()));
+    for (const auto &bs : {bs1, bs2}) {
+        for (int s = 0; s < bs->nshell(); ++s) {
+            const Vector3 &center = bs->shell(s).center();
+            centers.insert(centers.end(), {center[0], center[1], center[2]});
+        }
+    }
+    return centers;
+}
+
+bool ERIShellPairData::matches(const std::shared_ptr<BasisSet> &bs1, const std::shared_ptr<BasisSet> &bs2) const {
+    return bs1->nshell() == nshell1_ && bs2->nshell() == nshell2_ && shell_centers(bs1, bs2) == centers_;
+}
+
+std::shared_ptr<const ERIShellPairData> ERIShellPairData::shared(const std::shared_ptr<BasisSet> &bs1,
+                                                                 const std::shared_ptr<BasisSet> &bs2) {
+    // Threads creating their integral objects at the same time wait here for a single computation
+    std::lock_guard<std::mutex> lock(shell_pair_cache_mutex);
+
+    std::shared_ptr<const ERIShellPairData> data;
+    for (auto it = shell_pair_cache.begin(); it != shell_pair_cache.end();) {
+        auto cached = it->data.lock();
+        if (!cached || it->bs1.expired() || it->bs2.expired()) {
+            it = shell_pair_cache.erase(it);
+            continue;
+        }
+        if (!data && it->bs1.lock() == bs1 && it->bs2.lock() == bs2 && cached->matches(bs1, bs2)) data = cached;
+        ++it;
+    }
+    if (data) return data;
+
+    data = std::make_shared<const ERIShellPairData>(bs1, bs2);
+    shell_pair_cache.push_back({bs1, bs2, data});
+    return data;
+}
+
 TwoElectronInt::TwoElectronInt(const IntegralFactory *integral, int deriv, bool use_shell_pairs)
     : TwoBodyAOInt(integral, deriv), use_shell_pairs_(use_shell_pairs) {
     // Initialize libint static data
@@ -1898,305 +2082,18 @@ TwoElectronInt::~TwoElectronInt() {
     delete[] source_full_;
     free_libint(&libint_);
     if (deriv_) free_libderiv(&libderiv_);
-    free_shell_pairs12();
-    free_shell_pairs34();  // This shouldn't do anything, but this might change in the future
 }
 
-void TwoElectronInt::init_shell_pairs12() {
-    ShellPair *sp;
-    Vector3 P, PA, PB, AB, A, B;
-    int i, j, si, sj, np_i, np_j;
-    size_t memd;
-    double a1, a2, ab2, gam, c1, c2;
-    double *curr_stack_ptr;
-
-    // Estimate memory needed by allocated space for the dynamically allocated parts of ShellPair structure
-    memd = TwoElectronInt::memory_to_store_shell_pairs(basis1(), basis2());
-
-    // Allocate a stack of memory
-    stack12_ = new double[memd];
-    curr_stack_ptr = stack12_;
-
-    // Allocate shell pair memory
-    pairs12_ = new ShellPair *[basis1()->nshell()];
-    for (i = 0; i < basis1()->nshell(); ++i) pairs12_[i] = new ShellPair[basis2()->nshell()];
-
-    // Loop over all shell pairs (si, sj) and create primitive pairs pairs
-    for (si = 0; si < basis1()->nshell(); ++si) {
-        A = basis1()->shell(si).center();
-
-        for (sj = 0; sj < basis2()->nshell(); ++sj) {
-            B = basis2()->shell(sj).center();
-
-            AB = A - B;
-            ab2 = AB.dot(AB);
-
-            // Get the pointer for convenience
-            sp = &(pairs12_[si][sj]);
-
-            // Save some information
-            sp->i = si;
-            sp->j = sj;
-            sp->AB[0] = AB[0];
-            sp->AB[1] = AB[1];
-            sp->AB[2] = AB[2];
-
-            np_i = basis1()->shell(si).nprimitive();
-            np_j = basis2()->shell(sj).nprimitive();
-
-            // Reserve some memory for the primitives
-            sp->ai = curr_stack_ptr;
-            curr_stack_ptr += np_i;
-            sp->aj = curr_stack_ptr;
-            curr_stack_ptr += np_j;
-
-            // Allocate and reserve memory for gammas
-            sp->gamma = new double *[np_i];
-            for (i = 0; i < np_i; ++i) {
-                sp->gamma[i] = curr_stack_ptr;
-                curr_stack_ptr += np_j;
-            }
-
-            // Reserve space for contraction coefficients
-            sp->ci = curr_stack_ptr;
-            curr_stack_ptr += np_i;
-            sp->cj = curr_stack_ptr;
-            curr_stack_ptr += np_j;
-
-            // Allocate and reserve space for overlaps
-            sp->overlap = new double *[np_i];
-            for (i = 0; i < np_i; ++i) {
-                sp->overlap[i] = curr_stack_ptr;
-                curr_stack_ptr += np_j;
-            }
-
-            // Allocate and reserve space for P, PA, and PB.
-            sp->P = new double **[np_i];
-            sp->PA = new double **[np_i];
-            sp->PB = new double **[np_i];
-            for (i = 0; i < np_i; ++i) {
-                sp->P[i] = new double *[np_j];
-                sp->PA[i] = new double *[np_j];
-                sp->PB[i] = new double *[np_j];
-
-                for (j = 0; j < np_j; ++j) {
-                    sp->P[i][j] = curr_stack_ptr;
-                    curr_stack_ptr += 3;
-                    sp->PA[i][j] = curr_stack_ptr;
-                    curr_stack_ptr += 3;
-                    sp->PB[i][j] = curr_stack_ptr;
-                    curr_stack_ptr += 3;
-                }
-            }
-
-            // All memory has been reserved/allocated for this shell primitive pair pair.
-            // Pre-compute all data that we can:
-            for (i = 0; i < np_i; ++i) {
-                a1 = basis1()->shell(si).exp(i);
-                c1 = basis1()->shell(si).coef(i);
-
-                // Save some information
-                sp->ai[i] = a1;
-                sp->ci[i] = c1;
-
-                for (j = 0; j < np_j; ++j) {
-                    a2 = basis2()->shell(sj).exp(j);
-                    c2 = basis2()->shell(sj).coef(j);
-
-                    gam = a1 + a2;
-
-                    // Compute Gaussian product and component distances
-                    P = (A * a1 + B * a2) / gam;
-                    PA = P - A;
-                    PB = P - B;
-
-                    // Copy data into pairs array
-                    sp->aj[j] = a2;
-                    sp->cj[j] = c2;
-                    sp->gamma[i][j] = gam;
-                    sp->P[i][j][0] = P[0];
-                    sp->P[i][j][1] = P[1];
-                    sp->P[i][j][2] = P[2];
-                    sp->PA[i][j][0] = PA[0];
-                    sp->PA[i][j][1] = PA[1];
-                    sp->PA[i][j][2] = PA[2];
-                    sp->PB[i][j][0] = PB[0];
-                    sp->PB[i][j][1] = PB[1];
-                    sp->PB[i][j][2] = PB[2];
-                    sp->overlap[i][j] = pow(M_PI / gam, 3.0 / 2.0) * exp(-a1 * a2 * ab2 / gam) * c1 * c2;
-                }
-            }
-        }
-    }
-}
+void TwoElectronInt::init_shell_pairs12() { pairs12_ = ERIShellPairData::shared(basis1(), basis2()); }
 
 void TwoElectronInt::init_shell_pairs34() {
     // If basis1 == basis3 && basis2 == basis4, then we don't need to do anything except use the pointer
     // of pairs12_.
-    if (use_shell_pairs_ == true) {
-        // This assumes init_shell_pairs12 was called and precomputed the values.
+    if (basis1() == basis3() && basis2() == basis4()) {
         pairs34_ = pairs12_;
-        stack34_ = nullptr;
         return;
     }
-#if 0
-                                                                                                                            outfile->Printf( "  Pre-computing additional values for two-electron integrals. [ |34) does not equal (12| ]\n");
-
-    // Estimate memory needed by allocated space for the dynamically allocated parts of ShellPair structure
-    memd = ERIBase::memory_to_store_shell_pairs(basis3(), basis4());
-
-    // Allocate a stack of memory
-    stack34_ = new double[memd];
-    curr_stack_ptr = stack34_;
-
-    // Allocate shell pair memory
-    pairs34_ = new ShellPair*[basis3()->nprimitive()];
-    for (i=0; i<basis3()->nprimitive(); ++i)
-        pairs34_[i] = new ShellPair[basis4()->nprimitive()];
-
-    // Loop over all shell pairs (si, sj) and create primitive pairs pairs
-    for (si=0; si<basis3()->nprimitive(); ++si) {
-        A = basis3()->shell(si).center();
-
-        for (sj=0; sj<basis4()->nprimitive(); ++sj) {
-            B = basis4()->shell(sj).center();
-
-            AB = A - B;
-            ab2 = AB.dot(AB);
-
-            // Get the pointer for convenience
-            sp = &(pairs34_[si][sj]);
-
-            // Save some information
-            sp->i = si;
-            sp->j = sj;
-            sp->AB[0] = AB[0]; sp->AB[1] = AB[1]; sp->AB[2] = AB[2];
-
-            np_i = basis3()->shell(si).nprimitive();
-            np_j = basis4()->shell(sj).nprimitive();
-
-            // Reserve some memory for the primitives
-            sp->ai = curr_stack_ptr; curr_stack_ptr += np_i;
-            sp->aj = curr_stack_ptr; curr_stack_ptr += np_j;
-
-            // Allocate and reserve memory for gammas
-            sp->gamma = new double*[np_i];
-            for (i=0; i<np_i; ++i) {
-                sp->gamma[i] = curr_stack_ptr; curr_stack_ptr += np_j;
-            }
-
-            // Reserve space for contraction coefficients
-            sp->ci = curr_stack_ptr; curr_stack_ptr += np_i;
-            sp->cj = curr_stack_ptr; curr_stack_ptr += np_j;
-
-            // Allocate and reserve space for overlaps
-            sp->overlap = new double*[np_i];
-            for (i=0; i<np_i; ++i) {
-                sp->overlap[i] = curr_stack_ptr; curr_stack_ptr += np_j;
-            }
-
-            // Allocate and reserve space for P, PA, and PB.
-            sp->P  = new double**[np_i];
-            sp->PA = new double**[np_i];
-            sp->PB = new double**[np_i];
-            for (i=0; i<np_i; ++i) {
-                sp->P[i]  = new double*[np_j];
-                sp->PA[i] = new double*[np_j];
-                sp->PB[i] = new double*[np_j];
-
-                for (j=0; j<np_j; ++j) {
-                    sp->P[i][j]  = curr_stack_ptr; curr_stack_ptr += 3;
-                    sp->PA[i][j] = curr_stack_ptr; curr_stack_ptr += 3;
-                    sp->PB[i][j] = curr_stack_ptr; curr_stack_ptr += 3;
-                }
-            }
-
-            // All memory has been reserved/allocated for this shell primitive pair pair.
-            // Pre-compute all data that we can:
-            for (i=0; i<np_i; ++i) {
-                a1 = basis3()->shell(si)->exp(i);
-                c1 = basis3()->shell(si)->coef(i);
-
-                // Save some information
-                sp->ai[i] = a1;
-                sp->ci[i] = c1;
-
-                for (j=0; j<np_j; ++j) {
-                    a2 = basis4()->shell(sj)->exp(j);
-                    c2 = basis4()->shell(sj)->coef(j);
-
-                    gam = a1 + a2;
-
-                    // Compute some distances
-                    P = ( A * a1 + B * a2 ) / gam;
-                    PA = P - A;
-                    PB = P - B;
-
-                    // Copy data into pairs array
-                    sp->aj[j] = a2;
-                    sp->cj[j] = c2;
-                    sp->gamma[i][j] = gam;
-                    sp->P[i][j][0]  = P[0];  sp->P[i][j][1]  = P[1];  sp->P[i][j][2]  = P[2];
-                    sp->PA[i][j][0] = PA[0]; sp->PA[i][j][1] = PA[1]; sp->PA[i][j][2] = PA[2];
-                    sp->PB[i][j][0] = PB[0]; sp->PB[i][j][1] = PB[1]; sp->PB[i][j][2] = PB[2];
-                    sp->overlap[i][j] = pow(M_PI/gam, 3.0/2.0) * exp(-a1*a2*ab2/gam) * c1 * c2;
-                }
-            }
-        }
-    }
-#endif
-}
-
-void TwoElectronInt::free_shell_pairs12() {
-    int i, si, sj;
-    ShellPair *sp;
-    int np_i;
-
-    if (!use_shell_pairs_) return;
-
-    delete[] stack12_;
-    for (si = 0; si < basis1()->nshell(); ++si) {
-        for (sj = 0; sj < basis2()->nshell(); ++sj) {
-            np_i = basis1()->shell(si).nprimitive();
-            sp = &(pairs12_[si][sj]);
-
-            delete[] sp->gamma;
-            delete[] sp->overlap;
-
-            if (sp->P != nullptr) {
-                for (i = 0; i < np_i; ++i) delete[] sp->P[i];
-                delete[] sp->P;
-            }
-            if (sp->PA != nullptr) {
-                for (i = 0; i < np_i; ++i) delete[] sp->PA[i];
-                delete[] sp->PA;
-            }
-            if (sp->PB != nullptr) {
-                for (i = 0; i < np_i; ++i) delete[] sp->PB[i];
-                delete[] sp->PB;
-            }
-        }
-    }
-
-    for (si = 0; si < basis1()->nshell(); ++si) delete[] pairs12_[si];
-    delete[] pairs12_;
-}
-
-void TwoElectronInt::free_shell_pairs34() {}
-
-size_t TwoElectronInt::memory_to_store_shell_pairs(const std::shared_ptr<BasisSet> &bs1,
-                                                   const std::shared_ptr<BasisSet> &bs2) {
-    int i, j, np_i, np_j;
-    size_t mem = 0;
-
-    for (i = 0; i < bs1->nshell(); ++i) {
-        np_i = bs1->shell(i).nprimitive();
-        for (j = 0; j < bs2->nshell(); ++j) {
-            np_j = bs2->shell(j).nprimitive();
-            mem += (2 * (np_i + np_j) + 11 * np_i * np_j);
-        }
-    }
-    return mem;
+    pairs34_ = ERIShellPairData::shared(basis3(), basis4());
 }
 
 size_t TwoElectronInt::compute_shell(const AOShellCombinationsIterator &shellIter) {
@@ -2423,10 +2320,10 @@ size_t TwoElectronInt::compute_quartet(int sh1, int sh2, int sh3, int sh4) {
 
     // If we can, use the precomputed values found in ShellPair.
     if (use_shell_pairs_) {
-        ShellPair *p12, *p34;
+        const ShellPair *p12, *p34;
         // 1234 -> 1234 no change
-        p12 = &(pairs12_[sh1][sh2]);
-        p34 = &(pairs34_[sh3][sh4]);
+        p12 = pairs12_->pair(sh1, sh2);
+        p34 = pairs34_->pair(sh3, sh4);
 
         nprim = fill_primitive_data(libint_.PrimQuartet, fjt_, p12, p34, am, nprim1, nprim2, nprim3, nprim4, sh1 == sh2,
                                     sh3 == sh4, 0);
@@ -2787,9 +2684,9 @@ size_t TwoElectronInt::compute_quartet_deriv1(int sh1, int sh2, int sh3, int sh4
     nprim = 0;
 
     if (use_shell_pairs_) {
-        ShellPair *p12, *p34;
-        p12 = &(pairs12_[sh1][sh2]);
-        p34 = &(pairs34_[sh3][sh4]);
+        const ShellPair *p12, *p34;
+        p12 = pairs12_->pair(sh1, sh2);
+        p34 = pairs34_->pair(sh3, sh4);
 
         nprim = fill_primitive_data(libderiv_.PrimQuartet, fjt_, p12, p34, am, nprim1, nprim2, nprim3, nprim4,
                                     sh1 == sh2, sh3 == sh4, 1);
@@ -3128,9 +3025,9 @@ size_t TwoElectronInt::compute_quartet_deriv2(int sh1, int sh2, int sh3, int sh4
 
     // prepare all the data needed for libderiv
     if (use_shell_pairs_) {
-        ShellPair *p12, *p34;
-        p12 = &(pairs12_[sh1][sh2]);
-        p34 = &(pairs34_[sh3][sh4]);
+        const ShellPair *p12, *p34;
+        p12 = pairs12_->pair(sh1, sh2);
+        p34 = pairs34_->pair(sh3, sh4);
 
         nprim = fill_primitive_data(libderiv_.PrimQuartet, fjt_, p12, p34, am, nprim1, nprim2, nprim3, nprim4,
                                     sh1 == sh2, sh3 == sh4, 2);
@@ -61,8 +61,10 @@
 #include "psi4/libciomr/libciomr.h"
 #include "psi4/psi4-dec.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
+#include "psi4/libpsi4util/exception.h"
 
 #include <cmath>
+#include <vector>
 
 using namespace psi;
 ;
@@ -518,6 +520,103 @@ double* FJT::values(int J, double wval) {
     return int_fjttable;
 }
 
+////////
+// Tabulated_Fjt
+////////
+
+namespace {
+
+/// Taylor table of F_m(T) on T = i * delta, 0 <= i < nT, 0 <= m <= max_j + order
+struct BoysTable {
+    static const int order = 6;
+    static constexpr double delta = 0.05;
+    // Beyond Tmax, F_0(T) = sqrt(pi / T) / 2 to double precision and the upward
+    // recursion is stable for every j <= max_j
+    static constexpr double Tmax = 40.0;
+
+    int nm;
+    int nT;
+    std::vector<double> grid;
+
+    BoysTable() : nm(Tabulated_Fjt::max_j + order + 1), nT(static_cast<int>(Tmax / delta) + 2) {
+        grid.resize(static_cast<size_t>(nT) * nm);
+        for (int i = 0; i < nT; ++i) Tabulated_Fjt::reference_values(nm - 1, i * delta, &grid[i * nm]);
+    }
+};
+
+const BoysTable& boys_table() {
+    static const BoysTable table;
+    return table;
+}
+
+}  // namespace
+
+Tabulated_Fjt::Tabulated_Fjt() : F_(new double[max_j + 1]) { boys_table(); }
+
+Tabulated_Fjt::~Tabulated_Fjt() { delete[] F_; }
+
+double* Tabulated_Fjt::values(int J, double T) {
+    batch_values(J, 1, &T, F_, 1);
+    return F_;
+}
+
+void Tabulated_Fjt::reference_values(int J, double T, double* F) {
+    // F_J(T) = exp(-T) sum_i (2T)^i / ((2J+1)(2J+3)...(2J+2i+1)); all terms are positive
+    const double two_T = 2.0 * T;
+    const double expT = std::exp(-T);
+    double term = 1.0 / (2 * J + 1);
+    double sum = term;
+    for (int i = 1; i < 1000 && term > 1.0e-17 * sum; ++i) {
+        term *= two_T / (2 * J + 2 * i + 1);
+        sum += term;
+    }
+    F[J] = sum * expT;
+    for (int j = J - 1; j >= 0; --j) F[j] = (two_T * F[j + 1] + expT) / (2 * j + 1);
+}
+
+void Tabulated_Fjt::batch_values(int J, size_t n, const double* T, double* F, size_t ldf) {
+    if (J > max_j) throw PSIEXCEPTION("Tabulated_Fjt: J is larger than max_j.");
+    const BoysTable& table = boys_table();
+
+    // exp(-T) for the downward recursion; kept in the j = 0 row of F until then
+    double* FJ = F + J * ldf;
+    double* expT = F;
+    double upward[max_j + 1];
+
+    for (size_t k = 0; k < n; ++k) {
+        const double Tk = T[k];
+        if (Tk < BoysTable::Tmax) {
+            // Taylor expansion around the nearest grid point, dF_m/dT = -F_{m+1}
+            const int i = static_cast<int>(Tk / BoysTable::delta + 0.5);
+            const double mdT = i * BoysTable::delta - Tk;
+            const double* Fi = &table.grid[static_cast<size_t>(i) * table.nm + J];
+            double value = Fi[BoysTable::order];
+            for (int p = BoysTable::order; p > 0; --p) value = Fi[p - 1] + value * mdT / p;
+            FJ[k] = value;
+        } else {
+            const double e = std::exp(-Tk);
+            upward[0] = 0.5 * M_SQRT_PI / std::sqrt(Tk);
+            for (int j = 0; j < J; ++j) upward[j + 1] = ((2 * j + 1) * upward[j] - e) / (2.0 * Tk);
+            FJ[k] = upward[J];
+        }
+    }
+    if (J == 0) return;
+
+    for (size_t k = 0; k < n; ++k) expT[k] = std::exp(-T[k]);
+
+    // Downward recursion, the j = 0 row is last as it holds exp(-T)
+    for (int j = J - 1; j >= 1; --j) {
+        double* Fj = F + j * ldf;
+        const double* Fj1 = Fj + ldf;
+        const double oo2j1 = 1.0 / (2 * j + 1);
+#pragma omp simd
+        for (size_t k = 0; k < n; ++k) Fj[k] = (2.0 * T[k] * Fj1[k] + expT[k]) * oo2j1;
+    }
+    const double* F1 = F + ldf;
+#pragma omp simd
+    for (size_t k = 0; k < n; ++k) F[k] = 2.0 * T[k] * F1[k] + expT[k];
+}
+
 ////////
 // GaussianFundamental
 ////////
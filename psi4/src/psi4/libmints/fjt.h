@@ -130,6 +130,31 @@ class FJT : public Fjt {
     double* values(int J, double T) override;
 };
 
+/**
+ *  Boys function for batches of arguments. F_J(T) is interpolated from a
+ *  6th-order Taylor table shared by all instances (upward recursion from the
+ *  asymptotic F_0(T) beyond the table), then F_j(T), j < J, follow by downward
+ *  recursion, which is vectorized over the arguments.
+ */
+class Tabulated_Fjt : public Fjt {
+    double* F_;
+
+   public:
+    /// Highest j that can be computed
+    static const int max_j = 32;
+
+    Tabulated_Fjt();
+    ~Tabulated_Fjt() override;
+    /// Implements Fjt::values()
+    double* values(int J, double T) override;
+
+    /** Computes F_j(T[k]) for every 0 <= j <= J and 0 <= k < n into F[j * ldf + k], ldf >= n.
+        Thread-safe; the caller owns all memory. */
+    static void batch_values(int J, size_t n, const double* T, double* F, size_t ldf);
+    /// Series evaluation of F_j(T), 0 <= j <= J, that the table is built from
+    static void reference_values(int J, double T, double* F);
+};
+
 class GaussianFundamental : public Fjt {
    protected:
     std::shared_ptr<CorrelationFactor> cf_;
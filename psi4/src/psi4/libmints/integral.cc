@@ -34,6 +34,7 @@
 #include "psi4/libmints/multipolepotential.h"
 #include "psi4/libmints/eri.h"
 #include "psi4/libmints/multipoles.h"
+#include "psi4/libmints/multioperator.h"
 #include "psi4/libmints/quadrupole.h"
 #include "psi4/libmints/angularmomentum.h"
 #include "psi4/libmints/nabla.h"
@@ -181,6 +182,10 @@ OneBodyAOInt* IntegralFactory::ao_multipoles(int order) {
     return new MultipoleInt(spherical_transforms_, bs1_, bs2_, order);
 }
 
+OneBodyAOInt* IntegralFactory::ao_operators(const std::vector<std::string>& operators) {
+    return new MultiOperatorInt(spherical_transforms_, bs1_, bs2_, operators);
+}
+
 OneBodyAOInt* IntegralFactory::ao_multipole_potential(int max_k, int deriv) {
     return new MultipolePotentialInt(spherical_transforms_, bs1_, bs2_, max_k, deriv);
 }
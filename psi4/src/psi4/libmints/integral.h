@@ -450,6 +450,9 @@ class PSI_API IntegralFactory {
     virtual OneBodyAOInt* ao_multipoles(int order);
     virtual OneBodySOInt* so_multipoles(int order);
 
+    /// Returns an OneBodyInt that computes several operators in one pass (see MultiOperatorInt).
+    virtual OneBodyAOInt* ao_operators(const std::vector<std::string>& operators);
+
     /// Returns an OneBodyInt that computes the traceless quadrupole integral.
     virtual OneBodyAOInt* ao_traceless_quadrupole();
     virtual OneBodySOInt* so_traceless_quadrupole();
@@ -29,21 +29,379 @@
 #include "local.h"
 
 #include <algorithm>
+#include <cmath>
+#include <functional>
+#include <utility>
 
 #include "psi4/libqt/qt.h"
 #include "psi4/libmints/matrix.h"
+#include "psi4/libmints/vector.h"
 #include "psi4/libmints/molecule.h"
 #include "psi4/libmints/onebody.h"
 #include "psi4/libmints/basisset.h"
 #include "psi4/libmints/integral.h"
 #include "psi4/liboptions/liboptions.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
+#include "psi4/libpsi4util/libpsi4util.h"
 #include "psi4/libpsi4util/process.h"
 
 using namespace psi;
 
 namespace psi {
 
+namespace {
+
+// => Sweep ordering <= //
+
+/// Random permutation of the orbitals for one sweep (reproducible after srand(0))
+std::vector<int> random_order(int nmo) {
+    std::vector<int> order;
+    for (int i = 0; i < nmo; i++) {
+        order.push_back(i);
+    }
+    std::vector<int> order2;
+    for (int i = 0; i < nmo; i++) {
+        int pivot = (1L * (nmo - i) * rand()) / RAND_MAX;
+        int i2 = order[pivot];
+        order[pivot] = order[nmo - i - 1];
+        order2.push_back(i2);
+    }
+    return order2;
+}
+
+/// Round-robin (tournament) schedule: every pair of orbitals appears exactly once, and the pairs within a round
+/// are disjoint, so their rotations commute and may be applied concurrently
+std::vector<std::vector<std::pair<int, int> > > tournament_rounds(const std::vector<int>& order) {
+    int n = order.size();
+    int m = n + (n % 2);  // one dummy slot for odd n
+
+    std::vector<int> slots(m);
+    for (int k = 0; k < m; k++) {
+        slots[k] = k;
+    }
+
+    std::vector<std::vector<std::pair<int, int> > > rounds;
+    for (int r = 0; r < m - 1; r++) {
+        std::vector<std::pair<int, int> > round;
+        for (int k = 0; k < m / 2; k++) {
+            int a = slots[k];
+            int b = slots[m - 1 - k];
+            if (a < n && b < n) round.push_back(std::make_pair(order[a], order[b]));
+        }
+        rounds.push_back(round);
+        // Circle method: slot 0 stays put, the rest rotate by one
+        std::rotate(slots.begin() + 1, slots.end() - 1, slots.end());
+    }
+    return rounds;
+}
+
+// => Jacobi angles <= //
+
+/// Optimal 2x2 rotation angle given the accumulated elements a, b, c
+double jacobi_angle(double a, double b, double c) {
+    double Hd = a - b;
+    double Ho = 2.0 * c;
+    return 0.5 * atan2(Ho, Hd + sqrt(Hd * Hd + Ho * Ho));
+}
+
+double boys_angle(const std::vector<double**>& Dp, int i, int j, int debug) {
+    double a = 0.0;
+    double b = 0.0;
+    double c = 0.0;
+    for (int xyz = 0; xyz < 3; xyz++) {
+        double** Ak = Dp[xyz];
+        double Ad = (Ak[i][i] - Ak[j][j]);
+        double Ao = 2.0 * Ak[i][j];
+        a += Ad * Ad;
+        b += Ao * Ao;
+        c += Ad * Ao;
+    }
+
+    double theta = jacobi_angle(a, b, c);
+
+    // Check for trivial (maximal) rotation, which might be better with theta = pi/4
+    if (std::fabs(theta) < 1.0E-8) {
+        double O0 = 0.0;
+        double O1 = 0.0;
+        for (int xyz = 0; xyz < 3; xyz++) {
+            double** Ak = Dp[xyz];
+            O0 += Ak[i][j] * Ak[i][j];
+            O1 += 0.25 * (Ak[j][j] - Ak[i][i]) * (Ak[j][j] - Ak[i][i]);
+        }
+        if (O1 < O0) {
+            theta = M_PI / 4.0;
+            if (debug > 3) {
+                outfile->Printf("@Break\n");
+            }
+        }
+    }
+
+    if (debug > 3) {
+        outfile->Printf("@Rotation, i = %4d, j = %4d, Theta = %24.16E\n", i, j, theta);
+        outfile->Printf("@Info, a = %24.16E, b = %24.16E, c = %24.16E\n", a, b, c);
+    }
+
+    return theta;
+}
+
+double pm_angle(double** LSp, double** Lp, const std::vector<int>& Astarts, int nmo, int i, int j, int debug) {
+    int nA = Astarts.size() - 1;
+
+    double a = 0.0;
+    double b = 0.0;
+    double c = 0.0;
+    for (int A = 0; A < nA; A++) {
+        int nm = Astarts[A + 1] - Astarts[A];
+        int off = Astarts[A];
+        double Aii = C_DDOT(nm, &LSp[off][i], nmo, &Lp[off][i], nmo);
+        double Ajj = C_DDOT(nm, &LSp[off][j], nmo, &Lp[off][j], nmo);
+        double Aij = 0.5 * C_DDOT(nm, &LSp[off][i], nmo, &Lp[off][j], nmo) +
+                     0.5 * C_DDOT(nm, &LSp[off][j], nmo, &Lp[off][i], nmo);
+
+        double Ad = (Aii - Ajj);
+        double Ao = 2.0 * Aij;
+        a += Ad * Ad;
+        b += Ao * Ao;
+        c += Ad * Ao;
+    }
+
+    double theta = jacobi_angle(a, b, c);
+
+    // Check for trivial (maximal) rotation, which might be better with theta = pi/4
+    if (std::fabs(theta) < 1.0E-8) {
+        double O0 = 0.0;
+        double O1 = 0.0;
+        for (int A = 0; A < nA; A++) {
+            int nm = Astarts[A + 1] - Astarts[A];
+            int off = Astarts[A];
+            double Aii = C_DDOT(nm, &LSp[off][i], nmo, &Lp[off][i], nmo);
+            double Ajj = C_DDOT(nm, &LSp[off][j], nmo, &Lp[off][j], nmo);
+            double Aij = 0.5 * C_DDOT(nm, &LSp[off][i], nmo, &Lp[off][j], nmo) +
+                         0.5 * C_DDOT(nm, &LSp[off][j], nmo, &Lp[off][i], nmo);
+            O0 += Aij * Aij;
+            O1 += 0.25 * (Ajj - Aii) * (Ajj - Aii);
+        }
+        if (O1 < O0) {
+            theta = M_PI / 4.0;
+            if (debug > 3) {
+                outfile->Printf("@Break\n");
+            }
+        }
+    }
+
+    if (debug > 3) {
+        outfile->Printf("@Rotation, i = %4d, j = %4d, Theta = %24.16E\n", i, j, theta);
+        outfile->Printf("@Info, a = %24.16E, b = %24.16E, c = %24.16E\n", a, b, c);
+    }
+
+    return theta;
+}
+
+// => Trust-region Newton <= //
+
+/*
+ * Both localizers maximize f = sum_k sum_i (A^k_ii)^2 over symmetric metric matrices A^k (dipoles for Boys,
+ * atomic populations for PM). Rotations are parametrized as A^k -> exp(-K) A^k exp(K) with K antisymmetric;
+ * gradients and Hessian products are stored as full antisymmetric matrices over the independent p < q elements.
+ */
+
+double diagonal_metric(const std::vector<SharedMatrix>& A) {
+    double metric = 0.0;
+    for (size_t k = 0; k < A.size(); k++) {
+        int n = A[k]->rowspi()[0];
+        double** Ap = A[k]->pointer();
+        metric += C_DDOT(n, Ap[0], n + 1, Ap[0], n + 1);
+    }
+    return metric;
+}
+
+/// Inner product over the independent (p < q) elements
+double antisymmetric_dot(const SharedMatrix& X, const SharedMatrix& Y) { return 0.5 * X->vector_dot(Y); }
+
+/// G_pq = 4 sum_k A_pq (A_qq - A_pp)
+SharedMatrix metric_gradient(const std::vector<SharedMatrix>& A) {
+    int n = A[0]->rowspi()[0];
+    auto G = std::make_shared<Matrix>("G", n, n);
+    double** Gp = G->pointer();
+    for (size_t k = 0; k < A.size(); k++) {
+        double** Ap = A[k]->pointer();
+#pragma omp parallel for schedule(static)
+        for (int p = 0; p < n; p++) {
+            for (int q = 0; q < n; q++) {
+                Gp[p][q] += 4.0 * Ap[p][q] * (Ap[q][q] - Ap[p][p]);
+            }
+        }
+    }
+    return G;
+}
+
+/// Exact Hessian times the antisymmetric direction K, without forming the Hessian
+SharedMatrix metric_hessian_product(const std::vector<SharedMatrix>& A, const SharedMatrix& K) {
+    int n = A[0]->rowspi()[0];
+    auto H = std::make_shared<Matrix>("HK", n, n);
+    auto AK = std::make_shared<Matrix>("AK", n, n);
+    auto KA = std::make_shared<Matrix>("KA", n, n);
+    auto KM = std::make_shared<Matrix>("KM", n, n);
+    auto Kd = std::make_shared<Matrix>("K diag(A)", n, n);
+    double** Hp = H->pointer();
+    double** Kp = K->pointer();
+    double** AKp = AK->pointer();
+    double** KAp = KA->pointer();
+    double** KMp = KM->pointer();
+    double** Kdp = Kd->pointer();
+    std::vector<double> a(n);
+
+    for (size_t k = 0; k < A.size(); k++) {
+        double** Ap = A[k]->pointer();
+        for (int p = 0; p < n; p++) {
+            a[p] = Ap[p][p];
+        }
+
+        // B = [A, K] = AK - KA, M = diag(a) A
+        C_DGEMM('N', 'N', n, n, n, 1.0, Ap[0], n, Kp[0], n, 0.0, AKp[0], n);
+        C_DGEMM('N', 'N', n, n, n, 1.0, Kp[0], n, Ap[0], n, 0.0, KAp[0], n);
+        for (int p = 0; p < n; p++) {
+            for (int q = 0; q < n; q++) {
+                Kdp[p][q] = Kp[p][q] * a[q];
+            }
+        }
+        C_DGEMM('N', 'N', n, n, n, 1.0, Kdp[0], n, Ap[0], n, 0.0, KMp[0], n);
+
+#pragma omp parallel for schedule(static)
+        for (int p = 0; p < n; p++) {
+            double Bpp = AKp[p][p] - KAp[p][p];
+            for (int q = 0; q < n; q++) {
+                double Bqq = AKp[q][q] - KAp[q][q];
+                // First-order change of the diagonals, squared
+                Hp[p][q] += 4.0 * Ap[p][q] * (Bqq - Bpp);
+                // Second-order change of the diagonals, X_pq - X_qp with
+                // X_pq = 2 (KM)_qp + 2 (a_q - a_p) (AK)_qp - 2 a_q (KA)_qp
+                double Xpq = 2.0 * KMp[q][p] + 2.0 * (a[q] - a[p]) * AKp[q][p] - 2.0 * a[q] * KAp[q][p];
+                double Xqp = 2.0 * KMp[p][q] + 2.0 * (a[p] - a[q]) * AKp[p][q] - 2.0 * a[p] * KAp[p][q];
+                Hp[p][q] += Xpq - Xqp;
+            }
+        }
+    }
+    return H;
+}
+
+/// exp(K) for antisymmetric K: with -K^2 = V w^2 V^T, exp(K) = V cos(w) V^T + K V (sin(w) / w) V^T
+SharedMatrix antisymmetric_exp(const SharedMatrix& K) {
+    int n = K->rowspi()[0];
+    SharedMatrix K2 = linalg::doublet(K, K, false, false);
+    K2->scale(-1.0);
+
+    auto V = std::make_shared<Matrix>("V", n, n);
+    auto w2 = std::make_shared<Vector>("w2", n);
+    K2->diagonalize(V, w2);
+
+    auto Vc = std::make_shared<Matrix>("V cos(w)", n, n);
+    auto Vs = std::make_shared<Matrix>("V sin(w) / w", n, n);
+    double** Vp = V->pointer();
+    double** Vcp = Vc->pointer();
+    double** Vsp = Vs->pointer();
+    for (int m = 0; m < n; m++) {
+        double w = std::sqrt(std::max(w2->get(m), 0.0));
+        double c = std::cos(w);
+        double s = (w > 1.0E-14 ? std::sin(w) / w : 1.0);
+        for (int p = 0; p < n; p++) {
+            Vcp[p][m] = c * Vp[p][m];
+            Vsp[p][m] = s * Vp[p][m];
+        }
+    }
+
+    SharedMatrix R = linalg::doublet(Vc, V, false, true);
+    R->add(linalg::triplet(K, Vs, V, false, false, true));
+    return R;
+}
+
+/// Steihaug-Toint truncated CG for max g.s + 1/2 s.Hs subject to |s| <= radius. Returns the step and the
+/// predicted increase of the metric
+SharedMatrix steihaug_step(const std::vector<SharedMatrix>& A, const SharedMatrix& G, double radius,
+                           double& predicted) {
+    int n = G->rowspi()[0];
+    int maxiter = n * (n - 1) / 2;
+    double gnorm = std::sqrt(antisymmetric_dot(G, G));
+    double tol = std::min(0.5, std::sqrt(gnorm)) * gnorm;
+
+    // Minimize -g.s - 1/2 s.Hs: residual r = g + Hs, starting from s = 0
+    auto s = std::make_shared<Matrix>("s", n, n);
+    if (gnorm == 0.0) {
+        predicted = 0.0;
+        return s;
+    }
+    SharedMatrix r = G->clone();
+    SharedMatrix d = G->clone();
+    double rr = antisymmetric_dot(r, r);
+
+    for (int iter = 0; iter < maxiter; iter++) {
+        SharedMatrix Hd = metric_hessian_product(A, d);
+        Hd->scale(-1.0);
+        double dHd = antisymmetric_dot(d, Hd);
+
+        double alpha = (dHd > 0.0 ? rr / dHd : 0.0);
+        SharedMatrix s2 = s->clone();
+        s2->axpy(alpha, d);
+
+        if (dHd <= 0.0 || std::sqrt(antisymmetric_dot(s2, s2)) >= radius) {
+            // Negative curvature or leaving the trust region: follow d to the boundary
+            double dd = antisymmetric_dot(d, d);
+            double sd = antisymmetric_dot(s, d);
+            double ss = antisymmetric_dot(s, s);
+            double tau = (-sd + std::sqrt(sd * sd + dd * (radius * radius - ss))) / dd;
+            s->axpy(tau, d);
+            break;
+        }
+
+        s = s2;
+        r->axpy(-alpha, Hd);
+        double rr2 = antisymmetric_dot(r, r);
+        if (std::sqrt(rr2) < tol) break;
+
+        d->scale(rr2 / rr);
+        d->add(r);
+        rr = rr2;
+    }
+
+    SharedMatrix Hs = metric_hessian_product(A, s);
+    predicted = antisymmetric_dot(G, s) + 0.5 * antisymmetric_dot(s, Hs);
+    return s;
+}
+
+/// One trust-region Newton step. trial(R) returns the metric matrices after rotating by R = exp(K);
+/// accept(R, A2) commits that rotation. Returns false if no uphill step was found
+bool trust_region_step(const std::vector<SharedMatrix>& A, double& radius,
+                       const std::function<std::vector<SharedMatrix>(const SharedMatrix&)>& trial,
+                       const std::function<void(const SharedMatrix&, const std::vector<SharedMatrix>&)>& accept) {
+    double f0 = diagonal_metric(A);
+    SharedMatrix G = metric_gradient(A);
+
+    for (int attempt = 0; attempt < 10; attempt++) {
+        double predicted;
+        SharedMatrix K = steihaug_step(A, G, radius, predicted);
+        if (!(predicted > 0.0)) return false;
+
+        SharedMatrix R = antisymmetric_exp(K);
+        std::vector<SharedMatrix> A2 = trial(R);
+        double rho = (diagonal_metric(A2) - f0) / predicted;
+
+        double step = std::sqrt(antisymmetric_dot(K, K));
+        if (rho < 0.25) {
+            radius = 0.25 * step;
+        } else if (rho > 0.75 && step > 0.99 * radius) {
+            radius = std::min(2.0 * radius, 4.0);
+        }
+
+        if (rho > 0.0) {
+            accept(R, A2);
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
 Localizer::Localizer(std::shared_ptr<BasisSet> primary, std::shared_ptr<Matrix> C) : primary_(primary), C_(C) {
     if (C->nirrep() != 1) {
         throw PSIEXCEPTION("Localizer: C matrix is not C1");
@@ -60,8 +418,17 @@ void Localizer::common_init() {
     bench_ = 0;
     convergence_ = 1.0E-8;
     maxiter_ = 50;
+    algorithm_ = "JACOBI";
+    trust_radius_ = 0.5;
     converged_ = false;
 }
+void Localizer::set_algorithm(const std::string& algorithm) {
+    std::string alg = to_upper_copy(algorithm);
+    if (alg != "JACOBI" && alg != "PARALLEL_JACOBI" && alg != "NEWTON") {
+        throw PSIEXCEPTION("Localizer: Unrecognized rotation algorithm " + algorithm);
+    }
+    algorithm_ = alg;
+}
 std::shared_ptr<Localizer> Localizer::build(const std::string& type, std::shared_ptr<BasisSet> primary,
                                             std::shared_ptr<Matrix> C, Options& options) {
     std::shared_ptr<Localizer> local;
@@ -81,6 +448,7 @@ std::shared_ptr<Localizer> Localizer::build(const std::string& type, std::shared
     local->set_bench(options.get_int("BENCH"));
     local->set_convergence(options.get_double("LOCAL_CONVERGENCE"));
     local->set_maxiter(options.get_int("LOCAL_MAXITER"));
+    if (options.exists_in_active("LOCAL_ALGORITHM")) local->set_algorithm(options.get_str("LOCAL_ALGORITHM"));
 
     return local;
 }
@@ -143,6 +511,7 @@ BoysLocalizer::~BoysLocalizer() {}
 void BoysLocalizer::common_init() {}
 void BoysLocalizer::print_header() const {
     outfile->Printf("  ==> Boys Localizer <==\n\n");
+    outfile->Printf("    Algorithm   = %11s\n", algorithm_.c_str());
     outfile->Printf("    Convergence = %11.3E\n", convergence_);
     outfile->Printf("    Maxiter     = %11d\n", maxiter_);
     outfile->Printf("\n");
@@ -199,16 +568,32 @@ void BoysLocalizer::localize() {
     double** Lp = L_->pointer();
     double** Up = U_->pointer();
 
+    // => Newton step callbacks (U is stored transposed until the end) <= //
+
+    auto trial = [&Dmo](const SharedMatrix& R) {
+        std::vector<SharedMatrix> A2;
+        for (int xyz = 0; xyz < 3; xyz++) {
+            A2.push_back(linalg::triplet(R, Dmo[xyz], R, true, false, false));
+        }
+        return A2;
+    };
+    auto accept = [this, &Dmo](const SharedMatrix& R, const std::vector<SharedMatrix>& A2) {
+        for (int xyz = 0; xyz < 3; xyz++) {
+            Dmo[xyz]->copy(A2[xyz]);
+        }
+        U_->copy(linalg::doublet(R, U_, true, false));
+    };
+    double radius = trust_radius_;
+    bool newton = false;
+    bool newton_failed = false;
+
     // => Seed the random idempotently <= //
 
     srand(0L);
 
     // => Metric <= //
 
-    double metric = 0.0;
-    for (int xyz = 0; xyz < 3; xyz++) {
-        metric += C_DDOT(nmo, Dp[xyz][0], nmo + 1, Dp[xyz][0], nmo + 1);
-    }
+    double metric = diagonal_metric(Dmo);
     double old_metric = metric;
 
     // => Iteration Print <= //
@@ -217,97 +602,98 @@ void BoysLocalizer::localize() {
 
     // ==> Master Loop <== //
 
-    double Ad, Ao, a, b, c, Hd, Ho, theta, cc, ss;
-
     for (int iter = 1; iter <= maxiter_; iter++) {
-        // => Random Permutation <= //
+        if (newton) {
+            // => Trust-region Newton step <= //
+
+            if (!trust_region_step(Dmo, radius, trial, accept)) {
+                // No uphill step inside the trust region: finish with Jacobi sweeps
+                outfile->Printf("    Trust-region step failed, switching to Jacobi sweeps.\n");
+                newton = false;
+                newton_failed = true;
+                continue;
+            }
 
-        std::vector<int> order;
-        for (int i = 0; i < nmo; i++) {
-            order.push_back(i);
-        }
-        std::vector<int> order2;
-        for (int i = 0; i < nmo; i++) {
-            int pivot = (1L * (nmo - i) * rand()) / RAND_MAX;
-            int i2 = order[pivot];
-            order[pivot] = order[nmo - i - 1];
-            order2.push_back(i2);
-        }
+        } else if (algorithm_ == "JACOBI") {
+            // => Random Permutation <= //
 
-        // => Jacobi sweep <= //
-
-        for (int i2 = 0; i2 < nmo - 1; i2++) {
-            for (int j2 = i2 + 1; j2 < nmo; j2++) {
-                int i = order2[i2];
-                int j = order2[j2];
-
-                // > Compute the rotation < //
-
-                // H elements
-                a = 0.0;
-                b = 0.0;
-                c = 0.0;
-                for (int xyz = 0; xyz < 3; xyz++) {
-                    double** Ak = Dp[xyz];
-                    Ad = (Ak[i][i] - Ak[j][j]);
-                    Ao = 2.0 * Ak[i][j];
-                    a += Ad * Ad;
-                    b += Ao * Ao;
-                    c += Ad * Ao;
-                }
+            std::vector<int> order2 = random_order(nmo);
+
+            // => Jacobi sweep <= //
 
-                // Theta
-                Hd = a - b;
-                Ho = 2.0 * c;
-                theta = 0.5 * atan2(Ho, Hd + sqrt(Hd * Hd + Ho * Ho));
+            for (int i2 = 0; i2 < nmo - 1; i2++) {
+                for (int j2 = i2 + 1; j2 < nmo; j2++) {
+                    int i = order2[i2];
+                    int j = order2[j2];
 
-                // Check for trivial (maximal) rotation, which might be better with theta = pi/4
-                if (std::fabs(theta) < 1.0E-8) {
-                    double O0 = 0.0;
-                    double O1 = 0.0;
-                    ;
+                    // > Compute the rotation < //
+
+                    double theta = boys_angle(Dp, i, j, debug_);
+                    double cc = cos(theta);
+                    double ss = sin(theta);
+
+                    // > Apply the rotation < //
+
+                    // rows and columns of A^k
                     for (int xyz = 0; xyz < 3; xyz++) {
                         double** Ak = Dp[xyz];
-                        O0 += Ak[i][j] * Ak[i][j];
-                        O1 += 0.25 * (Ak[j][j] - Ak[i][i]) * (Ak[j][j] - Ak[i][i]);
-                    }
-                    if (O1 < O0) {
-                        theta = M_PI / 4.0;
-                        if (debug_ > 3) {
-                            outfile->Printf("@Break\n");
-                        }
+                        C_DROT(nmo, &Ak[i][0], 1, &Ak[j][0], 1, cc, ss);
+                        C_DROT(nmo, &Ak[0][i], nmo, &Ak[0][j], nmo, cc, ss);
                     }
+
+                    // Q
+                    C_DROT(nmo, Up[i], 1, Up[j], 1, cc, ss);
                 }
+            }
+
+        } else {
+            // => Round-robin Jacobi sweep <= //
+
+            std::vector<std::vector<std::pair<int, int> > > rounds = tournament_rounds(random_order(nmo));
+
+            for (size_t r = 0; r < rounds.size(); r++) {
+                const std::vector<std::pair<int, int> >& pairs = rounds[r];
+                int npair = pairs.size();
+                std::vector<double> cc(npair);
+                std::vector<double> ss(npair);
 
-                // Givens rotation
-                cc = cos(theta);
-                ss = sin(theta);
+                // > Compute the rotations (the 2x2 blocks of disjoint pairs are independent) < //
 
-                if (debug_ > 3) {
-                    outfile->Printf("@Rotation, i = %4d, j = %4d, Theta = %24.16E\n", i, j, theta);
-                    outfile->Printf("@Info, a = %24.16E, b = %24.16E, c = %24.16E\n", a, b, c);
+#pragma omp parallel for schedule(dynamic)
+                for (int p = 0; p < npair; p++) {
+                    double theta = boys_angle(Dp, pairs[p].first, pairs[p].second, 0);
+                    cc[p] = cos(theta);
+                    ss[p] = sin(theta);
                 }
 
-                // > Apply the rotation < //
+                // > Apply the rotations: all rows, then all columns < //
 
-                // rows and columns of A^k
-                for (int xyz = 0; xyz < 3; xyz++) {
-                    double** Ak = Dp[xyz];
-                    C_DROT(nmo, &Ak[i][0], 1, &Ak[j][0], 1, cc, ss);
-                    C_DROT(nmo, &Ak[0][i], nmo, &Ak[0][j], nmo, cc, ss);
+#pragma omp parallel for schedule(static)
+                for (int p = 0; p < npair; p++) {
+                    int i = pairs[p].first;
+                    int j = pairs[p].second;
+                    for (int xyz = 0; xyz < 3; xyz++) {
+                        double** Ak = Dp[xyz];
+                        C_DROT(nmo, &Ak[i][0], 1, &Ak[j][0], 1, cc[p], ss[p]);
+                    }
+                    C_DROT(nmo, Up[i], 1, Up[j], 1, cc[p], ss[p]);
                 }
 
-                // Q
-                C_DROT(nmo, Up[i], 1, Up[j], 1, cc, ss);
+#pragma omp parallel for schedule(static)
+                for (int p = 0; p < npair; p++) {
+                    int i = pairs[p].first;
+                    int j = pairs[p].second;
+                    for (int xyz = 0; xyz < 3; xyz++) {
+                        double** Ak = Dp[xyz];
+                        C_DROT(nmo, &Ak[0][i], nmo, &Ak[0][j], nmo, cc[p], ss[p]);
+                    }
+                }
             }
         }
 
         // => Metric <= //
 
-        metric = 0.0;
-        for (int xyz = 0; xyz < 3; xyz++) {
-            metric += C_DDOT(nmo, Dp[xyz][0], nmo + 1, Dp[xyz][0], nmo + 1);
-        }
+        metric = diagonal_metric(Dmo);
 
         double conv = std::fabs(metric - old_metric) / std::fabs(old_metric);
         old_metric = metric;
@@ -322,6 +708,9 @@ void BoysLocalizer::localize() {
             converged_ = true;
             break;
         }
+
+        // Sweeps are cheap far from the maximum, Newton steps are cheap close to it
+        if (algorithm_ == "NEWTON" && !newton_failed && conv < 1.0E-4) newton = true;
     }
 
     outfile->Printf("\n");
@@ -342,6 +731,7 @@ PMLocalizer::~PMLocalizer() {}
 void PMLocalizer::common_init() {}
 void PMLocalizer::print_header() const {
     outfile->Printf("  ==> Pipek-Mezey Localizer <==\n\n");
+    outfile->Printf("    Algorithm   = %11s\n", algorithm_.c_str());
     outfile->Printf("    Convergence = %11.3E\n", convergence_);
     outfile->Printf("    Maxiter     = %11d\n", maxiter_);
     outfile->Printf("\n");
@@ -398,6 +788,41 @@ void PMLocalizer::localize() {
     }
     Astarts.push_back(primary_->nbf());
 
+    // => Newton step callbacks: atomic population matrices Q^A = 1/2 (LS_A^T L_A + L_A^T LS_A) <= //
+
+    auto populations = [nA, nmo, &Astarts](const SharedMatrix& L, const SharedMatrix& LS) {
+        std::vector<SharedMatrix> Q;
+        double** L2p = L->pointer();
+        double** LS2p = LS->pointer();
+        for (int A = 0; A < nA; A++) {
+            int nm = Astarts[A + 1] - Astarts[A];
+            int off = Astarts[A];
+            auto QA = std::make_shared<Matrix>("Q", nmo, nmo);
+            double** QAp = QA->pointer();
+            if (nm) C_DGEMM('T', 'N', nmo, nmo, nm, 1.0, LS2p[off], nmo, L2p[off], nmo, 0.0, QAp[0], nmo);
+            QA->hermitivitize();
+            Q.push_back(QA);
+        }
+        return Q;
+    };
+    SharedMatrix L2;
+    SharedMatrix LS2;
+    auto trial = [this, &LS, &L2, &LS2, &populations](const SharedMatrix& R) {
+        L2 = linalg::doublet(L_, R, false, false);
+        LS2 = linalg::doublet(LS, R, false, false);
+        return populations(L2, LS2);
+    };
+    std::vector<SharedMatrix> Q;
+    auto accept = [this, &LS, &L2, &LS2, &Q](const SharedMatrix& R, const std::vector<SharedMatrix>& Q2) {
+        L_->copy(L2);
+        LS->copy(LS2);
+        U_->copy(linalg::doublet(R, U_, true, false));
+        Q = Q2;
+    };
+    double radius = trust_radius_;
+    bool newton = false;
+    bool newton_failed = false;
+
     // => Seed the random idempotently <= //
 
     srand(0L);
@@ -421,96 +846,78 @@ void PMLocalizer::localize() {
 
     // ==> Master Loop <== //
 
-    double Aii, Ajj, Aij, Ad, Ao, a, b, c, Hd, Ho, theta, cc, ss;
-
     for (int iter = 1; iter <= maxiter_; iter++) {
-        // => Random Permutation <= //
+        if (newton) {
+            // => Trust-region Newton step <= //
+
+            if (Q.empty()) Q = populations(L_, LS);
+            if (!trust_region_step(Q, radius, trial, accept)) {
+                // No uphill step inside the trust region: finish with Jacobi sweeps
+                outfile->Printf("    Trust-region step failed, switching to Jacobi sweeps.\n");
+                newton = false;
+                newton_failed = true;
+                continue;
+            }
 
-        std::vector<int> order;
-        for (int i = 0; i < nmo; i++) {
-            order.push_back(i);
-        }
-        std::vector<int> order2;
-        for (int i = 0; i < nmo; i++) {
-            int pivot = (1L * (nmo - i) * rand()) / RAND_MAX;
-            int i2 = order[pivot];
-            order[pivot] = order[nmo - i - 1];
-            order2.push_back(i2);
-        }
+        } else if (algorithm_ == "JACOBI") {
+            // => Random Permutation <= //
 
-        // => Jacobi sweep <= //
-
-        for (int i2 = 0; i2 < nmo - 1; i2++) {
-            for (int j2 = i2 + 1; j2 < nmo; j2++) {
-                int i = order2[i2];
-                int j = order2[j2];
-
-                // > Compute the rotation < //
-
-                // H elements
-                a = 0.0;
-                b = 0.0;
-                c = 0.0;
-                for (int A = 0; A < nA; A++) {
-                    int nm = Astarts[A + 1] - Astarts[A];
-                    int off = Astarts[A];
-                    Aii = C_DDOT(nm, &LSp[off][i], nmo, &Lp[off][i], nmo);
-                    Ajj = C_DDOT(nm, &LSp[off][j], nmo, &Lp[off][j], nmo);
-                    Aij = 0.5 * C_DDOT(nm, &LSp[off][i], nmo, &Lp[off][j], nmo) +
-                          0.5 * C_DDOT(nm, &LSp[off][j], nmo, &Lp[off][i], nmo);
-
-                    Ad = (Aii - Ajj);
-                    Ao = 2.0 * Aij;
-                    a += Ad * Ad;
-                    b += Ao * Ao;
-                    c += Ad * Ao;
-                }
+            std::vector<int> order2 = random_order(nmo);
 
-                // Theta
-                Hd = a - b;
-                Ho = 2.0 * c;
-                theta = 0.5 * atan2(Ho, Hd + sqrt(Hd * Hd + Ho * Ho));
-
-                // Check for trivial (maximal) rotation, which might be better with theta = pi/4
-                if (std::fabs(theta) < 1.0E-8) {
-                    double O0 = 0.0;
-                    double O1 = 0.0;
-                    ;
-                    for (int A = 0; A < nA; A++) {
-                        int nm = Astarts[A + 1] - Astarts[A];
-                        int off = Astarts[A];
-                        Aii = C_DDOT(nm, &LSp[off][i], nmo, &Lp[off][i], nmo);
-                        Ajj = C_DDOT(nm, &LSp[off][j], nmo, &Lp[off][j], nmo);
-                        Aij = 0.5 * C_DDOT(nm, &LSp[off][i], nmo, &Lp[off][j], nmo) +
-                              0.5 * C_DDOT(nm, &LSp[off][j], nmo, &Lp[off][i], nmo);
-                        O0 += Aij * Aij;
-                        O1 += 0.25 * (Ajj - Aii) * (Ajj - Aii);
-                    }
-                    if (O1 < O0) {
-                        theta = M_PI / 4.0;
-                        if (debug_ > 3) {
-                            outfile->Printf("@Break\n");
-                        }
-                    }
-                }
+            // => Jacobi sweep <= //
+
+            for (int i2 = 0; i2 < nmo - 1; i2++) {
+                for (int j2 = i2 + 1; j2 < nmo; j2++) {
+                    int i = order2[i2];
+                    int j = order2[j2];
+
+                    // > Compute the rotation < //
+
+                    double theta = pm_angle(LSp, Lp, Astarts, nmo, i, j, debug_);
+                    double cc = cos(theta);
+                    double ss = sin(theta);
 
-                // Givens rotation
-                cc = cos(theta);
-                ss = sin(theta);
+                    // > Apply the rotation < //
 
-                if (debug_ > 3) {
-                    outfile->Printf("@Rotation, i = %4d, j = %4d, Theta = %24.16E\n", i, j, theta);
-                    outfile->Printf("@Info, a = %24.16E, b = %24.16E, c = %24.16E\n", a, b, c);
+                    // columns of LS and L
+                    C_DROT(nso, &LSp[0][i], nmo, &LSp[0][j], nmo, cc, ss);
+                    C_DROT(nso, &Lp[0][i], nmo, &Lp[0][j], nmo, cc, ss);
+
+                    // Q
+                    C_DROT(nmo, Up[i], 1, Up[j], 1, cc, ss);
                 }
+            }
+
+        } else {
+            // => Round-robin Jacobi sweep <= //
 
-                // > Apply the rotation < //
+            std::vector<std::vector<std::pair<int, int> > > rounds = tournament_rounds(random_order(nmo));
 
-                // columns of LS and L
-                C_DROT(nso, &LSp[0][i], nmo, &LSp[0][j], nmo, cc, ss);
-                C_DROT(nso, &Lp[0][i], nmo, &Lp[0][j], nmo, cc, ss);
+            for (size_t r = 0; r < rounds.size(); r++) {
+                const std::vector<std::pair<int, int> >& pairs = rounds[r];
+                int npair = pairs.size();
+                std::vector<double> cc(npair);
+                std::vector<double> ss(npair);
 
-                // Q
-                C_DROT(nmo, Up[i], 1, Up[j], 1, cc, ss);
+                // > Compute the rotations (the 2x2 blocks of disjoint pairs are independent) < //
+
+#pragma omp parallel for schedule(dynamic)
+                for (int p = 0; p < npair; p++) {
+                    double theta = pm_angle(LSp, Lp, Astarts, nmo, pairs[p].first, pairs[p].second, 0);
+                    cc[p] = cos(theta);
+                    ss[p] = sin(theta);
+                }
+
+                // > Apply the rotations: columns of LS and L, rows of Q < //
+
+#pragma omp parallel for schedule(static)
+                for (int p = 0; p < npair; p++) {
+                    int i = pairs[p].first;
+                    int j = pairs[p].second;
+                    C_DROT(nso, &LSp[0][i], nmo, &LSp[0][j], nmo, cc[p], ss[p]);
+                    C_DROT(nso, &Lp[0][i], nmo, &Lp[0][j], nmo, cc[p], ss[p]);
+                    C_DROT(nmo, Up[i], 1, Up[j], 1, cc[p], ss[p]);
+                }
             }
         }
 
@@ -539,6 +946,9 @@ void PMLocalizer::localize() {
             converged_ = true;
             break;
         }
+
+        // Sweeps are cheap far from the maximum, Newton steps are cheap close to it
+        if (algorithm_ == "NEWTON" && !newton_failed && conv < 1.0E-4) newton = true;
     }
 
     outfile->Printf("\n");
@@ -31,6 +31,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 #include "psi4/pragma.h"
 
@@ -56,6 +57,11 @@ class PSI_API Localizer {
     double convergence_;
     /// Maximum number of iterations
     int maxiter_;
+    /// Rotation algorithm: JACOBI (randomized serial sweeps), PARALLEL_JACOBI (round-robin sweeps of
+    /// disjoint pairs), or NEWTON (parallel sweeps, then trust-region Newton)
+    std::string algorithm_;
+    /// Trust radius for the NEWTON algorithm
+    double trust_radius_;
 
     /// Primary orbital basis set
     std::shared_ptr<BasisSet> primary_;
@@ -121,6 +127,9 @@ class PSI_API Localizer {
     void set_convergence(double convergence) { convergence_ = convergence; }
 
     void set_maxiter(int maxiter) { maxiter_ = maxiter; }
+
+    /// JACOBI, PARALLEL_JACOBI or NEWTON (case-insensitive); throws on anything else
+    void set_algorithm(const std::string &algorithm);
 };
 
 class PSI_API BoysLocalizer : public Localizer {
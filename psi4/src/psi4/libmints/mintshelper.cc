@@ -40,6 +40,7 @@
 #include "psi4/libmints/petitelist.h"
 #include "psi4/libmints/factory.h"
 #include "psi4/libmints/3coverlap.h"
+#include "psi4/libmints/multioperator.h"
 #include "psi4/libqt/qt.h"
 #include "psi4/libmints/sointegral_onebody.h"
 #include "psi4/psi4-dec.h"
@@ -50,9 +51,12 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cmath>
+#include <algorithm>
 #include <iostream>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <unordered_map>
 #include <utility>
@@ -117,6 +121,109 @@ class PSI_API IWLWriter {
     size_t count() const { return count_; }
 };
 
+/**
+ * Thread-private IWL buffer for SO TEIs computed by several threads at once.
+ * Each full buffer is appended to the shared IWL file under a lock, so the
+ * file is still a plain sequence of IWL buffers; only the order of the
+ * integrals differs from a serial run.
+ **/
+class IWLThreadWriter {
+    IWL &writeto_;
+    std::mutex &lock_;
+    size_t count_;
+    int current_buffer_count_;
+    int ints_per_buffer_;
+
+    std::vector<Label> labels_;
+    std::vector<Value> values_;
+
+   public:
+    IWLThreadWriter(IWL &writeto, std::mutex &lock)
+        : writeto_(writeto),
+          lock_(lock),
+          count_(0),
+          current_buffer_count_(0),
+          ints_per_buffer_(writeto.ints_per_buffer()),
+          labels_(4 * writeto.ints_per_buffer(), 0),
+          values_(writeto.ints_per_buffer(), 0.0) {}
+
+    void operator()(int i, int j, int k, int l, int, int, int, int, int, int, int, int, double value) {
+        int current_label_position = 4 * current_buffer_count_;
+
+        labels_[current_label_position++] = i;
+        labels_[current_label_position++] = j;
+        labels_[current_label_position++] = k;
+        labels_[current_label_position] = l;
+        values_[current_buffer_count_++] = value;
+
+        count_++;
+
+        if (current_buffer_count_ == ints_per_buffer_) flush();
+    }
+
+    /// Append the buffer, if not empty, to the file.  Never marks it as the last buffer.
+    void flush() {
+        if (current_buffer_count_ == 0) return;
+
+        std::fill(labels_.begin() + 4 * current_buffer_count_, labels_.end(), 0);
+        std::fill(values_.begin() + current_buffer_count_, values_.end(), 0.0);
+
+        std::lock_guard<std::mutex> guard(lock_);
+        std::copy(labels_.begin(), labels_.end(), writeto_.labels());
+        std::copy(values_.begin(), values_.end(), writeto_.values());
+        writeto_.last_buffer() = 0;
+        writeto_.buffer_count() = current_buffer_count_;
+        writeto_.put();
+        current_buffer_count_ = 0;
+    }
+
+    size_t count() const { return count_; }
+};
+
+/**
+ * Computes all unique SO integrals of eri and writes them to writeto, which
+ * the caller still has to flush with lastbuf set.  With one thread this is
+ * the plain SOShellCombinationsIterator loop.  With more, bra shell pairs
+ * are handed out dynamically and each thread fills its own IWLThreadWriter.
+ * Returns the number of integrals written.
+ **/
+static size_t compute_so_tei(TwoBodySOInt &eri, std::shared_ptr<SOBasisSet> sobasis, IWL &writeto, int nthread) {
+    if (nthread == 1) {
+        IWLWriter writer(writeto);
+        SOShellCombinationsIterator shellIter(sobasis, sobasis, sobasis, sobasis);
+        for (shellIter.first(); shellIter.is_done() == false; shellIter.next()) eri.compute_shell(shellIter, writer);
+        return writer.count();
+    }
+
+    // Unique quartets (PQ|RS) with P >= Q, R >= S and PQ >= RS
+    std::vector<std::pair<int, int>> pairs;
+    for (int P = 0; P < sobasis->nshell(); ++P)
+        for (int Q = 0; Q <= P; ++Q) pairs.push_back(std::make_pair(P, Q));
+    size_t npairs = pairs.size();
+
+    std::mutex lock;
+    std::vector<std::unique_ptr<IWLThreadWriter>> writers;
+    for (int t = 0; t < nthread; ++t) writers.emplace_back(new IWLThreadWriter(writeto, lock));
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthread)
+    for (size_t PQ = 0; PQ < npairs; ++PQ) {
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+        IWLThreadWriter &writer = *writers[thread];
+        for (size_t RS = 0; RS <= PQ; ++RS)
+            eri.compute_shell(pairs[PQ].first, pairs[PQ].second, pairs[RS].first, pairs[RS].second, writer);
+    }
+
+    size_t count = 0;
+    for (int t = 0; t < nthread; ++t) {
+        writers[t]->flush();
+        count += writers[t]->count();
+    }
+    return count;
+}
+
 MintsHelper::MintsHelper(std::shared_ptr<BasisSet> basis, Options &options, int print)
     : options_(options), print_(print) {
     init_helper(basis);
@@ -240,17 +347,13 @@ void MintsHelper::integrals() {
 
     // Open the IWL buffer where we will store the integrals.
     IWL ERIOUT(psio_.get(), PSIF_SO_TEI, cutoff_, 0, 0);
-    IWLWriter writer(ERIOUT);
 
     // Let the user know what we're doing.
     if (print_) {
         outfile->Printf("      Computing two-electron integrals...");
     }
 
-    SOShellCombinationsIterator shellIter(sobasis_, sobasis_, sobasis_, sobasis_);
-    for (shellIter.first(); shellIter.is_done() == false; shellIter.next()) {
-        eri->compute_shell(shellIter, writer);
-    }
+    size_t count = compute_so_tei(*eri, sobasis_, ERIOUT, nthread_);
 
     // Flush out buffers.
     ERIOUT.flush(1);
@@ -264,7 +367,7 @@ void MintsHelper::integrals() {
         outfile->Printf(
             "      Computed %lu non-zero two-electron integrals.\n"
             "        Stored in file %d.\n\n",
-            writer.count(), PSIF_SO_TEI);
+            count, PSIF_SO_TEI);
     }
 }
 
@@ -272,7 +375,6 @@ void MintsHelper::integrals_erf(double w) {
     double omega = (w == -1.0 ? options_.get_double("OMEGA_ERF") : w);
 
     IWL ERIOUT(psio_.get(), PSIF_SO_ERF_TEI, cutoff_, 0, 0);
-    IWLWriter writer(ERIOUT);
 
     // Get ERI object
     std::vector<std::shared_ptr<TwoBodyAOInt>> tb;
@@ -282,8 +384,7 @@ void MintsHelper::integrals_erf(double w) {
     // Let the user know what we're doing.
     outfile->Printf("      Computing non-zero ERF integrals (omega = %.3f)...", omega);
 
-    SOShellCombinationsIterator shellIter(sobasis_, sobasis_, sobasis_, sobasis_);
-    for (shellIter.first(); shellIter.is_done() == false; shellIter.next()) erf->compute_shell(shellIter, writer);
+    size_t count = compute_so_tei(*erf, sobasis_, ERIOUT, nthread_);
 
     // Flush the buffers
     ERIOUT.flush(1);
@@ -296,14 +397,13 @@ void MintsHelper::integrals_erf(double w) {
     outfile->Printf(
         "      Computed %lu non-zero ERF integrals.\n"
         "        Stored in file %d.\n\n",
-        writer.count(), PSIF_SO_ERF_TEI);
+        count, PSIF_SO_ERF_TEI);
 }
 
 void MintsHelper::integrals_erfc(double w) {
     double omega = (w == -1.0 ? options_.get_double("OMEGA_ERF") : w);
 
     IWL ERIOUT(psio_.get(), PSIF_SO_ERFC_TEI, cutoff_, 0, 0);
-    IWLWriter writer(ERIOUT);
 
     // Get ERI object
     std::vector<std::shared_ptr<TwoBodyAOInt>> tb;
@@ -314,8 +414,7 @@ void MintsHelper::integrals_erfc(double w) {
     // Let the user know what we're doing.
     outfile->Printf("      Computing non-zero ERFComplement integrals...");
 
-    SOShellCombinationsIterator shellIter(sobasis_, sobasis_, sobasis_, sobasis_);
-    for (shellIter.first(); shellIter.is_done() == false; shellIter.next()) erf->compute_shell(shellIter, writer);
+    size_t count = compute_so_tei(*erf, sobasis_, ERIOUT, nthread_);
 
     // Flush the buffers
     ERIOUT.flush(1);
@@ -328,7 +427,7 @@ void MintsHelper::integrals_erfc(double w) {
     outfile->Printf(
         "      Computed %lu non-zero ERFComplement integrals.\n"
         "        Stored in file %d.\n\n",
-        writer.count(), PSIF_SO_ERFC_TEI);
+        count, PSIF_SO_ERFC_TEI);
 }
 
 void MintsHelper::one_electron_integrals() {
@@ -411,10 +510,21 @@ void MintsHelper::integral_hessians() {
 }
 
 void MintsHelper::one_body_ao_computer(std::vector<std::shared_ptr<OneBodyAOInt>> ints, SharedMatrix out, bool symm) {
+    std::vector<SharedMatrix> outs{out};
+    one_body_ao_computer(ints, outs, symm);
+}
+void MintsHelper::one_body_ao_computer(std::vector<std::shared_ptr<OneBodyAOInt>> ints, std::vector<SharedMatrix> &out,
+                                       bool symm) {
     // Grab basis info
     std::shared_ptr<BasisSet> bs1 = ints[0]->basis1();
     std::shared_ptr<BasisSet> bs2 = ints[0]->basis2();
 
+    // One output matrix per operator component
+    const size_t nchunk = ints[0]->nchunk();
+    if (out.size() != nchunk) {
+        throw PSIEXCEPTION("MintsHelper::one_body_ao_computer: number of matrices does not match the operator.");
+    }
+
     // Limit to the number of incoming onbody ints
     size_t nthread = nthread_;
     if (nthread > ints.size()) {
@@ -427,7 +537,10 @@ void MintsHelper::one_body_ao_computer(std::vector<std::shared_ptr<OneBodyAOInt>
         ints_buff[thread] = ints[thread]->buffer();
     }
 
-    double **outp = out->pointer();
+    std::vector<double **> outp(nchunk);
+    for (size_t chunk = 0; chunk < nchunk; chunk++) {
+        outp[chunk] = out[chunk]->pointer();
+    }
 
 // Loop it
 #pragma omp parallel for schedule(guided) num_threads(nthread)
@@ -449,9 +562,11 @@ void MintsHelper::one_body_ao_computer(std::vector<std::shared_ptr<OneBodyAOInt>
                 ints[rank]->compute_shell(MU, NU);
 
                 size_t index = 0;
-                for (size_t mu = index_mu; mu < (index_mu + num_mu); ++mu) {
-                    for (size_t nu = index_nu; nu < (index_nu + num_nu); ++nu) {
-                        outp[nu][mu] = outp[mu][nu] = ints_buff[rank][index++];
+                for (size_t chunk = 0; chunk < nchunk; ++chunk) {
+                    for (size_t mu = index_mu; mu < (index_mu + num_mu); ++mu) {
+                        for (size_t nu = index_nu; nu < (index_nu + num_nu); ++nu) {
+                            outp[chunk][nu][mu] = outp[chunk][mu][nu] = ints_buff[rank][index++];
+                        }
                     }
                 }
             }  // End NU
@@ -465,10 +580,12 @@ void MintsHelper::one_body_ao_computer(std::vector<std::shared_ptr<OneBodyAOInt>
                 ints[rank]->compute_shell(MU, NU);
 
                 size_t index = 0;
-                for (size_t mu = index_mu; mu < (index_mu + num_mu); ++mu) {
-                    for (size_t nu = index_nu; nu < (index_nu + num_nu); ++nu) {
-                        // printf("%zu %zu | %zu %zu | %lf\n", MU, NU, mu, nu, ints_buff[rank][index]);
-                        outp[mu][nu] = ints_buff[rank][index++];
+                for (size_t chunk = 0; chunk < nchunk; ++chunk) {
+                    for (size_t mu = index_mu; mu < (index_mu + num_mu); ++mu) {
+                        for (size_t nu = index_nu; nu < (index_nu + num_nu); ++nu) {
+                            // printf("%zu %zu | %zu %zu | %lf\n", MU, NU, mu, nu, ints_buff[rank][index]);
+                            outp[chunk][mu][nu] = ints_buff[rank][index++];
+                        }
                     }
                 }
             }  // End NU
@@ -1415,6 +1532,63 @@ std::vector<SharedMatrix> MintsHelper::ao_angular_momentum() {
     return angmom;
 }
 
+std::vector<SharedMatrix> MintsHelper::ao_operators(const std::vector<std::string> &operators,
+                                                    const std::vector<double> &origin) {
+    if (origin.size() != 3) throw PSIEXCEPTION("Origin argument must have length 3.");
+    Vector3 v3origin(origin[0], origin[1], origin[2]);
+
+    std::vector<std::shared_ptr<OneBodyAOInt>> ints_vec;
+    for (size_t i = 0; i < nthread_; i++) {
+        ints_vec.push_back(std::shared_ptr<OneBodyAOInt>(integral_->ao_operators(operators)));
+        ints_vec.back()->set_origin(v3origin);
+    }
+
+    // Label the multipole components by their Cartesian powers
+    std::vector<SharedMatrix> ints;
+    for (const std::string &name : operators) {
+        int order = MultiOperatorInt::multipole_order(name);
+        if (order == 0) {
+            ints.push_back(std::make_shared<Matrix>("AO " + name, basisset_->nbf(), basisset_->nbf()));
+            continue;
+        }
+        for (int ii = 0; ii <= order; ii++) {
+            int lx = order - ii;
+            for (int lz = 0; lz <= ii; lz++) {
+                int ly = ii - lz;
+                std::string label = "AO " + name + " " + std::string(lx, 'X') + std::string(ly, 'Y') +
+                                    std::string(lz, 'Z');
+                ints.push_back(std::make_shared<Matrix>(label, basisset_->nbf(), basisset_->nbf()));
+            }
+        }
+    }
+
+    one_body_ao_computer(ints_vec, ints, true);
+    return ints;
+}
+std::vector<SharedMatrix> MintsHelper::so_operators(const std::vector<std::string> &operators,
+                                                    const std::vector<double> &origin) {
+    std::vector<SharedMatrix> ao_ints = ao_operators(operators, origin);
+    if (factory_->nirrep() == 1) return ao_ints;
+
+    // Multipole components go to the irreps of their Cartesian powers
+    std::vector<SharedMatrix> ints;
+    size_t index = 0;
+    for (const std::string &name : operators) {
+        int order = MultiOperatorInt::multipole_order(name);
+        std::vector<SharedMatrix> so_ints;
+        if (order == 0) {
+            so_ints.push_back(factory_->create_shared_matrix("SO " + name));
+        } else {
+            OperatorSymmetry msymm(order, molecule_, integral_, factory_);
+            so_ints = msymm.create_matrices("SO " + name);
+        }
+        for (SharedMatrix so_int : so_ints) {
+            so_int->apply_symmetry(ao_ints[index++], petite_list()->aotoso());
+            ints.push_back(so_int);
+        }
+    }
+    return ints;
+}
 std::vector<SharedMatrix> MintsHelper::ao_dipole() {
     // Create a vector of matrices with the proper symmetry
     std::vector<SharedMatrix> dipole;
@@ -82,6 +82,8 @@ class PSI_API MintsHelper {
     void common_init();
 
     void one_body_ao_computer(std::vector<std::shared_ptr<OneBodyAOInt>> ints, SharedMatrix out, bool symm);
+    void one_body_ao_computer(std::vector<std::shared_ptr<OneBodyAOInt>> ints, std::vector<SharedMatrix>& out,
+                              bool symm);
     void grad_two_center_computer(std::vector<std::shared_ptr<OneBodyAOInt>> ints, SharedMatrix D, SharedMatrix out);
 
    public:
@@ -276,6 +278,20 @@ class PSI_API MintsHelper {
     /// Vector SO Traceless Quadrupole Integrals
     std::vector<SharedMatrix> so_traceless_quadrupole();
 
+    /**
+     * AO integrals of several one-electron operators, computed in one threaded
+     * pass that shares the recursion of each primitive pair (see MultiOperatorInt).
+     * Returns one matrix per component, in the order the operators are given.
+     * @param operators OVERLAP, KINETIC, POTENTIAL, DIPOLE, QUADRUPOLE, OCTUPOLE,
+     *        HEXADECAPOLE or MULTIPOLEn
+     * @param origin Origin of the multipoles
+     */
+    std::vector<SharedMatrix> ao_operators(const std::vector<std::string>& operators,
+                                           const std::vector<double>& origin = {0., 0., 0.});
+    /// SO counterpart of ao_operators, each component in its irrep
+    std::vector<SharedMatrix> so_operators(const std::vector<std::string>& operators,
+                                           const std::vector<double>& origin = {0., 0., 0.});
+
     /// Returns a CdSalcList object
     std::shared_ptr<CdSalcList> cdsalcs(int needed_irreps = 0xF, bool project_out_translations = true,
                                         bool project_out_rotations = true);
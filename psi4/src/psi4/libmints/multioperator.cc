@@ -0,0 +1,344 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#include "psi4/libmints/multioperator.h"
+#include "psi4/libmints/molecule.h"
+#include "psi4/libmints/basisset.h"
+#include "psi4/libmints/integral.h"
+#include "psi4/libmints/matrix.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+
+using namespace psi;
+
+int MultiOperatorInt::multipole_order(const std::string &name) {
+    if (name == "DIPOLE") return 1;
+    if (name == "QUADRUPOLE") return 2;
+    if (name == "OCTUPOLE") return 3;
+    if (name == "HEXADECAPOLE") return 4;
+    if (name.compare(0, 9, "MULTIPOLE") == 0 && name.size() > 9 &&
+        std::all_of(name.begin() + 9, name.end(), ::isdigit)) {
+        int order = std::stoi(name.substr(9));
+        if (order > 0) return order;
+    }
+    return 0;
+}
+
+int MultiOperatorInt::ncomponent(const std::string &name) {
+    if (name == "OVERLAP" || name == "KINETIC" || name == "POTENTIAL") return 1;
+    int order = multipole_order(name);
+    if (order) return INT_NCART(order);
+    throw PSIEXCEPTION("MultiOperatorInt: unknown operator " + name);
+}
+
+MultiOperatorInt::MultiOperatorInt(std::vector<SphericalTransform> &spherical_transforms,
+                                   std::shared_ptr<BasisSet> bs1, std::shared_ptr<BasisSet> bs2,
+                                   const std::vector<std::string> &operators)
+    : OneBodyAOInt(spherical_transforms, bs1, bs2, 0),
+      operators_(operators),
+      overlap_chunk_(-1),
+      kinetic_chunk_(-1),
+      potential_chunk_(-1),
+      max_order_(0) {
+    if (operators_.empty()) throw PSIEXCEPTION("MultiOperatorInt: no operators requested");
+
+    max_order_ = 0;
+    for (const auto &name : operators_) max_order_ = std::max(max_order_, multipole_order(name));
+    multipole_chunk_.assign(max_order_ + 1, -1);
+
+    // Lay the operators out in the buffer in the order they were requested
+    int chunk = 0;
+    for (const auto &name : operators_) {
+        int ncomp = ncomponent(name);
+        int order = multipole_order(name);
+        int *slot = (name == "OVERLAP" ? &overlap_chunk_
+                                       : name == "KINETIC" ? &kinetic_chunk_
+                                                           : name == "POTENTIAL" ? &potential_chunk_
+                                                                                 : &multipole_chunk_[order]);
+        if (*slot != -1) throw PSIEXCEPTION("MultiOperatorInt: operator " + name + " requested twice");
+        *slot = chunk;
+        ncomponents_.push_back(ncomp);
+        chunk += ncomp;
+    }
+    set_chunks(chunk);
+
+    int maxam1 = bs1_->max_am();
+    int maxam2 = bs2_->max_am();
+
+    // The kinetic energy needs one extra quantum on both centers, the
+    // order-k moments k extra quanta on center 1
+    if (overlap_chunk_ != -1 || kinetic_chunk_ != -1 || max_order_) {
+        int extra1 = std::max(max_order_, kinetic_chunk_ != -1 ? 1 : 0);
+        int extra2 = (kinetic_chunk_ != -1 ? 1 : 0);
+        overlap_recur_ =
+            std::unique_ptr<ObaraSaikaTwoCenterRecursion>(new ObaraSaikaTwoCenterRecursion(maxam1 + extra1, maxam2 + extra2));
+    }
+
+    if (max_order_) {
+        size_t nmoment = (maxam1 + 1) * (maxam2 + 1) * (max_order_ + 1);
+        mx_.resize(nmoment);
+        my_.resize(nmoment);
+        mz_.resize(nmoment);
+        binomial_.assign(max_order_ + 1, std::vector<double>(max_order_ + 1, 0.0));
+        for (int k = 0; k <= max_order_; ++k) {
+            binomial_[k][0] = 1.0;
+            for (int i = 1; i <= k; ++i) binomial_[k][i] = binomial_[k][i - 1] * (k - i + 1) / i;
+        }
+    }
+
+    if (potential_chunk_ != -1) {
+        potential_recur_ = std::unique_ptr<ObaraSaikaTwoCenterVIRecursion>(
+            new ObaraSaikaTwoCenterVIRecursion(maxam1 + 1, maxam2 + 1));
+
+        std::shared_ptr<Molecule> mol = bs1_->molecule();
+        Zxyz_ = std::make_shared<Matrix>("Partial Charge Field (Z,x,y,z)", mol->natom(), 4);
+        double **Zxyzp = Zxyz_->pointer();
+        for (int A = 0; A < mol->natom(); A++) {
+            Zxyzp[A][0] = (double)mol->Z(A);
+            Zxyzp[A][1] = mol->x(A);
+            Zxyzp[A][2] = mol->y(A);
+            Zxyzp[A][3] = mol->z(A);
+        }
+    }
+
+    buffer_ = new double[nchunk_ * INT_NCART(maxam1) * INT_NCART(maxam2)];
+}
+
+MultiOperatorInt::~MultiOperatorInt() { delete[] buffer_; }
+
+// The engine only supports segmented basis sets
+void MultiOperatorInt::compute_pair(const GaussianShell &s1, const GaussianShell &s2) {
+    int am1 = s1.am();
+    int am2 = s2.am();
+    int nprim1 = s1.nprimitive();
+    int nprim2 = s2.nprimitive();
+
+    // The number of bf components in each shell pair
+    int stride = INT_NCART(am1) * INT_NCART(am2);
+
+    memset(buffer_, 0, nchunk_ * stride * sizeof(double));
+
+    double A[3], B[3];
+    A[0] = s1.center()[0];
+    A[1] = s1.center()[1];
+    A[2] = s1.center()[2];
+    B[0] = s2.center()[0];
+    B[1] = s2.center()[1];
+    B[2] = s2.center()[2];
+
+    // compute intermediates
+    double AB2 = 0.0;
+    AB2 += (A[0] - B[0]) * (A[0] - B[0]);
+    AB2 += (A[1] - B[1]) * (A[1] - B[1]);
+    AB2 += (A[2] - B[2]) * (A[2] - B[2]);
+
+    int extra1 = std::max(max_order_, kinetic_chunk_ != -1 ? 1 : 0);
+    int extra2 = (kinetic_chunk_ != -1 ? 1 : 0);
+    int nmoment = max_order_ + 1;
+
+    // Potential recursion indexing
+    int izm = 1;
+    int iym = am1 + 1;
+    int ixm = iym * iym;
+    int jzm = 1;
+    int jym = am2 + 1;
+    int jxm = jym * jym;
+
+    for (int p1 = 0; p1 < nprim1; ++p1) {
+        double a1 = s1.exp(p1);
+        double c1 = s1.coef(p1);
+        for (int p2 = 0; p2 < nprim2; ++p2) {
+            double a2 = s2.exp(p2);
+            double c2 = s2.coef(p2);
+            double gamma = a1 + a2;
+            double oog = 1.0 / gamma;
+
+            double PA[3], PB[3];
+            double P[3];
+
+            P[0] = (a1 * A[0] + a2 * B[0]) * oog;
+            P[1] = (a1 * A[1] + a2 * B[1]) * oog;
+            P[2] = (a1 * A[2] + a2 * B[2]) * oog;
+            PA[0] = P[0] - A[0];
+            PA[1] = P[1] - A[1];
+            PA[2] = P[2] - A[2];
+            PB[0] = P[0] - B[0];
+            PB[1] = P[1] - B[1];
+            PB[2] = P[2] - B[2];
+
+            double over_pf = exp(-a1 * a2 * AB2 * oog) * sqrt(M_PI * oog) * M_PI * oog * c1 * c2;
+
+            // => Potential, one recursion per charge <= //
+
+            if (potential_chunk_ != -1) {
+                double ***vi = potential_recur_->vi();
+                double **Zxyzp = Zxyz_->pointer();
+                int ncharge = Zxyz_->rowspi()[0];
+                double *V = buffer_ + potential_chunk_ * stride;
+
+                for (int atom = 0; atom < ncharge; ++atom) {
+                    double PC[3];
+
+                    double Z = Zxyzp[atom][0];
+
+                    PC[0] = P[0] - Zxyzp[atom][1];
+                    PC[1] = P[1] - Zxyzp[atom][2];
+                    PC[2] = P[2] - Zxyzp[atom][3];
+
+                    potential_recur_->compute(PA, PB, PC, gamma, am1, am2);
+
+                    int ao12 = 0;
+                    for (int ii = 0; ii <= am1; ii++) {
+                        int l1 = am1 - ii;
+                        for (int jj = 0; jj <= ii; jj++) {
+                            int m1 = ii - jj;
+                            int n1 = jj;
+                            for (int kk = 0; kk <= am2; kk++) {
+                                int l2 = am2 - kk;
+                                for (int ll = 0; ll <= kk; ll++) {
+                                    int m2 = kk - ll;
+                                    int n2 = ll;
+
+                                    int iind = l1 * ixm + m1 * iym + n1 * izm;
+                                    int jind = l2 * jxm + m2 * jym + n2 * jzm;
+
+                                    V[ao12++] += -vi[iind][jind][0] * over_pf * Z;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (!overlap_recur_) continue;
+
+            // => Overlap-type operators, one shared recursion <= //
+
+            overlap_recur_->compute(PA, PB, gamma, am1 + extra1, am2 + extra2);
+            double **x = overlap_recur_->x();
+            double **y = overlap_recur_->y();
+            double **z = overlap_recur_->z();
+
+            // (x - O_x)^k = sum_i binom(k, i) (x - A_x)^i (A_x - O_x)^(k-i)
+            if (max_order_) {
+                double AO[3] = {A[0] - origin_[0], A[1] - origin_[1], A[2] - origin_[2]};
+                for (int l1 = 0; l1 <= am1; l1++) {
+                    for (int l2 = 0; l2 <= am2; l2++) {
+                        double *mx = &mx_[(l1 * (am2 + 1) + l2) * nmoment];
+                        double *my = &my_[(l1 * (am2 + 1) + l2) * nmoment];
+                        double *mz = &mz_[(l1 * (am2 + 1) + l2) * nmoment];
+                        for (int k = 0; k <= max_order_; k++) {
+                            double sx = 0.0, sy = 0.0, sz = 0.0;
+                            double px = 1.0, py = 1.0, pz = 1.0;
+                            for (int i = k; i >= 0; i--) {
+                                sx += binomial_[k][i] * x[l1 + i][l2] * px;
+                                sy += binomial_[k][i] * y[l1 + i][l2] * py;
+                                sz += binomial_[k][i] * z[l1 + i][l2] * pz;
+                                px *= AO[0];
+                                py *= AO[1];
+                                pz *= AO[2];
+                            }
+                            mx[k] = sx;
+                            my[k] = sy;
+                            mz[k] = sz;
+                        }
+                    }
+                }
+            }
+
+            int ao12 = 0;
+            for (int ii = 0; ii <= am1; ii++) {
+                int l1 = am1 - ii;
+                for (int jj = 0; jj <= ii; jj++) {
+                    int m1 = ii - jj;
+                    int n1 = jj;
+                    /*--- create all am components of sj ---*/
+                    for (int kk = 0; kk <= am2; kk++) {
+                        int l2 = am2 - kk;
+                        for (int ll = 0; ll <= kk; ll++) {
+                            int m2 = kk - ll;
+                            int n2 = ll;
+
+                            if (overlap_chunk_ != -1) {
+                                buffer_[overlap_chunk_ * stride + ao12] += over_pf * x[l1][l2] * y[m1][m2] * z[n1][n2];
+                            }
+
+                            if (kinetic_chunk_ != -1) {
+                                double I1, I2, I3, I4;
+
+                                I1 = (l1 == 0 || l2 == 0) ? 0.0 : x[l1 - 1][l2 - 1] * y[m1][m2] * z[n1][n2] * over_pf;
+                                I2 = x[l1 + 1][l2 + 1] * y[m1][m2] * z[n1][n2] * over_pf;
+                                I3 = (l2 == 0) ? 0.0 : x[l1 + 1][l2 - 1] * y[m1][m2] * z[n1][n2] * over_pf;
+                                I4 = (l1 == 0) ? 0.0 : x[l1 - 1][l2 + 1] * y[m1][m2] * z[n1][n2] * over_pf;
+                                double Ix = 0.5 * l1 * l2 * I1 + 2.0 * a1 * a2 * I2 - a1 * l2 * I3 - l1 * a2 * I4;
+
+                                I1 = (m1 == 0 || m2 == 0) ? 0.0 : x[l1][l2] * y[m1 - 1][m2 - 1] * z[n1][n2] * over_pf;
+                                I2 = x[l1][l2] * y[m1 + 1][m2 + 1] * z[n1][n2] * over_pf;
+                                I3 = (m2 == 0) ? 0.0 : x[l1][l2] * y[m1 + 1][m2 - 1] * z[n1][n2] * over_pf;
+                                I4 = (m1 == 0) ? 0.0 : x[l1][l2] * y[m1 - 1][m2 + 1] * z[n1][n2] * over_pf;
+                                double Iy = 0.5 * m1 * m2 * I1 + 2.0 * a1 * a2 * I2 - a1 * m2 * I3 - m1 * a2 * I4;
+
+                                I1 = (n1 == 0 || n2 == 0) ? 0.0 : x[l1][l2] * y[m1][m2] * z[n1 - 1][n2 - 1] * over_pf;
+                                I2 = x[l1][l2] * y[m1][m2] * z[n1 + 1][n2 + 1] * over_pf;
+                                I3 = (n2 == 0) ? 0.0 : x[l1][l2] * y[m1][m2] * z[n1 + 1][n2 - 1] * over_pf;
+                                I4 = (n1 == 0) ? 0.0 : x[l1][l2] * y[m1][m2] * z[n1 - 1][n2 + 1] * over_pf;
+                                double Iz = 0.5 * n1 * n2 * I1 + 2.0 * a1 * a2 * I2 - a1 * n2 * I3 - n1 * a2 * I4;
+
+                                buffer_[kinetic_chunk_ * stride + ao12] += (Ix + Iy + Iz);
+                            }
+
+                            if (max_order_) {
+                                const double *mx = &mx_[(l1 * (am2 + 1) + l2) * nmoment];
+                                const double *my = &my_[(m1 * (am2 + 1) + m2) * nmoment];
+                                const double *mz = &mz_[(n1 * (am2 + 1) + n2) * nmoment];
+                                for (int l = 1; l <= max_order_; ++l) {
+                                    if (multipole_chunk_[l] == -1) continue;
+                                    int chunk = multipole_chunk_[l];
+                                    for (int iii = 0; iii <= l; iii++) {
+                                        int lx = l - iii;
+                                        for (int lz = 0; lz <= iii; lz++) {
+                                            int ly = iii - lz;
+                                            // Electrons have a negative charge
+                                            buffer_[chunk * stride + ao12] -= over_pf * mx[lx] * my[ly] * mz[lz];
+                                            ++chunk;
+                                        }
+                                    }
+                                }
+                            }
+
+                            ao12++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#ifndef _psi_src_lib_libmints_multioperator_h_
+#define _psi_src_lib_libmints_multioperator_h_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "typedefs.h"
+#include "psi4/libmints/onebody.h"
+#include "psi4/libmints/osrecur.h"
+
+namespace psi {
+
+/*! \ingroup MINTS
+ *  \class MultiOperatorInt
+ *  \brief Computes several one-electron operators in a single pass over the primitive pairs.
+ *
+ * Recognized operators are OVERLAP, KINETIC, POTENTIAL, DIPOLE, QUADRUPOLE,
+ * OCTUPOLE, HEXADECAPOLE and MULTIPOLEn (all Cartesian components of order n).
+ * Their components are stored one after the other in the buffer, in the
+ * order the operators were requested. Each operator follows the convention
+ * of its own integral class: the multipoles carry the electron charge and are
+ * taken about origin(), and the potential uses the nuclear charges of basis1's
+ * molecule.
+ *
+ * Overlap, kinetic and multipole integrals all come from the same
+ * one-dimensional Obara-Saika overlap tables, which are computed once per
+ * primitive pair. The potential integrals share the primitive pair data.
+ *
+ * Use an IntegralFactory to create this object. */
+class MultiOperatorInt : public OneBodyAOInt {
+    //! Requested operators and their number of components
+    std::vector<std::string> operators_;
+    std::vector<int> ncomponents_;
+
+    //! Buffer chunk of each operator, -1 if not requested
+    int overlap_chunk_;
+    int kinetic_chunk_;
+    int potential_chunk_;
+    //! First buffer chunk of the multipoles of each order, -1 if not requested
+    std::vector<int> multipole_chunk_;
+    //! Highest multipole order requested
+    int max_order_;
+
+    //! Obara and Saika recursion objects
+    std::unique_ptr<ObaraSaikaTwoCenterRecursion> overlap_recur_;
+    std::unique_ptr<ObaraSaikaTwoCenterVIRecursion> potential_recur_;
+
+    //! Moments (r - origin)^k of the one-dimensional overlaps, per direction
+    std::vector<double> mx_, my_, mz_;
+    //! Binomial coefficients up to max_order_
+    std::vector<std::vector<double>> binomial_;
+
+    //! Charges (Z, x, y, z) for the potential
+    SharedMatrix Zxyz_;
+
+    //! Computes all requested integrals between two gaussian shells.
+    void compute_pair(const GaussianShell &, const GaussianShell &) override;
+
+   public:
+    //! Constructor. Do not call directly. Use an IntegralFactory.
+    MultiOperatorInt(std::vector<SphericalTransform> &, std::shared_ptr<BasisSet>, std::shared_ptr<BasisSet>,
+                     const std::vector<std::string> &operators);
+    //! Virtual destructor
+    ~MultiOperatorInt() override;
+
+    //! The requested operators
+    const std::vector<std::string> &operators() const { return operators_; }
+    //! Number of components of each requested operator
+    const std::vector<int> &ncomponents() const { return ncomponents_; }
+    //! Number of components of the operator called name (DIPOLE = 3, ...)
+    static int ncomponent(const std::string &name);
+    //! Multipole order of the operator called name (DIPOLE = 1, ...), 0 for the others
+    static int multipole_order(const std::string &name);
+};
+
+}  // namespace psi
+#endif
@@ -30,12 +30,58 @@
 #include <stdexcept>
 #include "psi4/libciomr/libciomr.h"
 #include "psi4/libmints/integral.h"
+#include "psi4/libmints/fjt.h"
 #include "psi4/libmints/wavefunction.h"  // for df
 #include "psi4/libmints/osrecur.h"
 #include "psi4/libpsi4util/exception.h"
+#include "psi4/libpsi4util/process.h"
 
 using namespace psi;
 
+#define EPS 1.0e-17
+
+// Forms Fm(t), 0 <= m <= n, from the power series of A20 (OS 1986), one argument at a time
+static void boys_series(double *F, int n, double t) {
+    int i, m;
+    int m2;
+    double t2;
+    double num;
+    double sum;
+    double term1;
+    static double K = 1.0 / M_2_SQRTPI;
+    double et;
+
+    if (t > 20.0) {
+        t2 = 2 * t;
+        et = exp(-t);
+        t = sqrt(t);
+        F[0] = K * erf(t) / t;
+        for (m = 0; m <= n - 1; m++) {
+            F[m + 1] = ((2 * m + 1) * F[m] - et) / (t2);
+        }
+    } else {
+        et = exp(-t);
+        t2 = 2 * t;
+        m2 = 2 * n;
+        num = df[m2];
+        i = 0;
+        sum = 1.0 / (m2 + 1);
+        do {
+            i++;
+            num = num * t2;
+            term1 = num / df[m2 + 2 * i + 2];
+            sum += term1;
+        } while (std::fabs(term1) > EPS && i < MAX_FAC);
+        F[n] = sum * et;
+        for (m = n - 1; m >= 0; m--) {
+            F[m] = (t2 * F[m + 1] + et) / (2 * m + 1);
+        }
+    }
+}
+
+// Whether POTENTIAL_BOYS_FUNCTION selects boys_series() over Tabulated_Fjt
+static bool use_series_f() { return Process::environment.options.get_str("POTENTIAL_BOYS_FUNCTION") == "SERIES"; }
+
 double ***init_box(int a, int b, int c) {
     int i, j;
     double ***box;
@@ -165,7 +211,7 @@ void ObaraSaikaTwoCenterMIRecursion::compute(double PA[3], double PB[3], double
 
 ObaraSaikaTwoCenterMultipolePotentialRecursion::ObaraSaikaTwoCenterMultipolePotentialRecursion(int max_am1, int max_am2,
                                                                                                int max_k)
-    : max_am1_(max_am1), max_am2_(max_am2) {
+    : max_am1_(max_am1), max_am2_(max_am2), series_f_(use_series_f()) {
     if (max_am1 < 0)
         throw SanityCheckError("ERROR: ObaraSaikaTwoCenterMVIRecursion -- max_am1 must be nonnegative", __FILE__,
                                __LINE__);
@@ -236,44 +282,11 @@ ObaraSaikaTwoCenterMultipolePotentialRecursion::~ObaraSaikaTwoCenterMultipolePot
     }
 }
 
-#define EPS 1.0e-17
-
 void ObaraSaikaTwoCenterMultipolePotentialRecursion::calculate_f(double *F, int n, double t) {
-    int i, m;
-    int m2;
-    double t2;
-    double num;
-    double sum;
-    double term1;
-    static double K = 1.0 / M_2_SQRTPI;
-    double et;
-
-    if (t > 20.0) {
-        t2 = 2 * t;
-        et = exp(-t);
-        t = sqrt(t);
-        F[0] = K * erf(t) / t;
-        for (m = 0; m <= n - 1; m++) {
-            F[m + 1] = ((2 * m + 1) * F[m] - et) / (t2);
-        }
-    } else {
-        et = exp(-t);
-        t2 = 2 * t;
-        m2 = 2 * n;
-        num = df[m2];
-        i = 0;
-        sum = 1.0 / (m2 + 1);
-        do {
-            i++;
-            num = num * t2;
-            term1 = num / df[m2 + 2 * i + 2];
-            sum += term1;
-        } while (std::fabs(term1) > EPS && i < MAX_FAC);
-        F[n] = sum * et;
-        for (m = n - 1; m >= 0; m--) {
-            F[m] = (t2 * F[m + 1] + et) / (2 * m + 1);
-        }
-    }
+    if (series_f_)
+        boys_series(F, n, t);
+    else
+        Tabulated_Fjt::batch_values(n, 1, &t, F, 1);
 }
 
 void ObaraSaikaTwoCenterMultipolePotentialRecursion::compute(double PA[3], double PB[3], double PC[3], double zeta,
@@ -1396,7 +1409,7 @@ void ObaraSaikaTwoCenterRecursion::compute(double PA[3], double PB[3], double ga
 }
 
 ObaraSaikaTwoCenterVIRecursion::ObaraSaikaTwoCenterVIRecursion(int max_am1, int max_am2)
-    : max_am1_(max_am1), max_am2_(max_am2) {
+    : max_am1_(max_am1), max_am2_(max_am2), series_f_(use_series_f()) {
     if (max_am1 < 0)
         throw SanityCheckError("ERROR: ObaraSaikaTwoCenterVIRecursion -- max_am1 must be nonnegative", __FILE__,
                                __LINE__);
@@ -1408,51 +1421,35 @@ ObaraSaikaTwoCenterVIRecursion::ObaraSaikaTwoCenterVIRecursion(int max_am1, int
     size_ += 1;
     size_ = (size_ - 1) * size_ * (size_ + 1) + 1;
     vi_ = init_box(size_, size_, max_am1_ + max_am2_ + 1);
+    F_ = new double[max_m() + 1];
 }
 
-ObaraSaikaTwoCenterVIRecursion::~ObaraSaikaTwoCenterVIRecursion() { free_box(vi_, size_, size_); }
-
-#define EPS 1.0e-17
+ObaraSaikaTwoCenterVIRecursion::~ObaraSaikaTwoCenterVIRecursion() {
+    free_box(vi_, size_, size_);
+    delete[] F_;
+}
 
 void ObaraSaikaTwoCenterVIRecursion::calculate_f(double *F, int n, double t) {
-    int i, m;
-    int m2;
-    double t2;
-    double num;
-    double sum;
-    double term1;
-    static double K = 1.0 / M_2_SQRTPI;
-    double et;
-
-    if (t > 20.0) {
-        t2 = 2 * t;
-        et = exp(-t);
-        t = sqrt(t);
-        F[0] = K * erf(t) / t;
-        for (m = 0; m <= n - 1; m++) {
-            F[m + 1] = ((2 * m + 1) * F[m] - et) / (t2);
-        }
-    } else {
-        et = exp(-t);
-        t2 = 2 * t;
-        m2 = 2 * n;
-        num = df[m2];
-        i = 0;
-        sum = 1.0 / (m2 + 1);
-        do {
-            i++;
-            num = num * t2;
-            term1 = num / df[m2 + 2 * i + 2];
-            sum += term1;
-        } while (std::fabs(term1) > EPS && i < MAX_FAC);
-        F[n] = sum * et;
-        for (m = n - 1; m >= 0; m--) {
-            F[m] = (t2 * F[m + 1] + et) / (2 * m + 1);
-        }
-    }
+    if (series_f_)
+        boys_series(F, n, t);
+    else
+        Tabulated_Fjt::batch_values(n, 1, &t, F, 1);
 }
 
 void ObaraSaikaTwoCenterVIRecursion::compute(double PA[3], double PB[3], double PC[3], double zeta, int am1, int am2) {
+    int mmax = max_m();
+
+    // U from A21
+    double u = zeta * (PC[0] * PC[0] + PC[1] * PC[1] + PC[2] * PC[2]);
+
+    // Form Fm(U) from A20
+    calculate_f(F_, mmax, u);
+
+    compute_with_boys(PA, PB, PC, zeta, am1, am2, F_, 1);
+}
+
+void ObaraSaikaTwoCenterVIRecursion::compute_with_boys(double PA[3], double PB[3], double PC[3], double zeta, int am1,
+                                                       int am2, const double *F, size_t ldf) {
     int a, b, m;
     int azm = 1;
     int aym = am1 + 1;
@@ -1463,23 +1460,17 @@ void ObaraSaikaTwoCenterVIRecursion::compute(double PA[3], double PB[3], double
     int ax, ay, az, bx, by, bz;
     int aind, bind;
     double ooz = 1.0 / (2.0 * zeta);
-    int mmax = max_am1_ + max_am2_;
+    int mmax = max_m();
 
     // Prefactor from A20
     double tmp = sqrt(zeta) * M_2_SQRTPI;
-    // U from A21
-    double u = zeta * (PC[0] * PC[0] + PC[1] * PC[1] + PC[2] * PC[2]);
-    auto *F = new double[mmax + 1];
-
-    // Form Fm(U) from A20
-    calculate_f(F, mmax, u);
 
     // Think we're having problems with values being left over.
     // zero_box(vi_, size_, size_, mmax + 1);
 
     // Perform recursion in m for (a|A(0)|s) using A20
     for (m = 0; m <= mmax; ++m) {
-        vi_[0][0][m] = tmp * F[m];
+        vi_[0][0][m] = tmp * F[m * ldf];
     }
 
     // Perform recursion in b with a=0
@@ -1610,8 +1601,6 @@ void ObaraSaikaTwoCenterVIRecursion::compute(double PA[3], double PB[3], double
             }
         }
     }
-
-    delete[] F;
 }
 
 void ObaraSaikaTwoCenterVIRecursion::compute_erf(double PA[3], double PB[3], double PC[3], double zeta, int am1,
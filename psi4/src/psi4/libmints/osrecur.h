@@ -31,6 +31,8 @@
 
 #include "psi4/pragma.h"
 
+#include <cstddef>
+
 namespace psi {
 
 /*! \ingroup MINTS
@@ -107,6 +109,10 @@ class ObaraSaikaTwoCenterVIRecursion {
     int size_;
 
     double ***vi_;
+    // Scratch for Fm(U) in compute()
+    double *F_;
+    // Whether Fm(U) comes from the series (POTENTIAL_BOYS_FUNCTION SERIES) rather than Tabulated_Fjt
+    bool series_f_;
 
     // Forms Fm(U) from A20 (OS 1986)
     void calculate_f(double *F, int n, double t);
@@ -139,6 +145,14 @@ class ObaraSaikaTwoCenterVIRecursion {
 
     /// Computes the potential integral 3D matrix using the data provided.
     virtual void compute(double PA[3], double PB[3], double PC[3], double zeta, int am1, int am2);
+    /// Same as compute(), with the Boys function values F_m(U) given as F[m * ldf], 0 <= m <= max_m(),
+    /// so that they can be evaluated for many centers C at once with Tabulated_Fjt::batch_values().
+    void compute_with_boys(double PA[3], double PB[3], double PC[3], double zeta, int am1, int am2, const double *F,
+                           size_t ldf);
+    /// Highest order of the Boys function used by compute()
+    int max_m() const { return max_am1_ + max_am2_; }
+    /// Whether compute() evaluates the Boys function by series, so that batching it with Tabulated_Fjt must be skipped
+    bool series_f() const { return series_f_; }
     /// Computes the Ewald potential integral with modified zeta -> zetam 3D matrix using the data provided.
     virtual void compute_erf(double PA[3], double PB[3], double PC[3], double zeta, int am1, int am2, double zetam);
 };
@@ -296,6 +310,8 @@ class ObaraSaikaTwoCenterMultipolePotentialRecursion {
     double ***yyz_;
     double ***yzz_;
     double ***zzz_;
+    // Whether Fm(U) comes from the series (POTENTIAL_BOYS_FUNCTION SERIES) rather than Tabulated_Fjt
+    bool series_f_;
 
     // Forms Fm(U) from A20 (OS 1986)
     void calculate_f(double *F, int n, double t);
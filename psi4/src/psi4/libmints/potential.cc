@@ -29,6 +29,7 @@
 #include "psi4/libciomr/libciomr.h"
 #include "psi4/libmints/cdsalclist.h"
 #include "psi4/libmints/potential.h"
+#include "psi4/libmints/fjt.h"
 #include "psi4/libmints/integral.h"
 #include "psi4/libmints/basisset.h"
 #include "psi4/libmints/matrix.h"
@@ -130,6 +131,11 @@ void PotentialInt::compute_pair(const GaussianShell &s1, const GaussianShell &s2
     double **Zxyzp = Zxyz_->pointer();
     int ncharge = Zxyz_->rowspi()[0];
 
+    int mmax = potential_recur_->max_m();
+    bool batch_boys = !potential_recur_->series_f();
+    boys_T_.resize(ncharge);
+    boys_F_.resize((size_t)ncharge * (mmax + 1));
+
     for (int p1 = 0; p1 < nprim1; ++p1) {
         double a1 = s1.exp(p1);
         double c1 = s1.coef(p1);
@@ -154,6 +160,17 @@ void PotentialInt::compute_pair(const GaussianShell &s1, const GaussianShell &s2
 
             double over_pf = exp(-a1 * a2 * AB2 * oog) * sqrt(M_PI * oog) * M_PI * oog * c1 * c2;
 
+            // Boys function for all charges at once
+            if (batch_boys) {
+                for (int atom = 0; atom < ncharge; ++atom) {
+                    double PCx = P[0] - Zxyzp[atom][1];
+                    double PCy = P[1] - Zxyzp[atom][2];
+                    double PCz = P[2] - Zxyzp[atom][3];
+                    boys_T_[atom] = gamma * (PCx * PCx + PCy * PCy + PCz * PCz);
+                }
+                Tabulated_Fjt::batch_values(mmax, ncharge, boys_T_.data(), boys_F_.data(), ncharge);
+            }
+
             // Loop over atoms of basis set 1 (only works if bs1_ and bs2_ are on the same
             // molecule)
             for (int atom = 0; atom < ncharge; ++atom) {
@@ -166,7 +183,10 @@ void PotentialInt::compute_pair(const GaussianShell &s1, const GaussianShell &s2
                 PC[2] = P[2] - Zxyzp[atom][3];
 
                 // Do recursion
-                potential_recur_->compute(PA, PB, PC, gamma, am1, am2);
+                if (batch_boys)
+                    potential_recur_->compute_with_boys(PA, PB, PC, gamma, am1, am2, boys_F_.data() + atom, ncharge);
+                else
+                    potential_recur_->compute(PA, PB, PC, gamma, am1, am2);
 
                 ao12 = 0;
                 for (int ii = 0; ii <= am1; ii++) {
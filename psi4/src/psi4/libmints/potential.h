@@ -62,6 +62,9 @@ class PotentialInt : public OneBodyAOInt {
     /// Matrix of coordinates/charges of partial charges
     SharedMatrix Zxyz_;
 
+    /// Boys function arguments and values F_m(U) for all charges of a primitive pair
+    std::vector<double> boys_T_, boys_F_;
+
    public:
     /// Constructor. Assumes nuclear centers/charges as the potential
     PotentialInt(std::vector<SphericalTransform>&, std::shared_ptr<BasisSet>, std::shared_ptr<BasisSet>, int deriv = 0);
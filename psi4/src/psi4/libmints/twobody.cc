@@ -94,6 +94,14 @@ std::vector<ShellPairBlock> TwoBodyAOInt::get_blocks12() const { return blocks12
 
 std::vector<ShellPairBlock> TwoBodyAOInt::get_blocks34() const { return blocks34_; }
 
+bool TwoBodyAOInt::blocks_batched() const {
+    for (const auto &block : blocks12_)
+        if (block.size() > 1) return true;
+    for (const auto &block : blocks34_)
+        if (block.size() > 1) return true;
+    return false;
+}
+
 // Expected to be overridden by derived classes
 void TwoBodyAOInt::create_blocks() {
     // Default implementation : do no blocking.
@@ -161,6 +161,9 @@ class PSI_API TwoBodyAOInt {
     //! Get optimal blocks of shell pairs for centers 3 & 4
     std::vector<ShellPairBlock> get_blocks34() const;
 
+    //! Do any of the shell pair blocks hold more than one shell pair?
+    bool blocks_batched() const;
+
     /*! Compute integrals for two blocks
      *
      * The indices \p shellpair12 and \p shellpair34 refer to the indices
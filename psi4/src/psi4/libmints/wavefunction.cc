@@ -45,6 +45,7 @@
 #include "psi4/libmints/vector3.h"
 #include "psi4/libmints/sointegral_onebody.h"
 #include "psi4/libmints/corrtab.h"
+#include "psi4/libmints/checkpoint.h"
 #include "psi4/psi4-dec.h"
 #include "psi4/libpsi4util/libpsi4util.h"
 #include "psi4/libpsi4util/exception.h"
@@ -1426,3 +1427,62 @@ void Wavefunction::set_PCM(const std::shared_ptr<PCM> &pcm) {
 }
 
 std::shared_ptr<PCM> Wavefunction::get_PCM() const { return PCM_; }
+
+void Wavefunction::write_checkpoint(const std::string &filename, const std::map<std::string, std::string> &strings) const {
+    CheckpointWriter writer(filename);
+
+    writer.add_matrix("matrix/Ca", Ca_);
+    writer.add_matrix("matrix/Cb", Cb_);
+    writer.add_matrix("matrix/Da", Da_);
+    writer.add_matrix("matrix/Db", Db_);
+    writer.add_matrix("matrix/Fa", Fa_);
+    writer.add_matrix("matrix/Fb", Fb_);
+    writer.add_matrix("matrix/H", H_);
+    writer.add_matrix("matrix/S", S_);
+    writer.add_matrix("matrix/X", Lagrangian_);
+    writer.add_matrix("matrix/aotoso", AO2SO_);
+    writer.add_matrix("matrix/gradient", gradient_);
+    writer.add_matrix("matrix/hessian", hessian_);
+
+    writer.add_vector("vector/epsilon_a", epsilon_a_);
+    writer.add_vector("vector/epsilon_b", epsilon_b_);
+    writer.add_vector("vector/frequencies", frequencies_);
+
+    writer.add_dimension("dimension/doccpi", doccpi_);
+    writer.add_dimension("dimension/frzcpi", frzcpi_);
+    writer.add_dimension("dimension/frzvpi", frzvpi_);
+    writer.add_dimension("dimension/nalphapi", nalphapi_);
+    writer.add_dimension("dimension/nbetapi", nbetapi_);
+    writer.add_dimension("dimension/nmopi", nmopi_);
+    writer.add_dimension("dimension/nsopi", nsopi_);
+    writer.add_dimension("dimension/soccpi", soccpi_);
+
+    writer.add_int("int/nalpha", nalpha_);
+    writer.add_int("int/nbeta", nbeta_);
+    writer.add_int("int/nfrzc", nfrzc_);
+    writer.add_int("int/nirrep", nirrep_);
+    writer.add_int("int/nmo", nmo_);
+    writer.add_int("int/nso", nso_);
+    writer.add_int("int/print", print_);
+
+    writer.add_string("string/name", name_);
+    writer.add_string("string/basisname", basisset_->name());
+    for (const auto &item : strings) writer.add_string("string/" + item.first, item.second);
+
+    writer.add_int("boolean/PCM_enabled", PCM_enabled_);
+    writer.add_int("boolean/same_a_b_dens", same_a_b_dens_);
+    writer.add_int("boolean/same_a_b_orbs", same_a_b_orbs_);
+    writer.add_int("boolean/density_fitted", density_fitted_);
+    writer.add_int("boolean/basispuream", basisset_->has_puream());
+
+    writer.add_double("float/energy", energy_);
+    writer.add_double("float/efzc", efzc_);
+    writer.add_double("float/dipole_field_x", dipole_field_strength_[0]);
+    writer.add_double("float/dipole_field_y", dipole_field_strength_[1]);
+    writer.add_double("float/dipole_field_z", dipole_field_strength_[2]);
+
+    for (const auto &item : variables_) writer.add_double("floatvar/" + item.first, item.second);
+    for (const auto &item : arrays_) writer.add_matrix("matrixarr/" + item.first, item.second);
+
+    writer.write();
+}
@@ -703,6 +703,14 @@ class PSI_API Wavefunction : public std::enable_shared_from_this<Wavefunction> {
         "working")
     std::map<std::string, SharedMatrix> arrays();
 
+    /**
+     * Write the state of this wavefunction to a binary checkpoint file (see CheckpointFile).
+     * Records are named after the sections of the python Wavefunction.to_file dictionary,
+     * e.g. "matrix/Ca", "dimension/nalphapi", "floatvar/CURRENT ENERGY".
+     * @param strings Additional "string/<key>" records, e.g. the serialized molecule
+     */
+    void write_checkpoint(const std::string& filename, const std::map<std::string, std::string>& strings = {}) const;
+
     /// Set PCM object
     void set_PCM(const std::shared_ptr<PCM>& pcm);
     /// Get PCM object
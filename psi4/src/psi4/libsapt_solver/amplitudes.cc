@@ -29,6 +29,7 @@
 #include "sapt2.h"
 #include "sapt2p.h"
 #include "sapt2p3.h"
+#include "df_block_reader.h"
 #include "psi4/libciomr/libciomr.h"
 #include "psi4/libpsio/psio.hpp"
 #include "psi4/libpsio/psio.h"
@@ -301,19 +302,27 @@ void SAPT2::Y2_3(double **yAR, int intfile, const char *AAlabel, const char *RRl
     psio_->read_entry(ampfile, thetalabel, (char *)T_p_AR[0], sizeof(double) * aoccA * nvirA * (ndf_ + 3));
 
     double **B_p_AA = get_DF_ints(intfile, AAlabel, foccA, noccA, foccA, noccA);
-    double **B_p_RR = get_DF_ints(intfile, RRlabel, 0, nvirA, 0, nvirA);
 
     for (int a = 0; a < aoccA; a++) {
         C_DGEMM('N', 'T', aoccA, nvirA, ndf_ + 3, -1.0, B_p_AA[a * aoccA], ndf_ + 3, T_p_AR[a * nvirA], ndf_ + 3, 1.0,
                 yAR[0], nvirA);
     }
 
-    C_DGEMM('N', 'T', aoccA, nvirA, nvirA * (ndf_ + 3), 1.0, T_p_AR[0], nvirA * (ndf_ + 3), B_p_RR[0],
-            nvirA * (ndf_ + 3), 1.0, yAR[0], nvirA);
-
     free_block(B_p_AA);
+
+    // (RR|P) is streamed in blocks of r, the next block is read while this one is contracted
+    auto RR_reader = get_RR_reader(intfile, RRlabel, nvirA);
+    size_t r = 0;
+
+    while (double **B_p_RR = RR_reader->next()) {
+        size_t nr = RR_reader->rows() / nvirA;
+        C_DGEMM('N', 'T', aoccA, nr, nvirA * (ndf_ + 3), 1.0, T_p_AR[0], nvirA * (ndf_ + 3), B_p_RR[0],
+                nvirA * (ndf_ + 3), 1.0, &(yAR[0][r]), nvirA);
+        r += nr;
+    }
+
+    RR_reader.reset();
     free_block(T_p_AR);
-    free_block(B_p_RR);
 }
 
 void SAPT2::t2OVOV(int ampfile, const char *tlabel, const char *thetalabel, int intfile, const char *AAlabel,
@@ -325,17 +334,20 @@ void SAPT2::t2OVOV(int ampfile, const char *tlabel, const char *thetalabel, int
 
     double **vAARR = block_matrix(aoccA * nvirA, aoccA * nvirA);
     double **B_p_AA = get_DF_ints(intfile, AAlabel, foccA, noccA, foccA, noccA);
-    double **B_p_RR = get_DF_ints(intfile, RRlabel, 0, nvirA, 0, nvirA);
 
-    for (int a = 0, ar = 0; a < aoccA; a++) {
-        for (int r = 0; r < nvirA; r++, ar++) {
-            C_DGEMM('N', 'T', aoccA, nvirA, ndf_ + 3, 1.0, B_p_AA[a * aoccA], ndf_ + 3, B_p_RR[r * nvirA], ndf_ + 3,
-                    0.0, vAARR[ar], nvirA);
+    // (RR|P) is streamed one r at a time, the next slice is read while this one is contracted
+    auto RR_reader = get_RR_reader(intfile, RRlabel, nvirA, 1);
+
+    for (int r = 0; r < nvirA; r++) {
+        double **B_p_RR = RR_reader->next();
+        for (int a = 0; a < aoccA; a++) {
+            C_DGEMM('N', 'T', aoccA, nvirA, ndf_ + 3, 1.0, B_p_AA[a * aoccA], ndf_ + 3, B_p_RR[0], ndf_ + 3, 0.0,
+                    vAARR[a * nvirA + r], nvirA);
         }
     }
 
+    RR_reader.reset();
     free_block(B_p_AA);
-    free_block(B_p_RR);
 
     double *tARAR = init_array((long int)aoccA * nvirA * aoccA * nvirA);
     psio_->read_entry(ampfile, tlabel, (char *)tARAR, sizeof(double) * aoccA * nvirA * aoccA * nvirA);
@@ -383,7 +395,7 @@ void SAPT2::t2OVOV(int ampfile, const char *tlabel, const char *thetalabel, int
 
     free_block(vAAAA);
 
-    B_p_RR = get_DF_ints(intfile, RRlabel, 0, nvirA, 0, nvirA);
+    double **B_p_RR = get_DF_ints(intfile, RRlabel, 0, nvirA, 0, nvirA);
     double **xRRR = block_matrix(nvirA * nvirA, nvirA);
 
     for (int r = 0; r < nvirA; r++) {
@@ -427,17 +439,20 @@ void SAPT2::t2OVOV(int ampfile, const char *tlabel, const char *no_tlabel, const
 
     double **vAARR = block_matrix(aoccA * nvirA, aoccA * nvirA);
     double **B_p_AA = get_DF_ints(intfile, AAlabel, foccA, noccA, foccA, noccA);
-    double **B_p_RR = get_DF_ints(intfile, RRlabel, 0, nvirA, 0, nvirA);
 
-    for (int a = 0, ar = 0; a < aoccA; a++) {
-        for (int r = 0; r < nvirA; r++, ar++) {
-            C_DGEMM('N', 'T', aoccA, nvirA, ndf_ + 3, 1.0, B_p_AA[a * aoccA], ndf_ + 3, B_p_RR[r * nvirA], ndf_ + 3,
-                    0.0, vAARR[ar], nvirA);
+    // (RR|P) is streamed one r at a time, the next slice is read while this one is contracted
+    auto RR_reader = get_RR_reader(intfile, RRlabel, nvirA, 1);
+
+    for (int r = 0; r < nvirA; r++) {
+        double **B_p_RR = RR_reader->next();
+        for (int a = 0; a < aoccA; a++) {
+            C_DGEMM('N', 'T', aoccA, nvirA, ndf_ + 3, 1.0, B_p_AA[a * aoccA], ndf_ + 3, B_p_RR[0], ndf_ + 3, 0.0,
+                    vAARR[a * nvirA + r], nvirA);
         }
     }
 
+    RR_reader.reset();
     free_block(B_p_AA);
-    free_block(B_p_RR);
 
     double *tARAR = init_array((long int)aoccA * nvirA * aoccA * nvirA);
     psio_->read_entry(ampfile, tlabel, (char *)tARAR, sizeof(double) * aoccA * nvirA * aoccA * nvirA);
@@ -504,7 +519,7 @@ void SAPT2::t2OVOV(int ampfile, const char *tlabel, const char *no_tlabel, const
     psio_->read_entry(ampfile, no_tlabel, (char *)tArAr, sizeof(double) * aoccA * no_nvirA * aoccA * no_nvirA);
     ijkl_to_ikjl(tArAr, aoccA, no_nvirA, aoccA, no_nvirA);
 
-    B_p_RR = get_DF_ints(intfile, no_RRlabel, 0, no_nvirA, 0, no_nvirA);
+    double **B_p_RR = get_DF_ints(intfile, no_RRlabel, 0, no_nvirA, 0, no_nvirA);
     double **xRRR = block_matrix(no_nvirA * no_nvirA, no_nvirA);
 
     for (int r = 0; r < no_nvirA; r++) {
@@ -689,17 +704,20 @@ void SAPT2p::gARARxtARBS(int ampfile, const char *tlabel, const char trans, int
     free_block(B_p_AR);
 
     double **B_p_AA = get_DF_ints(intfile, AAlabel, foccA, noccA, foccA, noccA);
-    double **B_p_RR = get_DF_ints(intfile, RRlabel, 0, nvirA, 0, nvirA);
 
-    for (int a = 0, ar = 0; a < aoccA; a++) {
-        for (int r = 0; r < nvirA; r++, ar++) {
-            C_DGEMM('N', 'T', aoccA, nvirA, ndf_ + 3, -1.0, B_p_AA[a * aoccA], ndf_ + 3, B_p_RR[r * nvirA], ndf_ + 3,
-                    1.0, gARAR[ar], nvirA);
+    // (RR|P) is streamed one r at a time, the next slice is read while this one is contracted
+    auto RR_reader = get_RR_reader(intfile, RRlabel, nvirA, 1);
+
+    for (int r = 0; r < nvirA; r++) {
+        double **B_p_RR = RR_reader->next();
+        for (int a = 0; a < aoccA; a++) {
+            C_DGEMM('N', 'T', aoccA, nvirA, ndf_ + 3, -1.0, B_p_AA[a * aoccA], ndf_ + 3, B_p_RR[0], ndf_ + 3, 1.0,
+                    gARAR[a * nvirA + r], nvirA);
         }
     }
 
+    RR_reader.reset();
     free_block(B_p_AA);
-    free_block(B_p_RR);
 
     double **tARBS;
     double **xARBS;
@@ -925,16 +943,17 @@ void SAPT2p3::Y3_2(double **yAR, int intfile, const char *ARlabel, const char *R
 
     double **B_p_RR = block_matrix(virtri, ndf_ + 3);
 
-    psio_address next_DF_RR = PSIO_ZERO;
+    // Only the r2 <= r1 triangle of (RR|P) is kept, it is streamed one r1 at a time
+    auto RR_reader = get_RR_reader(intfile, RRlabel, nvirA, 1);
 
     for (int r1 = 0, r1r2 = 0; r1 < nvirA; r1++) {
-        for (int r2 = 0; r2 <= r1; r2++, r1r2++) {
-            next_DF_RR = psio_get_address(PSIO_ZERO, sizeof(double) * (r1 * nvirA + r2) * (ndf_ + 3));
-            psio_->read(intfile, RRlabel, (char *)&(B_p_RR[r1r2][0]), sizeof(double) * (ndf_ + 3), next_DF_RR,
-                        &next_DF_RR);
-        }
+        double **B_p_R1R = RR_reader->next();
+        C_DCOPY((r1 + 1) * (ndf_ + 3), B_p_R1R[0], 1, B_p_RR[r1r2], 1);
+        r1r2 += r1 + 1;
     }
 
+    RR_reader.reset();
+
     for (int a = 0; a < aoccA; a++) {
         C_DGEMM('N', 'T', virtri, nvirA, ndf_ + 3, 1.0, B_p_RR[0], ndf_ + 3, B_p_AR[a * nvirA], ndf_ + 3, 0.0,
                 &(RRR[0][0]), nvirA);
@@ -1184,15 +1203,24 @@ void SAPT2p3::inddisp30_ov(int AAfile, const char *AAlabel, const char *RRlabel,
     size_t aoccA = noccA - foccA;
 
     double **B_p_AA = get_DF_ints(AAfile, AAlabel, foccA, noccA, foccA, noccA);
-    double **B_p_RR = get_DF_ints(AAfile, RRlabel, 0, nvirA, 0, nvirA);
 
     double **T_p_AR = block_matrix(aoccA * nvirA, ndf_ + 3);
     psio_->read_entry(ampfile, Tlabel, (char *)T_p_AR[0], sizeof(double) * aoccA * nvirA * (ndf_ + 3));
 
     double **uAR = block_matrix(aoccA, nvirA);
 
-    C_DGEMM('N', 'T', aoccA, nvirA, nvirA * (ndf_ + 3), 2.0, T_p_AR[0], nvirA * (ndf_ + 3), B_p_RR[0],
-            nvirA * (ndf_ + 3), 0.0, uAR[0], nvirA);
+    // (RR|P) is streamed in blocks of r, the next block is read while this one is contracted
+    auto RR_reader = get_RR_reader(AAfile, RRlabel, nvirA);
+    size_t r = 0;
+
+    while (double **B_p_RR = RR_reader->next()) {
+        size_t nr = RR_reader->rows() / nvirA;
+        C_DGEMM('N', 'T', aoccA, nr, nvirA * (ndf_ + 3), 2.0, T_p_AR[0], nvirA * (ndf_ + 3), B_p_RR[0],
+                nvirA * (ndf_ + 3), 0.0, &(uAR[0][r]), nvirA);
+        r += nr;
+    }
+
+    RR_reader.reset();
 
     for (int a = 0; a < aoccA; a++) {
         C_DGEMM('N', 'T', aoccA, nvirA, ndf_ + 3, -2.0, B_p_AA[a * aoccA], ndf_ + 3, T_p_AR[a * nvirA], ndf_ + 3, 1.0,
@@ -1200,7 +1228,6 @@ void SAPT2p3::inddisp30_ov(int AAfile, const char *AAlabel, const char *RRlabel,
     }
 
     free_block(B_p_AA);
-    free_block(B_p_RR);
     free_block(T_p_AR);
 
     for (int a = 0; a < aoccA; a++) {
@@ -1347,14 +1374,16 @@ void SAPT2p3::disp30_amps(int ampfile, const char *amplabel, int AAintfile, cons
 
     double **t2RSAB = block_matrix(nvirA * nvirB, aoccA * aoccB);
 
-    double **B_p_RR = block_matrix(nvirA, ndf_ + 3);
     double **B_p_SS = get_DF_ints(BBintfile, SSlabel, 0, nvirB, 0, nvirB);
 
     double **X_RS = block_matrix(nvirA, nvirB * nvirB);
 
-    psio_address next_RR = PSIO_ZERO;
+    // (RR|P) is streamed one r at a time, the next slice is read while this one is contracted.
+    // No other psio calls may be made while the reader is alive.
+    auto RR_reader = get_RR_reader(AAintfile, RRlabel, nvirA, 1);
+
     for (int r = 0; r < nvirA; r++) {
-        psio_->read(AAintfile, RRlabel, (char *)B_p_RR[0], sizeof(double) * nvirA * (ndf_ + 3), next_RR, &next_RR);
+        double **B_p_RR = RR_reader->next();
 
         C_DGEMM('N', 'T', nvirA, nvirB * nvirB, ndf_ + 3, 1.0, B_p_RR[0], ndf_ + 3, &(B_p_SS[0][0]), ndf_ + 3, 0.0,
                 &(X_RS[0][0]), nvirB * nvirB);
@@ -1362,7 +1391,7 @@ void SAPT2p3::disp30_amps(int ampfile, const char *amplabel, int AAintfile, cons
                 t2RSAB[r * nvirB], aoccA * aoccB);
     }
 
-    free_block(B_p_RR);
+    RR_reader.reset();
     free_block(B_p_SS);
     free_block(X_RS);
 
@@ -1425,19 +1454,21 @@ void SAPT2p3::disp30_amps(int ampfile, const char *amplabel, int AAintfile, cons
     free_block(t2ABRS);
 
     B_p_BB = get_DF_ints(BBintfile, BBlabel, foccB, noccB, foccB, noccB);
-    B_p_RR = get_DF_ints(AAintfile, RRlabel, 0, nvirA, 0, nvirA);
 
     double **BRBR = block_matrix(aoccB * nvirA, aoccB * nvirA);
 
-    for (int b = 0, br = 0; b < aoccB; b++) {
-        for (int r = 0; r < nvirA; r++, br++) {
-            C_DGEMM('N', 'T', aoccB, nvirA, ndf_ + 3, 1.0, &(B_p_BB[b * aoccB][0]), ndf_ + 3, &(B_p_RR[r * nvirA][0]),
-                    ndf_ + 3, 0.0, &(BRBR[br][0]), nvirA);
+    RR_reader = get_RR_reader(AAintfile, RRlabel, nvirA, 1);
+
+    for (int r = 0; r < nvirA; r++) {
+        double **B_p_RR = RR_reader->next();
+        for (int b = 0; b < aoccB; b++) {
+            C_DGEMM('N', 'T', aoccB, nvirA, ndf_ + 3, 1.0, &(B_p_BB[b * aoccB][0]), ndf_ + 3, &(B_p_RR[0][0]),
+                    ndf_ + 3, 0.0, &(BRBR[b * nvirA + r][0]), nvirA);
         }
     }
 
+    RR_reader.reset();
     free_block(B_p_BB);
-    free_block(B_p_RR);
 
     C_DGEMM('N', 'N', aoccB * nvirA, aoccA * nvirB, aoccB * nvirA, -1.0, &(BRBR[0][0]), aoccB * nvirA, &(tBRAS[0][0]),
             aoccA * nvirB, 1.0, &(t2BRAS[0][0]), aoccA * nvirB);
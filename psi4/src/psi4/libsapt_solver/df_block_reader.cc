@@ -0,0 +1,104 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#include "df_block_reader.h"
+
+#include <algorithm>
+
+#include "psi4/libciomr/libciomr.h"
+#include "psi4/libpsio/aiohandler.h"
+#include "psi4/libpsio/psio.h"
+#include "psi4/libpsio/psio.hpp"
+
+namespace psi {
+namespace sapt {
+
+DFBlockReader::DFBlockReader(std::shared_ptr<PSIO> psio, int filenum, const char *label, size_t nrow, size_t rowlen,
+                             size_t blockrows, psio_address start)
+    : psio_(psio),
+      filenum_(filenum),
+      label_(label),
+      start_(start),
+      nrow_(nrow),
+      rowlen_(rowlen),
+      blockrows_(std::max(std::min(blockrows, nrow), (size_t)1)),
+      issued_(0),
+      current_(-1) {
+    buffer_[0] = block_matrix(blockrows_, rowlen_);
+    buffer_[1] = (nrow_ > blockrows_ ? block_matrix(blockrows_, rowlen_) : nullptr);
+    rows_[0] = 0;
+    rows_[1] = 0;
+
+    aio_ = std::make_shared<AIOHandler>(psio_);
+
+    // Start on the first block right away, it overlaps whatever the caller does before next()
+    prefetch(0);
+}
+
+DFBlockReader::~DFBlockReader() {
+    aio_->synchronize();
+    free_block(buffer_[0]);
+    if (buffer_[1] != nullptr) free_block(buffer_[1]);
+}
+
+void DFBlockReader::prefetch(int slot) {
+    if (issued_ == nrow_) {
+        rows_[slot] = 0;
+        return;
+    }
+
+    size_t nrows = std::min(blockrows_, nrow_ - issued_);
+    psio_address addr = psio_get_address(start_, sizeof(double) * issued_ * rowlen_);
+    aio_->read(filenum_, label_.c_str(), (char *)buffer_[slot][0], sizeof(double) * nrows * rowlen_, addr,
+               &end_[slot]);
+
+    rows_[slot] = nrows;
+    issued_ += nrows;
+}
+
+double **DFBlockReader::next() {
+    int slot = (current_ < 0 ? 0 : 1 - current_);
+
+    // The block in slot was queued by the previous call (or the constructor)
+    aio_->synchronize();
+
+    if (rows_[slot] == 0) {
+        current_ = slot;
+        return nullptr;
+    }
+
+    current_ = slot;
+
+    // The other buffer is free again now that the caller is done with it
+    if (buffer_[1 - slot] != nullptr) prefetch(1 - slot);
+
+    return buffer_[current_];
+}
+
+}  // namespace sapt
+}  // namespace psi
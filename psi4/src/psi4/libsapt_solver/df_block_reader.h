@@ -0,0 +1,102 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#ifndef SAPT_DF_BLOCK_READER_H
+#define SAPT_DF_BLOCK_READER_H
+
+#include <memory>
+#include <string>
+
+#include "psi4/libpsio/config.h"
+
+namespace psi {
+
+class PSIO;
+class AIOHandler;
+
+namespace sapt {
+
+/**
+ * Streams a row-major psio entry in fixed-size row blocks.
+ *
+ * Two buffers are kept: while the caller works on the block returned by
+ * next(), the following block is read on the AIOHandler thread. A block
+ * stays valid until the next call to next(). PSIO is not thread safe, so
+ * the caller must not issue other psio calls while a reader is alive.
+ *
+ *     DFBlockReader reader(psio_, PSIF_SAPT_AA_DF_INTS, "RR RI Integrals", nvirA * nvirA, ndf_ + 3, nvirA);
+ *     while (double **B = reader.next()) { ... reader.rows() ... }
+ **/
+class DFBlockReader {
+   protected:
+    std::shared_ptr<PSIO> psio_;
+    std::shared_ptr<AIOHandler> aio_;
+
+    int filenum_;
+    /// Kept as a member, the AIOHandler only holds on to the pointer
+    std::string label_;
+
+    /// Address of the first row to be read
+    psio_address start_;
+    /// Total number of rows to stream
+    size_t nrow_;
+    /// Length of a row in doubles
+    size_t rowlen_;
+    /// Maximum number of rows per block
+    size_t blockrows_;
+
+    /// Double buffer, each blockrows_ x rowlen_
+    double **buffer_[2];
+    /// End addresses handed to the AIOHandler
+    psio_address end_[2];
+    /// Rows in each buffer
+    size_t rows_[2];
+
+    /// Rows requested so far
+    size_t issued_;
+    /// Buffer holding the block returned by the last next(), -1 before the first call
+    int current_;
+
+    /// Queue the read of the following block into buffer slot
+    void prefetch(int slot);
+
+   public:
+    DFBlockReader(std::shared_ptr<PSIO> psio, int filenum, const char *label, size_t nrow, size_t rowlen,
+                  size_t blockrows, psio_address start = PSIO_ZERO);
+    ~DFBlockReader();
+
+    /// Returns the next block (rows() x rowlen), or nullptr once every row has been returned
+    double **next();
+    /// Number of rows in the block returned by the last next()
+    size_t rows() const { return (current_ < 0 ? 0 : rows_[current_]); }
+};
+
+}  // namespace sapt
+}  // namespace psi
+
+#endif
@@ -27,6 +27,7 @@
  */
 
 #include "sapt2p.h"
+#include "df_block_reader.h"
 #include "psi4/libciomr/libciomr.h"
 #include "psi4/libpsio/psio.hpp"
 #include "psi4/libqt/qt.h"
@@ -177,12 +178,18 @@ double SAPT2p::disp220s(int ampfile, const char *tlabel, const char *thetalabel,
     double **T_p_AR = block_matrix(aoccA * nvirA, ndf_ + 3);
     psio_->read_entry(ampfile, thetalabel, (char *)T_p_AR[0], sizeof(double) * aoccA * nvirA * (ndf_ + 3));
 
-    double **B_p_RR = get_DF_ints(intfile, RRlabel, 0, nvirA, 0, nvirA);
+    // (RR|P) is streamed in blocks of r, the next block is read while this one is contracted
+    auto RR_reader = get_RR_reader(intfile, RRlabel, nvirA);
+    size_t r = 0;
 
-    C_DGEMM('N', 'T', aoccA, nvirA, nvirA * (ndf_ + 3), 1.0, T_p_AR[0], nvirA * (ndf_ + 3), B_p_RR[0],
-            nvirA * (ndf_ + 3), 0.0, yAR[0], nvirA);
+    while (double **B_p_RR = RR_reader->next()) {
+        size_t nr = RR_reader->rows() / nvirA;
+        C_DGEMM('N', 'T', aoccA, nr, nvirA * (ndf_ + 3), 1.0, T_p_AR[0], nvirA * (ndf_ + 3), B_p_RR[0],
+                nvirA * (ndf_ + 3), 0.0, &(yAR[0][r]), nvirA);
+        r += nr;
+    }
 
-    free_block(B_p_RR);
+    RR_reader.reset();
 
     double **B_p_AA = get_DF_ints(intfile, AAlabel, foccA, noccA, foccA, noccA);
 
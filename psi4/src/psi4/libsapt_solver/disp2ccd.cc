@@ -27,11 +27,11 @@
  */
 
 #include "sapt2p.h"
+#include "df_block_reader.h"
 #include "psi4/libciomr/libciomr.h"
 #include "psi4/libmints/matrix.h"
 #include "psi4/libmints/vector.h"
 #include "psi4/liboptions/liboptions.h"
-#include "psi4/libpsio/aiohandler.h"
 #include "psi4/libpsio/psio.hpp"
 #include "psi4/libqt/qt.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
@@ -1266,30 +1266,18 @@ double **SAPT2p::vvvv_ccd(const char *TARAR, const char *RRRRp, const char *RRRR
     }
 
     double **sAARR = block_matrix(occtri, virtri);
-    double **vRRRRp[2];
-    vRRRRp[0] = block_matrix(blocksize, virtri);
-    vRRRRp[1] = block_matrix(blocksize, virtri);
 
-    psio_address next_RRRRp = PSIO_ZERO;
-
-    auto aio = std::make_shared<AIOHandler>(psio_);
-
-    psio_->read(PSIF_SAPT_CCD, RRRRp, (char *)&(vRRRRp[0][0][0]), blocksize * virtri * (size_t)sizeof(double),
-                next_RRRRp, &next_RRRRp);
+    // (vv|vv)+ is streamed in row blocks, the next block is read while this one is contracted
+    auto RRRRp_reader = std::make_shared<DFBlockReader>(psio_, PSIF_SAPT_CCD, RRRRp, loopsize * blocksize, virtri,
+                                                        blocksize);
 
     for (int r_read = 0; r_read < loopsize; r_read++) {
-        if (r_read < loopsize - 1)
-            aio->read(PSIF_SAPT_CCD, RRRRp, (char *)&(vRRRRp[(r_read + 1) % 2][0][0]),
-                      blocksize * virtri * (size_t)sizeof(double), next_RRRRp, &next_RRRRp);
-
-        C_DGEMM('N', 'T', occtri, blocksize, virtri, 1.0, tpAARR[0], virtri, vRRRRp[r_read % 2][0], virtri, 1.0,
+        double **vRRRRp = RRRRp_reader->next();
+        C_DGEMM('N', 'T', occtri, blocksize, virtri, 1.0, tpAARR[0], virtri, vRRRRp[0], virtri, 1.0,
                 &(sAARR[0][r_read * blocksize]), virtri);
-
-        if (r_read < loopsize - 1) aio->synchronize();
     }
 
-    free_block(vRRRRp[0]);
-    free_block(vRRRRp[1]);
+    RRRRp_reader.reset();
     free_block(tpAARR);
 
     if (virA2 % 2 == 0) {
@@ -1301,28 +1289,18 @@ double **SAPT2p::vvvv_ccd(const char *TARAR, const char *RRRRp, const char *RRRR
     }
 
     double **aAARR = block_matrix(occtri, svirtri);
-    double **vRRRRm[2];
-    vRRRRm[0] = block_matrix(blocksize, svirtri);
-    vRRRRm[1] = block_matrix(blocksize, svirtri);
 
-    psio_address next_RRRRm = PSIO_ZERO;
-
-    psio_->read(PSIF_SAPT_CCD, RRRRm, (char *)&(vRRRRm[0][0][0]), blocksize * svirtri * (size_t)sizeof(double),
-                next_RRRRm, &next_RRRRm);
+    // Same for (vv|vv)-
+    auto RRRRm_reader = std::make_shared<DFBlockReader>(psio_, PSIF_SAPT_CCD, RRRRm, loopsize * blocksize, svirtri,
+                                                        blocksize);
 
     for (int r_read = 0; r_read < loopsize; r_read++) {
-        if (r_read < loopsize - 1)
-            aio->read(PSIF_SAPT_CCD, RRRRm, (char *)&(vRRRRm[(r_read + 1) % 2][0][0]),
-                      blocksize * svirtri * (size_t)sizeof(double), next_RRRRm, &next_RRRRm);
-
-        C_DGEMM('N', 'T', occtri, blocksize, svirtri, 1.0, tmAARR[0], svirtri, vRRRRm[r_read % 2][0], svirtri, 1.0,
+        double **vRRRRm = RRRRm_reader->next();
+        C_DGEMM('N', 'T', occtri, blocksize, svirtri, 1.0, tmAARR[0], svirtri, vRRRRm[0], svirtri, 1.0,
                 &(aAARR[0][r_read * blocksize]), svirtri);
-
-        if (r_read < loopsize - 1) aio->synchronize();
     }
 
-    free_block(vRRRRm[0]);
-    free_block(vRRRRm[1]);
+    RRRRm_reader.reset();
     free_block(tmAARR);
 
     double **t2AARR = block_matrix(occA * occA, virA2 * virA2);
@@ -40,6 +40,8 @@
 #include "psi4/libpsio/psio.h"
 #include "psi4/libqt/qt.h"
 
+#include <algorithm>
+
 namespace psi {
 namespace sapt {
 
@@ -102,6 +104,15 @@ SAPT2::SAPT2(SharedWavefunction Dimer, SharedWavefunction MonomerA, SharedWavefu
     no_evalsB_ = nullptr;
     no_CA_ = nullptr;
     no_CB_ = nullptr;
+
+    // Half of the memory not claimed by the largest SAPT2 intermediates
+    // (see print_header) keeps DF integral blocks resident
+    long int occ = std::max(noccA_, noccB_);
+    long int vir = std::max(nvirA_, nvirB_);
+    long int peak = vir * vir * (long int)ndf_ + 3L * occ * occ * vir * vir;
+    df_cache_size_ = 0;
+    df_cache_max_ = (mem_ > peak ? (size_t)(mem_ - peak) / 2 : 0);
+    mem_ -= df_cache_max_;
 }
 
 SAPT2::~SAPT2() {
@@ -31,9 +31,16 @@
 
 #include "sapt.h"
 
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
 namespace psi {
 namespace sapt {
 
+class DFBlockReader;
+
 class SAPT2 : public SAPT {
    private:
     virtual void print_header();
@@ -88,6 +95,16 @@ class SAPT2 : public SAPT {
     double **wABS_;
     double **wASS_;
 
+    // Resident copies of DF integral blocks read through get_DF_ints, keyed by
+    // file, label and range. Only the DF integral files are cached, their
+    // entries are written once in df_integrals/natural_orbitalify_df_ints.
+    std::map<std::string, std::vector<double> > df_cache_;
+    // Least recently used key first
+    std::list<std::string> df_cache_lru_;
+    // Doubles currently held and allowed in df_cache_
+    size_t df_cache_size_;
+    size_t df_cache_max_;
+
     double **get_AA_ints(const int, int = 0, int = 0);
     double **get_diag_AA_ints(const int);
     double **get_AR_ints(const int, int = 0);
@@ -105,6 +122,8 @@ class SAPT2 : public SAPT {
 
     double **get_DF_ints(int, const char *, int, int, int, int);
     double **get_DF_ints_nongimp(int, const char *, int, int, int, int);
+    // Streams an (RR|P) entry over nvir x nvir pairs in blocks of nr1 whole rows of the first index
+    std::shared_ptr<DFBlockReader> get_RR_reader(int filenum, const char *label, size_t nvir, size_t nr1 = 16);
     void antisym(double *, size_t, size_t);
     void antisym(double **, size_t, size_t);
 
@@ -29,6 +29,7 @@
 #include "sapt.h"
 #include "sapt0.h"
 #include "sapt2.h"
+#include "df_block_reader.h"
 #include "psi4/libciomr/libciomr.h"
 #include "psi4/libpsio/psio.hpp"
 #include "psi4/libpsio/psio.h"
@@ -1284,6 +1285,22 @@ double **SAPT2::get_DF_ints(int filenum, const char *label, int startA, int stop
     int lengthAB = lengthA * lengthB;
 
     double **A = block_matrix(lengthAB, ndf_ + 3);
+    size_t size = (size_t)lengthAB * (ndf_ + 3);
+
+    bool cache = (df_cache_max_ > 0 && (filenum == PSIF_SAPT_AA_DF_INTS || filenum == PSIF_SAPT_BB_DF_INTS ||
+                                        filenum == PSIF_SAPT_AB_DF_INTS));
+    std::string key;
+    if (cache) {
+        key = std::to_string(filenum) + " " + label + " " + std::to_string(startA) + " " + std::to_string(stopA) +
+              " " + std::to_string(startB) + " " + std::to_string(stopB);
+        auto hit = df_cache_.find(key);
+        if (hit != df_cache_.end()) {
+            C_DCOPY(size, hit->second.data(), 1, A[0], 1);
+            df_cache_lru_.remove(key);
+            df_cache_lru_.push_back(key);
+            return (A);
+        }
+    }
 
     if (startA == 0 && startB == 0) {
         psio_->read_entry(filenum, label, (char *)A[0], sizeof(double) * lengthAB * (ndf_ + 3));
@@ -1299,9 +1316,24 @@ double **SAPT2::get_DF_ints(int filenum, const char *label, int startA, int stop
         }
     }
 
+    if (cache && size <= df_cache_max_) {
+        while (df_cache_size_ + size > df_cache_max_) {
+            df_cache_size_ -= df_cache_[df_cache_lru_.front()].size();
+            df_cache_.erase(df_cache_lru_.front());
+            df_cache_lru_.pop_front();
+        }
+        df_cache_[key] = std::vector<double>(A[0], A[0] + size);
+        df_cache_lru_.push_back(key);
+        df_cache_size_ += size;
+    }
+
     return (A);
 }
 
+std::shared_ptr<DFBlockReader> SAPT2::get_RR_reader(int filenum, const char *label, size_t nvir, size_t nr1) {
+    return std::make_shared<DFBlockReader>(psio_, filenum, label, nvir * nvir, ndf_ + 3, nr1 * nvir);
+}
+
 double **SAPT2::get_DF_ints_nongimp(int filenum, const char *label, int startA, int stopA, int startB, int stopB) {
     int lengthA = stopA - startA;
     int lengthB = stopB - startB;
@@ -34,6 +34,8 @@
 
 #include "frag.h"
 
+#include <algorithm>
+
 #include "mem.h"
 #include "v3d.h"
 #include "atom_data.h"
@@ -41,6 +43,7 @@
 #include "opt_data.h"
 #include "psi4/optking/physconst.h"
 #include "linear_algebra.h"
+#include "sparse_matrix.h"
 #include "psi4/psi4-dec.h"
 #include "print.h"
 #define EXTERN
@@ -656,6 +659,30 @@ void FRAG::compute_B(double **B, int coord_offset, int atom_offset) const {
 }
 
 
+// Sparse B: each row only has columns for the atoms of the simples making up the coordinate.
+void FRAG::compute_B(SPARSE_MATRIX & B, int atom_offset) const {
+  double *dqdx = init_array(B.g_ncol());
+
+  for (int cc=0; cc<Ncoord(); ++cc) {
+    std::vector<int> cols;
+    for (std::size_t s=0; s<coords.index[cc].size(); ++s) {
+      const SIMPLE_COORDINATE *simple = coords.simples[coords.index[cc][s]];
+      for (int j=0; j<simple->g_natom(); ++j)
+        for (int xyz=0; xyz<3; ++xyz)
+          cols.push_back(3*(atom_offset + simple->g_atom(j)) + xyz);
+    }
+    std::sort(cols.begin(), cols.end());
+    cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+
+    coords.DqDx(geom, cc, dqdx, atom_offset);
+    B.add_row(dqdx, cols);
+
+    for (std::size_t k=0; k<cols.size(); ++k)
+      dqdx[cols[k]] = 0.0;
+  }
+  free_array(dqdx);
+}
+
 // Returns B matrix of only the simple coordinates for this fragment.
 /*
 void FRAG::compute_B_simples(double **B, int coord_offset, int atom_offset) const {
@@ -711,6 +738,13 @@ double ** FRAG::compute_constraints(void) const {
   return C;
 }
 
+bool FRAG::has_frozen_coords() const {
+  for (std::size_t i=0; i<coords.simples.size(); ++i)
+    if (coords.simples[i]->is_frozen())
+      return true;
+  return false;
+}
+
 // freeze coords within fragments
 void FRAG::freeze_coords(void) {
   for (size_t i=0; i<coords.simples.size(); ++i)
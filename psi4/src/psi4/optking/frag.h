@@ -44,6 +44,7 @@
 namespace opt {
 
 class INTERFRAG;
+class SPARSE_MATRIX;
 using std::vector;
 
 /*!
@@ -135,6 +136,9 @@ class FRAG {
   // Compute B matrix. Use prevously allocated memory.  Offsets are ideal for molecule.
   void compute_B(double **B_in, int coord_offset, int atom_offset) const ;
 
+  // Append the rows of this fragment's coordinates to a sparse B matrix; columns offset by atom_offset.
+  void compute_B(SPARSE_MATRIX & B, int atom_offset) const ;
+
   // Compute B only for the simple coordinates.
   //void compute_B_simples(double **B, int coord_offset, int atom_offset) const;
 
@@ -238,6 +242,8 @@ class FRAG {
 
   // return matrix of constraints on coordinates
   double ** compute_constraints() const;
+  // whether any coordinate of this fragment is frozen (i.e., compute_constraints is not zero)
+  bool has_frozen_coords() const;
 
   // add any missing hydrogen bonds within the fragment
   // return number added
@@ -33,6 +33,7 @@
 
 #include "frag.h"
 #include "linear_algebra.h"
+#include "sparse_matrix.h"
 #include "opt_data.h"
 
 #include "print.h"
@@ -251,8 +252,8 @@ bool FRAG::displace_util(double *dq, bool focus_on_constraints) {
   double * first_geom = init_array(Ncarts); // first try at back-transformation
   double * dx = init_array(Ncarts);
   double * tmp_v_Nints = init_array(Nints);
-  double **B = init_matrix(Nints, Ncarts);
-  double **G = init_matrix(Nints, Nints);
+  double **B = Opt_params.sparse_B ? nullptr : init_matrix(Nints, Ncarts);
+  double **G = Opt_params.sparse_B ? nullptr : init_matrix(Nints, Nints);
 
   bool bt_iter_done = false;
   bool bt_converged = true;
@@ -284,14 +285,23 @@ bool FRAG::displace_util(double *dq, bool focus_on_constraints) {
     // B dx = B * (Bt (B Bt)^-1) dq
     //   dx = Bt (B Bt)^-1 dq
     //   dx = Bt G^-1 dq, where G = B B^t.
-    compute_B(B,0,0);
-    opt_matrix_mult(B, false, B, true, G, false, Nints, Ncarts, Nints, false);
-
-    // u B^t (G_inv dq) = dx
-    G_inv = symm_matrix_inv(G, Nints, true);
-    opt_matrix_mult(G_inv, false, &dq, true, &tmp_v_Nints, true, Nints, Nints, 1, false);
-    opt_matrix_mult(B, true, &tmp_v_Nints, true, &dx, true, Ncarts, Nints, 1, false);
-    free_matrix(G_inv);
+    if (Opt_params.sparse_B) {
+      // dx is the minimum-norm least-squares solution of B dx = dq; G is never formed
+      SPARSE_MATRIX B_sparse(Ncarts);
+      compute_B(B_sparse, 0);
+      if (!B_sparse.least_squares(dq, dx, false, Opt_params.cg_conv, Opt_params.cg_max_iter))
+        oprintf_out("	Warning: CG solve for back-transformation step did not converge.\n");
+    }
+    else {
+      compute_B(B,0,0);
+      opt_matrix_mult(B, false, B, true, G, false, Nints, Ncarts, Nints, false);
+
+      // u B^t (G_inv dq) = dx
+      G_inv = symm_matrix_inv(G, Nints, true);
+      opt_matrix_mult(G_inv, false, &dq, true, &tmp_v_Nints, true, Nints, Nints, 1, false);
+      opt_matrix_mult(B, true, &tmp_v_Nints, true, &dx, true, Ncarts, Nints, 1, false);
+      free_matrix(G_inv);
+    }
 
     for (i=0; i<Ncarts; ++i)
       new_geom[i] += dx[i];
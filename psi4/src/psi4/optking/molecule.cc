@@ -37,6 +37,7 @@
 #include <sstream>
 
 #include "linear_algebra.h"
+#include "sparse_matrix.h"
 #include "atom_data.h"
 #include "psi4/optking/physconst.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
@@ -98,6 +99,22 @@ void MOLECULE::forces() {
   if (Opt_params.print_lvl > 3)
     oprint_array_out_precise(f_x, Ncart);
 
+  if (use_sparse_B()) {
+    // f_q = (B B^t)^-1 B f_x is the minimum-norm least-squares solution of B^t f_q = f_x
+    SPARSE_MATRIX B_sparse(Ncart);
+    compute_B(B_sparse);
+    double *f_q = p_Opt_data->g_forces_pointer();
+    if (!B_sparse.least_squares(f_x, f_q, true, Opt_params.cg_conv, Opt_params.cg_max_iter))
+      oprintf_out("\tWarning: CG solve for internal coordinate forces did not converge.\n");
+    free_array(f_x);
+
+    if (Opt_params.print_lvl >= 3) {
+      oprintf_out("Internal forces in au\n");
+      oprint_array_out_precise(f_q, Ncoord());
+    }
+    return;
+  }
+
   // B (u f_x)
   B = compute_B();
   if (Opt_params.print_lvl >= 3) {
@@ -194,7 +211,8 @@ void MOLECULE::apply_constraint_forces() {
 
         // Increase force constant by 5% of initial value per iteration
         k = (1 + 0.05 * (iter-1)) * Opt_params.fixed_coord_force_constant;
-        H[cnt][cnt] = k;
+        if (H != nullptr)
+          H[cnt][cnt] = k;
 
         double force = (eq_val - val) * k;
         oprintf_out("\tAdding user-defined constraint: Fragment %zu; Coordinate %d:\n", f+1, i+1);
@@ -203,10 +221,12 @@ void MOLECULE::apply_constraint_forces() {
         f_q[cnt] = force;
 
         // If user eq. value is specified delete coupling between this coordinate and others.
-        oprintf_out("\tRemoving off-diagonal coupling between coordinate %d and others.\n", cnt+1);
-        for (int j=0; j<N; ++j)
-          if (j != cnt)
-            H[j][cnt] = H[cnt][j] = 0;
+        if (H != nullptr) {
+          oprintf_out("\tRemoving off-diagonal coupling between coordinate %d and others.\n", cnt+1);
+          for (int j=0; j<N; ++j)
+            if (j != cnt)
+              H[j][cnt] = H[cnt][j] = 0;
+        }
       }
     }
   }
@@ -217,6 +237,31 @@ void MOLECULE::apply_constraint_forces() {
 // add constraints here later
 void MOLECULE::project_f_and_H() {
   int Nintco = Ncoord();
+  double **H = p_Opt_data->g_H_pointer();
+
+  bool frozen_coords = false;
+  for (std::size_t f=0; f<fragments.size(); ++f)
+    if (fragments[f]->has_frozen_coords())
+      frozen_coords = true;
+
+  // Without a Hessian to project, P f_q = B B^+ f_q only needs solves with the sparse B.
+  if (H == nullptr && use_sparse_B() && !frozen_coords) {
+    SPARSE_MATRIX B_sparse(3*g_natom());
+    compute_B(B_sparse);
+
+    double *f_q = p_Opt_data->g_forces_pointer();
+    double *B_inv_f_q = init_array(3*g_natom());
+    if (!B_sparse.least_squares(f_q, B_inv_f_q, false, Opt_params.cg_conv, Opt_params.cg_max_iter))
+      oprintf_out("\tWarning: CG solve for projection of forces did not converge.\n");
+    B_sparse.multiply(B_inv_f_q, f_q);
+    free_array(B_inv_f_q);
+
+    if (Opt_params.print_lvl >= 3) {
+      oprintf_out("\tInternal forces in au, after projection of redundancies.\n");
+      oprint_array_out(f_q, Ncoord());
+    }
+    return;
+  }
 
   // compute G = B B^t
   double **G = compute_G(false);
@@ -285,11 +330,15 @@ void MOLECULE::project_f_and_H() {
     //oprint_array_out_precise(f_q, Ncoord());
   }
 
+  if (H == nullptr) {  // limited-memory step; there is no Hessian
+    free_matrix(P);
+    return;
+  }
+
   // Project redundances and constraints out of Hessian matrix
   // Peng, Ayala, Schlegel, JCC 1996 give H -> PHP + 1000(1-P)
   // The second term appears unnecessary and sometimes messes up Hessian updating.
 
-  double **H = p_Opt_data->g_H_pointer();
   double **temp_mat = init_matrix(Nintco, Nintco);
   opt_matrix_mult(H, false, P, false, temp_mat, false, Nintco, Nintco, Nintco, false);
   opt_matrix_mult(P, false, temp_mat, false, H, false, Nintco, Nintco, Nintco, false);
@@ -604,6 +653,16 @@ double ** MOLECULE::compute_B() const {
   return B;
 }
 
+bool MOLECULE::use_sparse_B() const {
+  return Opt_params.sparse_B && interfragments.empty() && fb_fragments.empty();
+}
+
+// Rows in the same order as compute_B(); fragment coordinates are contiguous.
+void MOLECULE::compute_B(SPARSE_MATRIX & B) const {
+  for (std::size_t f=0; f<fragments.size(); ++f)
+    fragments[f]->compute_B(B, g_atom_offset(f));
+}
+
 double ** MOLECULE::compute_derivative_B(int intco_index) const {
   int cnt_intcos = 0;
   int fragment_index = -1;
@@ -271,6 +271,11 @@ class MOLECULE {
 
   double ** compute_G(bool use_masses=false) const;
 
+  // The sparse B matrix covers only intrafragment coordinates, so it is used (if requested)
+  // when there are no interfragment or fb fragment coordinates.
+  bool use_sparse_B() const;
+  void compute_B(SPARSE_MATRIX & B) const;
+
   double * g_grad_array() const {
     double *g, *g_frag;
 
@@ -344,6 +349,7 @@ class MOLECULE {
   void prfo_step();
   void backstep();
   void sd_step();
+  void lbfgs_step();
   //void sd_step_cartesians(void); now obsolete
   void linesearch_step();
 
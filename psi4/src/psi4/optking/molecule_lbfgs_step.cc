@@ -0,0 +1,237 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*! \file molecule_lbfgs_step.cc
+    \ingroup optking
+    \brief limited-memory BFGS step for molecule
+*/
+
+#include "molecule.h"
+
+#include <vector>
+
+#include "linear_algebra.h"
+#include "psi4/optking/physconst.h"
+#include "psi4/psi4-dec.h"
+#include "print.h"
+#define EXTERN
+#include "globals.h"
+
+#if defined(OPTKING_PACKAGE_PSI)
+ #include <cmath>
+#elif defined (OPTKING_PACKAGE_QCHEM)
+ #include "qcmath.h"
+#endif
+
+namespace opt {
+
+// compute change in energy according to quadratic approximation
+inline double DE_quadratic_energy(double step, double grad, double hess) {
+  return (step * grad + 0.5 * step * step * hess);
+}
+
+// The inverse Hessian is represented implicitly by the (s,y) pairs of the most
+// recent steps and applied to the forces with the two-loop recursion, so no
+// Ncoord x Ncoord matrix is ever formed.
+void MOLECULE::lbfgs_step() {
+  int dim = Ncoord();
+  double *fq = p_Opt_data->g_forces_pointer();
+  double *dq = p_Opt_data->g_dq_pointer();
+
+  oprintf_out("\tTaking L-BFGS optimization step.\n");
+
+  int step_this = p_Opt_data->nsteps() - 1;
+  int step_first = step_this - Opt_params.lbfgs_memory;
+  if (step_first < 0) step_first = 0;
+
+  // internal coordinate values at each remembered geometry
+  double *x = p_Opt_data->g_geom_const_pointer(step_this);
+  set_geom_array(x);
+  double *q = coord_values();
+  fix_tors_near_180();
+  fix_oofp_near_180();
+
+  // correction pairs, most recent first
+  std::vector<double *> s, y;
+  std::vector<double> rho;
+
+  double *q_new = q;
+  for (int i_step=step_this; i_step>step_first; --i_step) {
+    set_geom_array(p_Opt_data->g_geom_const_pointer(i_step-1));
+    double *q_old = coord_values();
+
+    double *f_new = p_Opt_data->g_forces_pointer(i_step);
+    double *f_old = p_Opt_data->g_forces_pointer(i_step-1);
+
+    double *s_k = init_array(dim);
+    double *y_k = init_array(dim);
+    for (int i=0; i<dim; ++i) {
+      s_k[i] = q_new[i] - q_old[i];
+      y_k[i] = (-1.0) * (f_new[i] - f_old[i]); // gradients -- not forces!
+    }
+
+    if (q_new != q) free_array(q_new);
+    q_new = q_old;
+
+    double sy = array_dot(s_k, y_k, dim);
+    if (sy < Opt_params.H_update_den_tol) {
+      oprintf_out("\tCurvature condition not satisfied; skipping step %d.\n", i_step+1);
+      free_array(s_k);
+      free_array(y_k);
+      continue;
+    }
+
+    // same filter as the BFGS Hessian update: large steps leave the quadratic region
+    double max_change = array_abs_max(s_k, dim);
+    if (max_change > Opt_params.H_update_dq_tol) {
+      oprintf_out("\tChange in internal coordinate of %5.2e exceeds limit of %5.2e.\n", max_change,
+        Opt_params.H_update_dq_tol);
+      oprintf_out("\t Skipping step %d.\n", i_step+1);
+      free_array(s_k);
+      free_array(y_k);
+      continue;
+    }
+    s.push_back(s_k);
+    y.push_back(y_k);
+    rho.push_back(1.0 / sy);
+  }
+  if (q_new != q) free_array(q_new);
+  free_array(q);
+
+  // put original geometry back into molecule object
+  set_geom_array(x);
+
+  oprintf_out("\tNumber of correction pairs used in L-BFGS step: %zu\n", s.size());
+
+  // two-loop recursion: dq = H^-1 f
+  array_copy(fq, dq, dim);
+
+  if (s.empty()) {
+    for (int i=0; i<dim; ++i)
+      dq[i] /= Opt_params.sd_hessian;
+  }
+  else {
+    std::vector<double> alpha(s.size());
+    for (std::size_t k=0; k<s.size(); ++k) {
+      alpha[k] = rho[k] * array_dot(s[k], dq, dim);
+      for (int i=0; i<dim; ++i)
+        dq[i] -= alpha[k] * y[k][i];
+    }
+
+    // initial inverse Hessian from the most recent pair
+    double gamma = 1.0 / (rho[0] * array_dot(y[0], y[0], dim));
+    for (int i=0; i<dim; ++i)
+      dq[i] *= gamma;
+
+    for (int k=s.size()-1; k>=0; --k) {
+      double beta = rho[k] * array_dot(y[k], dq, dim);
+      for (int i=0; i<dim; ++i)
+        dq[i] += (alpha[k] - beta) * s[k][i];
+    }
+  }
+
+  for (std::size_t k=0; k<s.size(); ++k) {
+    free_array(s[k]);
+    free_array(y[k]);
+  }
+
+  // Hessian along the step; fall back to steepest descent if not a descent direction
+  double dq_dot_dq = array_dot(dq, dq, dim);
+  double f_dot_dq  = array_dot(fq, dq, dim);
+  if (f_dot_dq <= 0.0 || dq_dot_dq == 0.0) {
+    oprintf_out("\tL-BFGS direction is not downhill; taking steepest-descent step.\n");
+    for (int i=0; i<dim; ++i)
+      dq[i] = fq[i] / Opt_params.sd_hessian;
+    dq_dot_dq = array_dot(dq, dq, dim);
+    f_dot_dq  = array_dot(fq, dq, dim);
+  }
+  double lbfgs_h = (dq_dot_dq > 0.0) ? f_dot_dq / dq_dot_dq : Opt_params.sd_hessian;
+
+  // Zero steps for frozen fragment
+  for (std::size_t f=0; f<fragments.size(); ++f) {
+    if (fragments[f]->is_frozen() || Opt_params.freeze_intrafragment) {
+      oprintf_out("\tZero'ing out displacements for frozen fragment %zu\n", f+1);
+      for (int i=0; i<fragments[f]->Ncoord(); ++i)
+        dq[ g_coord_offset(f) + i ] = 0.0;
+    }
+  }
+
+  apply_intrafragment_step_limit(dq);
+
+  // norm of step
+  double lbfgs_dqnorm = sqrt( array_dot(dq, dq, dim) );
+
+  oprintf_out("\tNorm of target step-size %10.5lf\n", lbfgs_dqnorm);
+
+  // unit vector in step direction
+  double *lbfgs_u = init_array(dim);
+  array_copy(dq, lbfgs_u, dim);
+  array_normalize(lbfgs_u, dim);
+
+  // gradient in step direction
+  double lbfgs_g = - array_dot(fq, lbfgs_u, dim);
+
+  double DE_projected = DE_quadratic_energy(lbfgs_dqnorm, lbfgs_g, lbfgs_h);
+  oprintf_out("\tProjected energy change: %20.10lf\n", DE_projected);
+
+  std::vector<int> lin_angles = validate_angles(dq);
+  if (!lin_angles.empty())
+    throw(INTCO_EXCEPT("New linear angles", lin_angles));
+
+  // do displacements for each fragment separately
+  for (std::size_t f=0; f<fragments.size(); ++f) {
+    if (fragments[f]->is_frozen() || Opt_params.freeze_intrafragment) {
+      oprintf_out("\tDisplacements for frozen fragment %zu skipped.\n", f+1);
+      continue;
+    }
+    fragments[f]->displace(&(dq[g_coord_offset(f)]), &(fq[g_coord_offset(f)]), g_atom_offset(f));
+  }
+
+  // do displacements for interfragment coordinates
+  for (std::size_t I=0; I<interfragments.size(); ++I) {
+    if (interfragments[I]->is_frozen() || Opt_params.freeze_interfragment) {
+      oprintf_out("\tDisplacements for frozen interfragment %zu skipped.\n", I+1);
+      continue;
+    }
+    interfragments[I]->orient_fragment( &(dq[g_interfragment_coord_offset(I)]),
+                                        &(fq[g_interfragment_coord_offset(I)]) );
+  }
+
+  // fix rotation matrix for rotations in QCHEM EFP code
+  for (std::size_t I=0; I<fb_fragments.size(); ++I)
+    fb_fragments[I]->displace( I, &(dq[g_fb_fragment_coord_offset(I)]) );
+
+  symmetrize_geom(); // now symmetrize the geometry for next step
+
+  // save values in step data
+  p_Opt_data->save_step_info(DE_projected, lbfgs_u, lbfgs_dqnorm, lbfgs_g, lbfgs_h);
+
+  free_array(lbfgs_u);
+}
+
+}
@@ -596,7 +596,8 @@ void STEP_DATA::write(int istep, int Nintco, int Ncart) {
 OPT_DATA::OPT_DATA(int Nintco_in, int Ncart_in) {
   Nintco = Nintco_in;
   Ncart = Ncart_in;
-  H = init_matrix(Nintco, Nintco);
+  // Limited-memory steps work from the step history alone and never store a Hessian.
+  H = (Opt_params.step_type == OPT_PARAMS::LBFGS) ? nullptr : init_matrix(Nintco, Nintco);
   rfo_eigenvector = init_array(Nintco);
 
   bool data_file_present = opt_io_is_present(); // determine if old data file is present
@@ -625,7 +626,8 @@ OPT_DATA::OPT_DATA(int Nintco_in, int Ncart_in) {
       opt_io_close(0); // close and delete
     }
     else { // read in old optimization data
-      opt_io_read_entry("H", (char *) H[0], sizeof(double) * Nintco * Nintco);
+      if (H != nullptr)
+        opt_io_read_entry("H", (char *) H[0], sizeof(double) * Nintco * Nintco);
       opt_io_read_entry("iteration", (char *) &iteration, sizeof(int));
       opt_io_read_entry("steps_since_last_H", (char *) &steps_since_last_H, sizeof(int));
       opt_io_read_entry("consecutive_backsteps", (char *) &consecutive_backsteps, sizeof(int));
@@ -653,7 +655,8 @@ void OPT_DATA::write() {
   oprintf_out("\tWriting optimization data to binary file.\n");
   opt_io_write_entry("Nintco", (char *) &Nintco, sizeof(int));
   opt_io_write_entry("Ncart" , (char *) &Ncart , sizeof(int));
-  opt_io_write_entry("H", (char *) H[0],  sizeof(double) * Nintco * Nintco);
+  if (H != nullptr)
+    opt_io_write_entry("H", (char *) H[0],  sizeof(double) * Nintco * Nintco);
   opt_io_write_entry("iteration", (char *) &iteration, sizeof(int));
   opt_io_write_entry("steps_since_last_H", (char *) &steps_since_last_H, sizeof(int));
   opt_io_write_entry("consecutive_backsteps", (char *) &consecutive_backsteps, sizeof(int));
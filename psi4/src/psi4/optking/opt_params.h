@@ -72,7 +72,8 @@ struct OPT_PARAMS {
 
   enum OPT_TYPE {MIN, TS, IRC} opt_type;
   // Newton-Raphson (NR), rational function optimization step, steepest descent step
-  enum STEP_TYPE {NR, RFO, P_RFO, SD, LINESEARCH_STATIC} step_type;
+  enum STEP_TYPE {NR, RFO, P_RFO, SD, LINESEARCH_STATIC, LBFGS} step_type;
+  int lbfgs_memory; // number of previous steps kept for the limited-memory BFGS step
 
   // Coordinates for optimization
   enum COORDINATES {REDUNDANT, DELOCALIZED, NATURAL, CARTESIAN, BOTH} coordinates;
@@ -181,6 +182,12 @@ struct OPT_PARAMS {
   // rms and max change in cartesian coordinates in backtransformation
   double bt_dx_conv;
 
+  // use a sparse B matrix and conjugate-gradient solves in place of (B B^t)^-1
+  bool sparse_B;
+  // relative residual and maximum iterations of those conjugate-gradient solves
+  double cg_conv;
+  int cg_max_iter;
+
   // give up on backtransformation iterations if change rms from one iteration to the
   // next is below this value
   double bt_dx_conv_rms_change;
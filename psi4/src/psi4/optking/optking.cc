@@ -280,7 +280,8 @@ OptReturnType optking(void) {
 
   bool read_H_worked = false;
 
-  if (Opt_params.step_type != OPT_PARAMS::SD) {  // ignore all hessian stuff if SD
+  // ignore all hessian stuff if SD or L-BFGS
+  if (Opt_params.step_type != OPT_PARAMS::SD && Opt_params.step_type != OPT_PARAMS::LBFGS) {
 
     if (Opt_params.H_guess_every) { // ignore Hessian already present
         mol1->H_guess(); // empirical model guess Hessian
@@ -311,7 +312,7 @@ OptReturnType optking(void) {
         return OptReturnFailure;
       }
     }
-  } // end !steepest descent
+  } // end !steepest descent and !L-BFGS
 
   // Increase number of steps since last Hessian by 1 unless we read in a new one
   if (read_H_worked)
@@ -336,6 +337,8 @@ OptReturnType optking(void) {
       mol1->prfo_step();
     else if (Opt_params.step_type == OPT_PARAMS::SD)
       mol1->sd_step();
+    else if (Opt_params.step_type == OPT_PARAMS::LBFGS)
+      mol1->lbfgs_step();
     else if (Opt_params.step_type == OPT_PARAMS::LINESEARCH_STATIC) {
       // compute geometries and then quit
       mol1->linesearch_step();
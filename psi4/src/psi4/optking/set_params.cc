@@ -78,6 +78,7 @@ void set_params(void)
       else if (s == "NR") Opt_params.step_type = OPT_PARAMS::NR;
       else if (s == "SD") Opt_params.step_type = OPT_PARAMS::SD;
       else if (s == "LINESEARCH_STATIC") Opt_params.step_type = OPT_PARAMS::LINESEARCH_STATIC;
+      else if (s == "LBFGS") Opt_params.step_type = OPT_PARAMS::LBFGS;
    }
    else { // Set defaults for step type.
      if (Opt_params.opt_type == OPT_PARAMS::MIN)
@@ -121,6 +122,12 @@ void set_params(void)
 // step to cartesians.
     Opt_params.ensure_bt_convergence = options.get_bool("ENSURE_BT_CONVERGENCE");
 
+// Use a sparse B matrix and iterative solves instead of inverting G = B B^t; for large molecules.
+    Opt_params.sparse_B = options.get_bool("SPARSE_B_MATRIX");
+
+// Number of previous steps kept for the L-BFGS step
+    Opt_params.lbfgs_memory = options.get_int("LBFGS_MEMORY");
+
 // do stupid, linear scaling of internal coordinates to step limit (not RS-RFO);
     Opt_params.simple_step_scaling = options.get_bool("SIMPLE_STEP_SCALING");
 
@@ -516,6 +523,9 @@ void set_params(void)
   // step to cartesians.
   Opt_params.ensure_bt_convergence = rem_read("REM_GEOM_OPT2_ENSURE_BT_CONVERGENCE");
 
+  Opt_params.sparse_B = false;
+  Opt_params.lbfgs_memory = 10;
+
 // follow root   (default 0)
   Opt_params.rfo_follow_root = rem_read(REM_GEOM_OPT2_RFO_FOLLOW_ROOT);
 
@@ -761,6 +771,10 @@ void set_params(void)
   //Opt_params.bt_dx_conv = 1.0e-10;
   //Opt_params.bt_dx_conv_rms_change = 1.0e-14;
 
+// Parameters that control the conjugate-gradient solves with a sparse B matrix
+  Opt_params.cg_conv = 1.0e-12;
+  Opt_params.cg_max_iter = 1000;
+
 
 // Hessian update is avoided if any internal coordinate has changed by more than this in radians/au
   Opt_params.H_update_dq_tol = 0.5;
@@ -977,6 +991,8 @@ void print_params_out() {
   oprintf_out( "step_type              = %18s\n", "P_RFO");
   else if (Opt_params.step_type == OPT_PARAMS::LINESEARCH_STATIC)
   oprintf_out( "step_type              = %18s\n", "Static linesearch");
+  else if (Opt_params.step_type == OPT_PARAMS::LBFGS)
+  oprintf_out( "step_type              = %18s\n", "L-BFGS");
 
   if (Opt_params.coordinates == OPT_PARAMS::REDUNDANT)
   oprintf_out( "opt. coordinates       = %18s\n", "Redundant Internals");
@@ -1023,6 +1039,8 @@ void print_params_out() {
   oprintf_out( "H_update               = %18s\n", "Bofill");
 
   oprintf_out( "H_update_use_last      = %18d\n", Opt_params.H_update_use_last);
+  oprintf_out( "lbfgs_memory           = %18d\n", Opt_params.lbfgs_memory);
+  oprintf_out( "sparse_B               = %18s\n", Opt_params.sparse_B ? "true" : "false");
 
   if (Opt_params.freeze_intrafragment)
   oprintf_out( "freeze_intrafragment   = %18s\n", "true");
@@ -0,0 +1,131 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*! \file    sparse_matrix.cc
+    \ingroup optking
+    \brief   compressed row matrix and CGLS solver
+*/
+
+#include "package.h"
+
+#include "sparse_matrix.h"
+
+#include "linear_algebra.h"
+
+#if defined(OPTKING_PACKAGE_PSI)
+ #include <cmath>
+#elif defined (OPTKING_PACKAGE_QCHEM)
+ #include "qcmath.h"
+#endif
+
+namespace opt {
+
+void SPARSE_MATRIX::add_row(const double *row, const std::vector<int> & cols) {
+  for (std::size_t k=0; k<cols.size(); ++k) {
+    if (row[cols[k]] != 0.0) {
+      col.push_back(cols[k]);
+      val.push_back(row[cols[k]]);
+    }
+  }
+  row_start.push_back(val.size());
+  ++nrow;
+}
+
+void SPARSE_MATRIX::multiply(const double *x, double *y) const {
+  for (int i=0; i<nrow; ++i) {
+    double tval = 0.0;
+    for (int k=row_start[i]; k<row_start[i+1]; ++k)
+      tval += val[k] * x[col[k]];
+    y[i] = tval;
+  }
+}
+
+void SPARSE_MATRIX::transpose_multiply(const double *x, double *y) const {
+  for (int j=0; j<ncol; ++j)
+    y[j] = 0.0;
+  for (int i=0; i<nrow; ++i)
+    for (int k=row_start[i]; k<row_start[i+1]; ++k)
+      y[col[k]] += val[k] * x[i];
+}
+
+bool SPARSE_MATRIX::least_squares(const double *b, double *x, bool transpose, double tol,
+  int max_iter) const {
+
+  // Operator M is A, or A^t; solve min |M x - b| starting from x = 0
+  int m = transpose ? ncol : nrow;  // dimension of b
+  int n = transpose ? nrow : ncol;  // dimension of x
+
+  std::vector<double> r(b, b + m);
+  std::vector<double> s(n), p(n), q(m);
+
+  auto apply = [&](const double *in, double *out) {
+    if (transpose) transpose_multiply(in, out);
+    else multiply(in, out);
+  };
+  auto apply_t = [&](const double *in, double *out) {
+    if (transpose) multiply(in, out);
+    else transpose_multiply(in, out);
+  };
+
+  for (int j=0; j<n; ++j)
+    x[j] = 0.0;
+
+  apply_t(r.data(), s.data());
+  p = s;
+  double gamma = array_dot(s.data(), s.data(), n);
+  double gamma_0 = gamma;
+
+  if (gamma_0 == 0.0)  // b is orthogonal to the range of M
+    return true;
+
+  for (int iter=0; iter<max_iter; ++iter) {
+    apply(p.data(), q.data());
+    double qq = array_dot(q.data(), q.data(), m);
+    if (qq == 0.0)
+      return false;
+
+    double alpha = gamma / qq;
+    for (int j=0; j<n; ++j)
+      x[j] += alpha * p[j];
+    for (int i=0; i<m; ++i)
+      r[i] -= alpha * q[i];
+
+    apply_t(r.data(), s.data());
+    double gamma_new = array_dot(s.data(), s.data(), n);
+    if (std::sqrt(gamma_new / gamma_0) < tol)
+      return true;
+
+    double beta = gamma_new / gamma;
+    for (int j=0; j<n; ++j)
+      p[j] = s[j] + beta * p[j];
+    gamma = gamma_new;
+  }
+  return false;
+}
+
+}
@@ -0,0 +1,79 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2019 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This file is part of Psi4.
+ *
+ * Psi4 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * Psi4 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along
+ * with Psi4; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*! \file sparse_matrix.h
+    \ingroup optking
+    \brief sparse (compressed row) matrix for B matrices of large molecules, and
+           conjugate-gradient least-squares solves with it
+*/
+
+#ifndef _opt_sparse_matrix_h_
+#define _opt_sparse_matrix_h_
+
+#include <vector>
+
+namespace opt {
+
+class SPARSE_MATRIX {
+
+  int nrow;
+  int ncol;
+  std::vector<int> row_start;  // offset of first element of each row; size nrow+1
+  std::vector<int> col;        // column index of each element
+  std::vector<double> val;     // value of each element
+
+  public:
+
+  SPARSE_MATRIX(int ncol_in = 0) : nrow(0), ncol(ncol_in), row_start(1, 0) { }
+
+  // Append a row, keeping only the nonzero elements of the dense row at the listed columns.
+  void add_row(const double *row, const std::vector<int> & cols);
+
+  // Append a row of zeroes.
+  void add_empty_row() { row_start.push_back(val.size()); ++nrow; }
+
+  int g_nrow() const { return nrow; }
+  int g_ncol() const { return ncol; }
+  std::size_t g_nnz() const { return val.size(); }
+
+  // y = A x
+  void multiply(const double *x, double *y) const;
+
+  // y = A^t x
+  void transpose_multiply(const double *x, double *y) const;
+
+  // Minimum-norm least-squares solution of A x = b (transpose=false), or of A^t x = b (transpose=true),
+  // by conjugate gradients on the normal equations (CGLS).  Equivalent to x = A^t (A A^t)^-1 b,
+  // resp. x = (A A^t)^-1 A b, with generalized inverses, but never forms A A^t.  Returns whether the
+  // relative residual of the normal equations fell below tol.
+  bool least_squares(const double *b, double *x, bool transpose, double tol, int max_iter) const;
+};
+
+}
+
+#endif
@@ -66,6 +66,7 @@ class CCBLAS {
     typedef std::vector<int> intvec;
     typedef std::vector<std::pair<int, int> > intpairvec;
     typedef std::deque<CCOperation> OpDeque;
+    typedef std::map<std::string, std::vector<CCOperation> > OpCache;
 
     CCBLAS(Options& options);
     ~CCBLAS();
@@ -131,6 +132,7 @@ class CCBLAS {
     MatrixMap matrices;
     IndexMap indices;
     OpDeque operations;
+    OpCache parsed_operations;
     ArrayVec work;
     ArrayVec buffer;
     MatCnt matrices_in_deque;
@@ -159,6 +161,7 @@ class CCBLAS {
     void solve_ref(std::string& str);
     int parse(std::string& str);
     void process_operations();
+    void compute_scheduled();
     void process_reduce_spaces(CCMatrix* out_Matrix, CCMatrix* in_Matrix);
     void process_expand_spaces(CCMatrix* out_Matrix, CCMatrix* in_Matrix);
     bool get_factor(const std::string& str, double& factor);
@@ -26,7 +26,14 @@
  * @END LICENSE
  */
 
+#include <algorithm>
 #include <cstdio>
+#include <map>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "psi4/libmoinfo/libmoinfo.h"
 
 #include "blas.h"
@@ -66,7 +73,9 @@ void CCBLAS::append(const char* cstr) {
 }
 
 /**
- * Read and store expressions without computing them
+ * Read and store expressions without computing them.
+ * Expressions are parsed only the first time they are seen, afterwards the
+ * operations are taken from parsed_operations.
  * @param str
  */
 void CCBLAS::append(std::string str) {
@@ -76,7 +85,17 @@ void CCBLAS::append(std::string str) {
               outfile->Printf("\n\nCCBLAS::append() has parsed the following:");)
     std::vector<std::string> names = moinfo->get_matrix_names(str);
     for (int n = 0; n < names.size(); n++) {
-        noperations_added += parse(names[n]);
+        OpCache::iterator cached = parsed_operations.find(names[n]);
+        if (cached != parsed_operations.end()) {
+            operations.insert(operations.end(), cached->second.begin(), cached->second.end());
+            noperations_added += cached->second.size();
+        } else {
+            int nparsed = parse(names[n]);
+            noperations_added += nparsed;
+            // Scalars named "factor..." are read at parse time, so these expressions cannot be reused
+            if (names[n].find("factor") == std::string::npos)
+                parsed_operations[names[n]] = std::vector<CCOperation>(operations.end() - nparsed, operations.end());
+        }
     }
 }
 
@@ -193,6 +212,13 @@ void CCBLAS::compute() {
             matrices_in_deque_source[it->get_C_Matrix()]++;
         }
     }
+    // With all the matrices in core and more than one thread available run
+    // the independent operations concurrently
+    if (full_in_core && work.size() > 1 && operations.size() > 1) {
+        compute_scheduled();
+        return;
+    }
+
     while (!operations.empty()) {
         // Read the element
         CCOperation& op = operations.front();
@@ -217,6 +243,79 @@ void CCBLAS::compute() {
     }
 }
 
+/**
+ * Flush the operation deque executing independent operations concurrently.
+ * The deque is turned into a dependency graph: an operation waits for the last
+ * operation that wrote any of its matrices, and an operation that writes a
+ * matrix also waits for every earlier operation that read it.  The graph is then
+ * executed level by level, each level being distributed over CC_NUM_THREADS
+ * threads that use their own work and buffer arrays.  This is only called when
+ * all the matrices are in core, so that make_space() never has to free memory.
+ */
+void CCBLAS::compute_scheduled() {
+    int noperations = operations.size();
+    std::vector<int> level(noperations, 0);
+    std::map<CCMatrix*, int> last_writer;
+    std::map<CCMatrix*, std::vector<int> > readers;
+    int nlevels = 0;
+    for (int n = 0; n < noperations; ++n) {
+        CCOperation& op = operations[n];
+        CCMatrix* target = op.get_A_Matrix();
+        CCMatrix* used[3] = {target, op.get_B_Matrix(), op.get_C_Matrix()};
+        // Wait for the last write to any matrix used by this operation
+        for (int m = 0; m < 3; ++m) {
+            if (used[m] == nullptr) continue;
+            std::map<CCMatrix*, int>::iterator writer = last_writer.find(used[m]);
+            if (writer != last_writer.end()) level[n] = std::max(level[n], level[writer->second] + 1);
+        }
+        // Wait for all the reads of the target since its last write
+        std::vector<int>& target_readers = readers[target];
+        for (size_t r = 0; r < target_readers.size(); ++r)
+            level[n] = std::max(level[n], level[target_readers[r]] + 1);
+        for (int m = 1; m < 3; ++m)
+            if (used[m] != nullptr) readers[used[m]].push_back(n);
+        target_readers.clear();
+        last_writer[target] = n;
+        nlevels = std::max(nlevels, level[n] + 1);
+    }
+
+    std::vector<std::vector<int> > schedule(nlevels);
+    for (int n = 0; n < noperations; ++n) schedule[level[n]].push_back(n);
+
+    int nthreads = work.size();
+    for (int l = 0; l < nlevels; ++l) {
+        std::vector<int>& level_operations = schedule[l];
+        int nlevel_operations = level_operations.size();
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+        for (int n = 0; n < nlevel_operations; ++n) {
+            int thread = 0;
+#ifdef _OPENMP
+            thread = omp_get_thread_num();
+#endif
+            CCOperation& op = operations[level_operations[n]];
+            op.set_work(work[thread], buffer[thread]);
+            op.compute();
+        }
+    }
+
+    // Decrease the counters for the matrices processed
+    for (OpDeque::iterator it = operations.begin(); it != operations.end(); ++it) {
+        if (it->get_A_Matrix() != nullptr) {
+            matrices_in_deque[it->get_A_Matrix()]--;
+            matrices_in_deque_target[it->get_A_Matrix()]--;
+        }
+        if (it->get_B_Matrix() != nullptr) {
+            matrices_in_deque[it->get_B_Matrix()]--;
+            matrices_in_deque_source[it->get_B_Matrix()]--;
+        }
+        if (it->get_C_Matrix() != nullptr) {
+            matrices_in_deque[it->get_C_Matrix()]--;
+            matrices_in_deque_source[it->get_C_Matrix()]--;
+        }
+    }
+    operations.clear();
+}
+
 /**
  * store a zero_two_diagonal operation without executing it
  * @param cstr
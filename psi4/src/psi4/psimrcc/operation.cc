@@ -37,8 +37,6 @@ namespace psi {
 
 namespace psimrcc {
 
-double* CCOperation::local_work = nullptr;
-double* CCOperation::out_of_core_buffer = nullptr;
 double CCOperation::zero_timing = 0.0;
 double CCOperation::numerical_timing = 0.0;
 double CCOperation::contract_timing = 0.0;
@@ -59,9 +57,16 @@ CCOperation::CCOperation(double in_factor, std::string in_assignment, std::strin
       assignment(in_assignment),
       reindexing(in_reindexing),
       operation(in_operation),
+      out_of_core_buffer(buffer),
+      local_work(work),
       A_Matrix(in_A_Matrix),
       B_Matrix(in_B_Matrix),
-      C_Matrix(in_C_Matrix) {
+      C_Matrix(in_C_Matrix) {}
+
+/**
+ * Point the operation to the scratch arrays of the thread that will execute it
+ */
+void CCOperation::set_work(double* work, double* buffer) {
     local_work = work;
     out_of_core_buffer = buffer;
 }
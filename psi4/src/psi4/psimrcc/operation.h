@@ -51,6 +51,7 @@ class CCOperation {
     CCMatrix* get_A_Matrix() { return (A_Matrix); }
     CCMatrix* get_B_Matrix() { return (B_Matrix); }
     CCMatrix* get_C_Matrix() { return (C_Matrix); }
+    void set_work(double* work, double* buffer);
     void print();
     void print_operation();
     void compute();
@@ -62,8 +63,8 @@ class CCOperation {
     std::string assignment;  // = += >= +>=
     std::string reindexing;  // ## #pq# #pqrs#
     std::string operation;   // . @ / * X plus
-    static double* out_of_core_buffer;
-    static double* local_work;
+    double* out_of_core_buffer;
+    double* local_work;
     CCMatrix* A_Matrix;
     CCMatrix* B_Matrix;
     CCMatrix* C_Matrix;
@@ -130,6 +130,13 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
     options.add_int("DEBUG", 0);
     /*- Some codes (DFT) can dump benchmarking data to separate output files -*/
     options.add_int("BENCH", 0);
+    /*- On-disk format for integral files written through libiwl (e.g. the SO and MO
+    two-electron integrals of conventional correlated methods). ``IWL`` stores
+    fixed-size buffers of 16-bit labels and doubles. ``PACKED`` delta-encodes the
+    labels and compresses each buffer. ``QUANTIZED`` additionally rounds every value to
+    a multiple of the integral cutoff, changing it by at most half the cutoff. Files are
+    read in whatever format they were written. -*/
+    options.add_str("INTEGRAL_FILE_FORMAT", "IWL", "IWL PACKED QUANTIZED");
     /*- Wavefunction type !expert -*/
     options.add_str("WFN", "SCF");
     /*- Derivative level !expert -*/
@@ -150,6 +157,13 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
     /*- Integral package to use. If compiled with ERD or Simint support, change this option to use them; LibInt is used
        otherwise. -*/
     options.add_str("INTEGRAL_PACKAGE", "LIBINT", "ERD LIBINT SIMINT");
+    /*- Boys function evaluator for the potential and multipole-potential integrals. TABULATED evaluates it from a
+       shared Taylor table, batched over the charges; SERIES is the power series evaluated per argument. !expert -*/
+    options.add_str("POTENTIAL_BOYS_FUNCTION", "TABULATED", "TABULATED SERIES");
+    /*- Boys function evaluator for the LibInt ERIs. TAYLOR is the per-object table built for the requested
+       accuracy; TABULATED is the shared table of the potential integrals, for up to 32 total angular momentum
+       (including derivative order). !expert -*/
+    options.add_str("ERI_BOYS_FUNCTION", "TAYLOR", "TAYLOR TABULATED");
 
     // Note that case-insensitive options are only functional as
     //   globals, not as module-level, and should be defined sparingly
@@ -1076,6 +1090,10 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
         options.add_double("LOCAL_CONVERGENCE", 1.0E-12);
         /*- Maximum iterations in localization -*/
         options.add_int("LOCAL_MAXITER", 1000);
+        /*- Rotation algorithm in localization. JACOBI sweeps over randomly ordered orbital pairs one at a time,
+        PARALLEL_JACOBI applies round-robin rounds of disjoint pairs across threads, and NEWTON follows the
+        parallel sweeps with trust-region Newton steps once the metric changes slowly -*/
+        options.add_str("LOCAL_ALGORITHM", "JACOBI", "JACOBI PARALLEL_JACOBI NEWTON");
         /*- Use ghost atoms in Pipek-Mezey or IBO metric !expert -*/
         options.add_bool("LOCAL_USE_GHOSTS", false);
         /*- Condition number to use in IBO metric inversions !expert -*/
@@ -1286,6 +1304,16 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
         Useful to produce broken-symmetry unrestricted solutions.
         Notice that this procedure is defined only for calculations in C1 symmetry. -*/
         options.add_bool("GUESS_MIX", false);
+        /*- Form the guess at a new geometry from the converged orbitals of previous geometries of the
+          same system, e.g., for finite-difference displacements and optimization steps. ``PROJECT``
+          orthonormalizes the occupied orbitals of the nearest previous geometry against the new overlap
+          matrix. ``ASPC`` first extrapolates the densities of up to |scf__guess_extrap_history| previous
+          geometries with always-stable predictor-corrector coefficients, which suits optimizations rather
+          than displacements. Overrides |scf__guess| when a previous geometry is available. Only for
+          RHF, UHF, RKS and UKS references. -*/
+        options.add_str("GUESS_EXTRAP", "NONE", "NONE PROJECT ASPC");
+        /*- Number of previous geometries kept for |scf__guess_extrap|. -*/
+        options.add_int("GUESS_EXTRAP_HISTORY", 4);
         /*- Do write a MOLDEN output file?  If so, the filename will end in
         .molden, and the prefix is determined by |globals__writer_file_label|
         (if set), or else by the name of the output file plus the name of
@@ -1570,6 +1598,8 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
         options.add_double("LOCAL_CONVERGENCE", 1E-12);
         /*- The maxiter on the orbital localization procedure -*/
         options.add_int("LOCAL_MAXITER", 200);
+        /*- The rotation algorithm of the orbital localization procedure -*/
+        options.add_str("LOCAL_ALGORITHM", "JACOBI", "JACOBI PARALLEL_JACOBI NEWTON");
         /*- The number of NOONs to print in a UHF calc -*/
         options.add_str("UHF_NOONS", "3");
         /*- Save the UHF NOs -*/
@@ -1659,6 +1689,9 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
         options.add_str("REFERENCE", "RHF");
         /*- The algorithm to use for the $\left\langle VV||VV \right\rangle$ terms -*/
         options.add_str("AO_BASIS", "NONE", "NONE DISK DIRECT");
+        /*- Skip the $\left\langle VV||VV \right\rangle$ integrals for an RHF-CCSD energy with AO_BASIS DIRECT.
+            Set by the driver for plain energy calls only. !expert -*/
+        options.add_bool("DIRECT_VVVV", false);
         /*- Delete the SO two-electron integrals after the transformation? -*/
         options.add_bool("DELETE_TEI", true);
         /*- Caching level for libdpd -*/
@@ -1943,6 +1976,9 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
         options.add_double("SCHMIDT_ADD_RESIDUAL_TOLERANCE", 1E-3);
         /*- Do skip diagonalization of Hbar SS block? -*/
         options.add_bool("SS_SKIP_DIAG", false);
+        /*- Do build the RHF <ab|cd> ladder term of all new sigma vectors of an
+        iteration together, reading the B integrals once per iteration? -*/
+        options.add_bool("EOM_BLOCK_SIGMA", true);
         /*- Do restart from on-disk? -*/
         options.add_bool("RESTART_EOM_CC3", false);
         /*- Specifies a set of single-excitation guess vectors for the EOM-CC
@@ -2136,13 +2172,13 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
         /*- The algorithm to use for the $\left\langle VV||VV\right\rangle$ terms
         If AO_BASIS is ``NONE``, the MO-basis integrals will be used;
         if AO_BASIS is ``DISK``, the AO-basis integrals stored on disk will
-        be used; if AO_BASIS is ``DIRECT``, the AO-basis integrals will be computed
-        on the fly as necessary.  NB: The ``DIRECT`` option is not fully
-        implemented and should only be used by experts.  Default is NONE.
-        Note: The developers recommend use of this keyword only as a last
-        resort because it significantly slows the calculation. The current
-        algorithms for handling the MO-basis four-virtual-index integrals have
-        been significantly improved and are preferable to the AO-based approach.
+        be used; if AO_BASIS is ``DIRECT``, the SO-basis integrals will be computed
+        on the fly, screened against the back-transformed amplitudes, in
+        parallel over OpenMP threads.  ``DIRECT`` is available for RHF
+        references only; for RHF-CCSD and CCSD(T) energies the MO-basis
+        $\langle VV|VV \rangle$ integrals are then never written to disk.
+        Default is NONE.  Note: The MO-basis algorithms are usually faster
+        when the four-virtual-index integrals fit on disk.
         !expert -*/
         options.add_str("AO_BASIS", "NONE", "NONE DISK DIRECT");
         /*- Caching level for libdpd governing the storage of amplitudes,
@@ -2388,7 +2424,10 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
         /*- Specifies minimum search, transition-state search, or IRC following -*/
         options.add_str("OPT_TYPE", "MIN", "MIN TS IRC");
         /*- Geometry optimization step type, either Newton-Raphson or Rational Function Optimization -*/
-        options.add_str("STEP_TYPE", "RFO", "RFO NR SD LINESEARCH_STATIC");
+        options.add_str("STEP_TYPE", "RFO", "RFO NR SD LINESEARCH_STATIC LBFGS");
+        /*- Number of previous steps whose geometry and gradient changes build the
+            inverse Hessian of an L-BFGS step -*/
+        options.add_int("LBFGS_MEMORY", 10);
         /*- Geometry optimization coordinates to use.
             REDUNDANT and INTERNAL are synonyms and the default.
             DELOCALIZED are the coordinates of Baker.
@@ -2419,6 +2458,9 @@ int read_options(const std::string &name, Options &options, bool suppress_printi
         /*- Reduce step size as necessary to ensure back-transformation of internal
             coordinate step to cartesian coordinates. -*/
         options.add_bool("ENSURE_BT_CONVERGENCE", false);
+        /*- Do store the B matrix sparsely and back-transform steps and gradients with
+            conjugate-gradient solves instead of inverting $BB^T$? For large molecules. -*/
+        options.add_bool("SPARSE_B_MATRIX", false);
         /*= Do stupid, linear scaling of internal coordinates to step limit (not RS-RFO) -*/
         options.add_bool("SIMPLE_STEP_SCALING", false);
         /*- Set number of consecutive backward steps allowed in optimization -*/
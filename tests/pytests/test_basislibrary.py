@@ -0,0 +1,64 @@
+import os
+
+import pytest
+
+import psi4
+from psi4.driver import qcdb
+from psi4.driver.qcdb.libmintsbasissetparser import Gaussian94BasisSetParser
+
+pytestmark = pytest.mark.quick
+
+
+@pytest.fixture
+def gbs_file():
+    return os.path.join(os.path.abspath(psi4.core.get_datadir()), 'basis', 'def2-svp.gbs')
+
+
+def test_library_matches_parser(gbs_file, tmp_path):
+    filename = str(tmp_path / 'basislib.bin')
+    parser = Gaussian94BasisSetParser()
+    entries = parser.library_entries(gbs_file)
+    psi4.core.BasisSetLibrary.compile(filename, entries)
+
+    library = psi4.core.BasisSetLibrary(filename)
+    assert library.nsource() == 1
+    assert library.nentry() == len(entries)
+    assert library.current(gbs_file)
+
+    lines = parser.load_file(gbs_file)
+    for symbol in ['H', 'C', 'KR', 'I']:
+        shells, msg, ecp_shells, ecp_msg, ncore = parser.parse(symbol, lines)
+        lshells, lmsg, lecp_shells, lecp_msg, lncore = parser.from_library(library.lookup(gbs_file, symbol))
+        assert [sh.aslist() for sh in shells] == [sh.aslist() for sh in lshells]
+        assert [sh.aslist() for sh in ecp_shells] == [sh.aslist() for sh in lecp_shells]
+        assert (msg, ecp_msg, ncore) == (lmsg, lecp_msg, lncore)
+
+    assert library.lookup(gbs_file, 'XX') is None
+    assert library.lookup(gbs_file + '.missing', 'H') is None
+
+
+def test_library_construct_from_pydict(gbs_file, tmp_path):
+    filename = str(tmp_path / 'basislib.bin')
+    psi4.core.BasisSetLibrary.compile(filename, Gaussian94BasisSetParser().library_entries(gbs_file))
+
+    mol = psi4.geometry("""
+        C 0.0 0.0 0.0
+        H 0.0 0.0 1.1
+        H 0.0 1.1 0.0
+        symmetry c1
+    """)
+    bs, bsdict = qcdb.BasisSet.pyconstruct(mol.to_dict(), 'BASIS', 'def2-svp', return_dict=True)
+    ref = psi4.core.BasisSet.construct_from_pydict(mol, bsdict, -1)
+
+    # Replace the shells with library references, as BasisSet.build does for library entries
+    bsdict['library'] = filename
+    bsdict['shell_map'] = [info[:2] + [gbs_file, mol.symbol(A)] for A, info in enumerate(bsdict['shell_map'])]
+    libbs = psi4.core.BasisSet.construct_from_pydict(mol, bsdict, -1)
+
+    assert libbs.nbf() == ref.nbf()
+    assert libbs.nprimitive() == ref.nprimitive()
+    for Q in range(ref.nshell()):
+        assert libbs.shell(Q).am == ref.shell(Q).am
+        for p in range(ref.shell(Q).nprimitive):
+            assert libbs.shell(Q).exp(p) == ref.shell(Q).exp(p)
+            assert libbs.shell(Q).coef(p) == ref.shell(Q).coef(p)
@@ -0,0 +1,84 @@
+import math
+
+import numpy as np
+import pytest
+
+import psi4
+
+pytestmark = pytest.mark.quick
+
+# Near zero, across the table edge at T = 40, and in the upward-recursion region beyond it
+T_ranges = {
+    'small': [0.0, 1.0e-12, 1.0e-6, 1.0e-3, 0.024, 0.025, 0.026],
+    'table': [1.0, 7.5, 19.99, 20.01, 33.3],
+    'edge': [39.95, 39.975, 39.999, 40.0, 40.001, 40.05],
+    'upward': [45.0, 60.0, 85.5, 120.0],
+}
+
+
+@pytest.mark.parametrize('J', [0, 1, 8, 32])
+@pytest.mark.parametrize('T_range', T_ranges.keys())
+def test_tabulated_boys_function(J, T_range):
+    """Batched, tabulated F_j(T) against the series it is built from"""
+
+    T = T_ranges[T_range]
+    F = np.array(psi4.core.tabulated_boys_function(J, T))
+    ref = np.array([psi4.core.reference_boys_function(J, t) for t in T]).T
+    assert F.shape == (J + 1, len(T))
+    assert np.allclose(F, ref, rtol=1.0e-13, atol=0.0)
+
+    # F_0(T) in closed form
+    F0 = [1.0 if t == 0.0 else 0.5 * math.sqrt(math.pi / t) * math.erf(math.sqrt(t)) for t in T]
+    assert np.allclose(F[0], F0, rtol=1.0e-13, atol=0.0)
+
+
+def test_tabulated_boys_function_max_j():
+    with pytest.raises(RuntimeError):
+        psi4.core.tabulated_boys_function(33, [1.0])
+
+
+@pytest.fixture
+def mints():
+    mol = psi4.geometry("""
+    O
+    H 1 1.0
+    H 1 1.0 2 104.5
+    Ne 0 0 25
+    symmetry c1
+    no_com
+    no_reorient
+    """)
+    return psi4.core.MintsHelper(psi4.core.BasisSet.build(mol, 'ORBITAL', 'aug-cc-pvtz'))
+
+
+def test_potential_boys_function(mints):
+    """Potential and ESP integrals with the table match the series evaluation"""
+
+    origin = [0.3, -1.2, 2.0]
+    tabulated = [np.asarray(mints.ao_potential())]
+    tabulated += [np.asarray(m) for m in mints.ao_multipole_potential(origin=origin, max_k=2)]
+
+    psi4.set_options({'potential_boys_function': 'series'})
+    series = [np.asarray(mints.ao_potential())]
+    series += [np.asarray(m) for m in mints.ao_multipole_potential(origin=origin, max_k=2)]
+
+    assert len(tabulated) == len(series)
+    for t, s in zip(tabulated, series):
+        assert psi4.compare_arrays(s, t, 9, 'Potential integrals, tabulated Boys function')
+
+
+def test_eri_boys_function():
+    """ERIs are selectable between the Taylor and the tabulated Boys function"""
+
+    mol = psi4.geometry("""
+    O
+    H 1 1.0
+    H 1 1.0 2 104.5
+    symmetry c1
+    """)
+    mints = psi4.core.MintsHelper(psi4.core.BasisSet.build(mol, 'ORBITAL', 'cc-pvdz'))
+    taylor = np.asarray(mints.ao_eri())
+
+    psi4.set_options({'eri_boys_function': 'tabulated'})
+    tabulated = np.asarray(mints.ao_eri())
+    assert psi4.compare_arrays(taylor, tabulated, 12, 'ERIs, tabulated Boys function')
@@ -0,0 +1,64 @@
+import pytest
+
+import psi4
+
+pytestmark = pytest.mark.quick
+
+
+@pytest.fixture
+def water_dimer():
+    psi4.core.clean()
+    psi4.core.clean_options()
+    psi4.set_options({'basis': 'sto-3g', 'scf_type': 'pk', 'e_convergence': 10, 'd_convergence': 10})
+    return psi4.geometry("""
+        O  -1.551007  -0.114520   0.000000
+        H  -1.934259   0.762503   0.000000
+        H  -0.599677   0.040712   0.000000
+        --
+        O   1.350625   0.111469   0.000000
+        H   1.680398  -0.373741  -0.758561
+        H   1.680398  -0.373741   0.758561
+        symmetry c1
+        no_com
+        no_reorient
+    """)
+
+
+def test_nbody_concurrent_matches_serial(water_dimer):
+    """CP-corrected interaction energy, serial vs. two concurrent workers"""
+
+    serial = psi4.energy('scf', bsse_type='cp', molecule=water_dimer)
+    concurrent = psi4.energy('scf', bsse_type='cp', molecule=water_dimer, concurrent_tasks=2)
+
+    assert psi4.compare_values(serial, concurrent, 9, 'concurrent n-body CP IE')
+
+
+def test_findif_concurrent_matches_serial(water_dimer):
+    """Finite difference of energies gradient, serial vs. four concurrent workers"""
+
+    monomer = water_dimer.extract_subsets(1)
+    monomer.fix_com(True)
+    monomer.fix_orientation(True)
+
+    serial = psi4.gradient('scf', dertype=0, molecule=monomer)
+    concurrent = psi4.gradient('scf', dertype=0, molecule=monomer, concurrent_tasks=4)
+
+    assert psi4.compare_matrices(serial, concurrent, 7, 'concurrent findif gradient')
+
+
+def test_custom_basis_runs_serial(water_dimer):
+    """A basis {...} block only exists in the calling process, so tasks stay serial"""
+
+    from psi4.driver import driver, driver_concurrent
+
+    assert driver_concurrent.task_is_portable(driver.energy, {})
+
+    psi4.basis_helper("""
+        assign sto-3g
+    """, name='mysto')
+    assert not driver_concurrent.task_is_portable(driver.energy, {})
+
+    serial = psi4.energy('scf', bsse_type='cp', molecule=water_dimer)
+    concurrent = psi4.energy('scf', bsse_type='cp', molecule=water_dimer, concurrent_tasks=2)
+
+    assert psi4.compare_values(serial, concurrent, 9, 'custom basis n-body CP IE')
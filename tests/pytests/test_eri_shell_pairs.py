@@ -0,0 +1,47 @@
+import numpy as np
+import pytest
+
+import psi4
+
+pytestmark = pytest.mark.quick
+
+
+@pytest.fixture
+def basis():
+    mol = psi4.geometry("""
+    O
+    H 1 1.0
+    H 1 1.0 2 104.5
+    symmetry c1
+    """)
+    return psi4.core.BasisSet.build(mol, 'ORBITAL', 'cc-pvdz')
+
+
+def test_shell_pairs_shared(basis):
+    """ERI objects on the same basis pair use one shell pair data instance"""
+
+    factory = psi4.core.IntegralFactory(basis)
+    eri1 = factory.eri()
+    eri2 = factory.eri()
+    assert eri1.shares_shell_pairs(eri2)
+
+    # A second factory on the same basis sets shares it too
+    eri3 = psi4.core.IntegralFactory(basis).eri()
+    assert eri1.shares_shell_pairs(eri3)
+
+    # Different basis sets do not
+    other = psi4.core.BasisSet.build(basis.molecule(), 'ORBITAL', 'sto-3g')
+    eri4 = psi4.core.IntegralFactory(other).eri()
+    assert not eri1.shares_shell_pairs(eri4)
+
+
+def test_shared_shell_pairs_integrals(basis):
+    """Integrals do not depend on which object built the shared data"""
+
+    mints = psi4.core.MintsHelper(basis)
+    ref = np.asarray(mints.ao_eri())
+    factory = psi4.core.IntegralFactory(basis)
+    eris = [factory.eri() for _ in range(2)]
+    test = np.asarray(mints.ao_eri(psi4.core.IntegralFactory(basis)))
+    assert eris[0].shares_shell_pairs(eris[1])
+    assert psi4.compare_arrays(ref, test, 12, 'ERI with shared shell pairs')
@@ -0,0 +1,52 @@
+import numpy as np
+import pytest
+
+import psi4
+from psi4.driver.procrouting.scf_proc import geometry_guess
+
+pytestmark = pytest.mark.quick
+
+
+def test_aspc_coefficients():
+    assert np.allclose(geometry_guess.aspc_coefficients(2), [2.0, -1.0])
+    assert np.allclose(geometry_guess.aspc_coefficients(3), [2.5, -2.0, 0.5])
+    for npoint in range(1, 6):
+        assert np.isclose(np.sum(geometry_guess.aspc_coefficients(npoint)), 1.0)
+
+
+@pytest.mark.parametrize("reference", ["rhf", "uhf"])
+def test_projected_guess(reference):
+    geometry_guess.clear()
+    psi4.set_options({
+        'basis': 'cc-pvdz',
+        'scf_type': 'pk',
+        'reference': reference,
+        'e_convergence': 10,
+        'd_convergence': 8,
+    })
+
+    # Fixed frame, so the stored geometries compare directly with the new one
+    h2o = """
+    0 1
+    O
+    H 1 %f
+    H 1 %f 2 104.5
+    no_reorient
+    no_com
+    """
+
+    psi4.set_options({'guess_extrap': 'none'})
+    psi4.geometry(h2o % (0.96, 0.97))
+    ref_energy, ref_wfn = psi4.energy('scf', return_wfn=True)
+    sad_iterations = ref_wfn.variable('SCF ITERATIONS')
+
+    psi4.set_options({'guess_extrap': 'project'})
+    psi4.geometry(h2o % (0.96, 0.96))
+    psi4.energy('scf')
+
+    psi4.geometry(h2o % (0.96, 0.97))
+    energy, wfn = psi4.energy('scf', return_wfn=True)
+
+    # guess projected from the orbitals of the symmetric geometry
+    assert psi4.compare_values(ref_energy, energy, 8, 'Extrapolated guess energy')
+    assert wfn.variable('SCF ITERATIONS') < sad_iterations
@@ -0,0 +1,73 @@
+import pytest
+
+import numpy as np
+
+import psi4
+
+pytestmark = pytest.mark.quick
+
+
+@pytest.fixture
+def water_wfn():
+    psi4.core.clean()
+    psi4.core.clean_options()
+    psi4.set_options({'basis': 'cc-pvdz', 'scf_type': 'pk', 'e_convergence': 10, 'd_convergence': 10})
+    mol = psi4.geometry("""
+        O
+        H 1 1.0
+        H 1 1.0 2 104.5
+        symmetry c1
+    """)
+    e, wfn = psi4.energy('scf', molecule=mol, return_wfn=True)
+    return wfn
+
+
+def boys_metric(wfn, L):
+    mints = psi4.core.MintsHelper(wfn.basisset())
+    L = np.asarray(L)
+    return sum(np.sum(np.diag(L.T @ np.asarray(D) @ L)**2) for D in mints.ao_dipole())
+
+
+def pm_metric(wfn, L):
+    basis = wfn.basisset()
+    S = np.asarray(psi4.core.MintsHelper(basis).ao_overlap())
+    L = np.asarray(L)
+    LS = S @ L
+    centers = np.array([basis.function_to_center(m) for m in range(basis.nbf())])
+    natom = basis.molecule().natom()
+    return sum(np.sum(np.einsum('mi,mi->i', LS[centers == A], L[centers == A])**2) for A in range(natom))
+
+
+@pytest.mark.parametrize("local_type,metric", [("BOYS", boys_metric), ("PIPEK_MEZEY", pm_metric)])
+@pytest.mark.parametrize("algorithm", ["PARALLEL_JACOBI", "NEWTON"])
+def test_localizer_algorithms(water_wfn, local_type, metric, algorithm):
+    """Round-robin and trust-region Newton localizers reach the serial Jacobi maximum"""
+
+    def localize(algo):
+        loc = psi4.core.Localizer.build(local_type, water_wfn.basisset(), water_wfn.Ca_subset("AO", "OCC"))
+        loc.set_convergence(1.e-12)
+        loc.set_maxiter(200)
+        loc.set_algorithm(algo)
+        loc.localize()
+        assert loc.converged
+        return loc
+
+    ref = localize("JACOBI")
+    loc = localize(algorithm)
+
+    assert psi4.compare_values(metric(water_wfn, ref.L), metric(water_wfn, loc.L), 8,
+                               local_type + ' metric ' + algorithm)
+
+    # The localized orbitals span the occupied space
+    U = np.asarray(loc.U)
+    assert psi4.compare_arrays(np.eye(U.shape[0]), U.T @ U, 10, 'U orthogonal')
+
+
+def test_localizer_algorithm_names(water_wfn):
+    loc = psi4.core.Localizer.build("BOYS", water_wfn.basisset(), water_wfn.Ca_subset("AO", "OCC"))
+    loc.set_algorithm("newton")
+    loc.localize()
+    assert loc.converged
+
+    with pytest.raises(RuntimeError):
+        loc.set_algorithm("NEWTONS")
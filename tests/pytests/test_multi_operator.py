@@ -0,0 +1,106 @@
+"""
+This file tests MintsHelper.ao_operators/so_operators, which compute
+several one-electron operators in one pass, against the one-operator
+integral classes
+"""
+import itertools
+import math
+
+import numpy as np
+import pytest
+import psi4
+
+
+pytestmark = pytest.mark.quick
+
+
+@pytest.fixture
+def mints():
+    mol = psi4.geometry("""
+    units bohr
+    0 1
+    O1     0.000000000000     0.000000000000     0.224348285559
+    H2    -1.423528800232     0.000000000000    -0.897393142237
+    H3     1.423528800232     0.000000000000    -0.897393142237
+    """)
+    basis_obj = psi4.core.BasisSet.build(mol, 'ORBITAL', "cc-pvtz")
+    return psi4.core.MintsHelper(basis_obj)
+
+
+def test_ao_operators(mints):
+    ops = mints.ao_operators(["OVERLAP", "KINETIC", "POTENTIAL", "DIPOLE", "QUADRUPOLE", "OCTUPOLE"])
+    assert len(ops) == 3 + 3 + 6 + 10
+
+    np.testing.assert_allclose(ops[0].np, mints.ao_overlap().np, atol=1.e-12)
+    np.testing.assert_allclose(ops[1].np, mints.ao_kinetic().np, atol=1.e-12)
+    np.testing.assert_allclose(ops[2].np, mints.ao_potential().np, atol=1.e-11)
+    for test, ref in zip(ops[3:6], mints.ao_dipole()):
+        np.testing.assert_allclose(test.np, ref.np, atol=1.e-12)
+    for test, ref in zip(ops[6:12], mints.ao_quadrupole()):
+        np.testing.assert_allclose(test.np, ref.np, atol=1.e-12)
+
+
+def gaussian_moment(n, p, P):
+    """int x^n exp(-p (x - P)^2) dx"""
+    return sum(
+        math.factorial(n) / (math.factorial(m) * math.factorial(n - m)) * P**(n - m) * math.gamma((m + 1) / 2) /
+        p**((m + 1) / 2) for m in range(0, n + 1, 2))
+
+
+def s_multipole(basis, powers):
+    """-(a|x^i y^j z^k|b) about the origin for a basis of s shells, from Gaussian products"""
+    mol = basis.molecule()
+    M = np.zeros((basis.nbf(), basis.nbf()))
+    for P, Q in itertools.product(range(basis.nshell()), repeat=2):
+        sP, sQ = basis.shell(P), basis.shell(Q)
+        A, B = np.array(mol.xyz(sP.ncenter)), np.array(mol.xyz(sQ.ncenter))
+        for a, b in itertools.product(range(sP.nprimitive), range(sQ.nprimitive)):
+            alpha, beta = sP.exp(a), sQ.exp(b)
+            p = alpha + beta
+            center = (alpha * A + beta * B) / p
+            value = sP.coef(a) * sQ.coef(b) * math.exp(-alpha * beta / p * np.dot(A - B, A - B))
+            for n, c in zip(powers, center):
+                value *= gaussian_moment(n, p, c)
+            M[P, Q] -= value
+    return M
+
+
+def test_ao_operators_octupole():
+    mol = psi4.geometry("""
+    units bohr
+    1 1
+    H     0.100000000000     0.200000000000     0.300000000000
+    H     1.500000000000    -0.400000000000     0.100000000000
+    H    -0.300000000000     1.100000000000    -0.800000000000
+    symmetry c1
+    """)
+    basis = psi4.core.BasisSet.build(mol, 'ORBITAL', "sto-3g")
+    mints = psi4.core.MintsHelper(basis)
+    ops = mints.ao_operators(["OVERLAP", "DIPOLE", "QUADRUPOLE", "OCTUPOLE"])
+
+    np.testing.assert_allclose(-s_multipole(basis, (0, 0, 0)), ops[0].np, atol=1.e-12)
+
+    # Cartesian components in psi4 order: xx, xy, xz, yy, yz, zz; xxx, xxy, ..., zzz
+    for order, offset in [(1, 1), (2, 4), (3, 10)]:
+        components = itertools.combinations_with_replacement(range(3), order)
+        for comp, axes in enumerate(components):
+            powers = [axes.count(axis) for axis in range(3)]
+            np.testing.assert_allclose(ops[offset + comp].np, s_multipole(basis, powers), atol=1.e-12)
+
+
+def test_ao_operators_origin(mints):
+    # -(r - O) = -r + O
+    origin = [0.3, -0.2, 0.7]
+    S, *dipole = mints.ao_operators(["OVERLAP", "DIPOLE"], origin)
+    for comp, ref in enumerate(mints.ao_operators(["DIPOLE"])):
+        np.testing.assert_allclose(dipole[comp].np, ref.np + origin[comp] * S.np, atol=1.e-12)
+
+
+def test_so_operators(mints):
+    ops = mints.so_operators(["MULTIPOLE1", "KINETIC"])
+    for test, ref in zip(ops[:3], mints.so_dipole()):
+        assert test.symmetry() == ref.symmetry()
+        for h in range(ref.nirrep()):
+            np.testing.assert_allclose(test.nph[h], ref.nph[h], atol=1.e-12)
+    for h in range(ops[3].nirrep()):
+        np.testing.assert_allclose(ops[3].nph[h], mints.so_kinetic().nph[h], atol=1.e-12)
@@ -1283,3 +1283,40 @@ def test_tdscf(ref, func, ptype, basis, expected, wfn_factory, solver_funcs, eng
     for i, my_v in enumerate(test_vals):
         ref_v = exp_energy_sorted[i]
         assert compare_values(ref_v, my_v, 4, "{}-{}-{}-ROOT-{}".format(ref, func, ptype, i + 1))
+
+
+@pytest.mark.tdscf
+@pytest.mark.parametrize("ref,func,basis", [
+    pytest.param( 'RHF-1',    'HF', 'cc-pvdz', marks=[hf, RHF_singlet, TDA]),
+    pytest.param( 'RHF-3',    'HF', 'cc-pvdz', marks=[hf, RHF_triplet, TDA]),
+    pytest.param( 'RHF-1',  'PBE0', 'cc-pvdz', marks=[hyb_gga, RHF_singlet, TDA]),
+    pytest.param( 'RHF-1', 'wB97X', 'cc-pvdz', marks=[hyb_gga_lrc, RHF_singlet, TDA]),
+]) # yapf: disable
+def test_tdscf_native_tda(ref, func, basis, expected, wfn_factory):
+    # lowest roots from the reference table
+    exp_energy_sorted = np.array([x['e'] for x in expected["{}-{}-TDA-{}".format(ref, func, basis)]])
+    exp_energy_sorted.sort()
+
+    wfn = wfn_factory(ref, func, basis, nosym=True)
+
+    Co = wfn.Ca_subset("SO", "OCC")
+    Cv = wfn.Ca_subset("SO", "VIR")
+    H = psi4.core.TDARHamiltonian(wfn.jk(), wfn.V_potential(), Co, Co, Cv, wfn.epsilon_a_subset("SO", "OCC"),
+                                  wfn.epsilon_a_subset("SO", "VIR"))
+    H.set_singlet(ref == 'RHF-1')
+
+    solver = psi4.core.DLRSolver(H)
+    solver.set_nroot(4)
+    solver.set_nguess(16)
+    solver.set_max_subspace(40)
+    solver.set_min_subspace(8)
+    solver.set_maxiter(30)
+    solver.set_convergence(1.0e-5)
+    solver.set_energy_convergence(1.0e-6)
+    solver.initialize()
+    solver.solve()
+    assert solver.converged(), "Solver did not converge"
+
+    E = solver.eigenvalues()
+    for i in range(4):
+        assert compare_values(exp_energy_sorted[i], E[i][0], 4, "{}-{}-TDA-NATIVE-ROOT-{}".format(ref, func, i + 1))
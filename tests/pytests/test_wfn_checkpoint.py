@@ -0,0 +1,62 @@
+import os
+
+import numpy as np
+import pytest
+
+import psi4
+
+pytestmark = pytest.mark.quick
+
+
+@pytest.fixture
+def scf_wfn():
+    psi4.geometry("""
+    0 1
+    O
+    H 1 1.0
+    H 1 1.0 2 104.5
+    symmetry c2v
+    """)
+    psi4.set_options({'basis': 'sto-3g', 'scf_type': 'pk'})
+    e, wfn = psi4.energy('scf', return_wfn=True)
+    return wfn
+
+
+def test_checkpoint_roundtrip(scf_wfn, tmp_path):
+    filename = str(tmp_path / 'chk')
+    assert scf_wfn.to_file(filename) is None
+    assert os.path.isfile(filename + '.wfn')
+    assert psi4.core.CheckpointFile.is_checkpoint(filename + '.wfn')
+
+    wfn = psi4.core.Wavefunction.from_file(filename)
+    assert psi4.compare_wavefunctions(scf_wfn, wfn)
+
+
+def test_checkpoint_subset(scf_wfn, tmp_path):
+    filename = str(tmp_path / 'chk.wfn')
+    scf_wfn.to_file(filename)
+
+    wfn = psi4.core.Wavefunction.from_file(filename, subset=['Ca', 'Cb'])
+    assert wfn.Da() is None
+    assert psi4.compare_matrices(scf_wfn.Ca(), wfn.Ca(), 10, 'Ca')
+
+
+def test_checkpoint_array_view(scf_wfn, tmp_path):
+    filename = str(tmp_path / 'chk.wfn')
+    scf_wfn.to_file(filename)
+
+    chk = psi4.core.CheckpointFile(filename)
+    ref = scf_wfn.Ca().to_array()
+    for h in range(scf_wfn.nirrep()):
+        view = chk.array('matrix/Ca', h)
+        assert not view.flags.writeable
+        assert np.allclose(view, ref[h])
+
+
+def test_npy_legacy(scf_wfn, tmp_path):
+    filename = str(tmp_path / 'chk.npy')
+    wfn_data = scf_wfn.to_file(filename)
+    assert isinstance(wfn_data, dict)
+
+    wfn = psi4.core.Wavefunction.from_file(filename)
+    assert psi4.compare_wavefunctions(scf_wfn, wfn)